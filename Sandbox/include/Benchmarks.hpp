@@ -0,0 +1,28 @@
+#ifndef BENCHMARKS_HPP
+#define BENCHMARKS_HPP
+
+#include <TIMGE/JobSystem.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+struct BenchmarkResult
+{
+    std::string mName;
+    double mMilliseconds;
+    double mThroughput;
+};
+
+using BenchmarkResults = std::vector<BenchmarkResult>;
+
+BenchmarkResults RunECSBenchmark(TIMGE::JobSystem& jobSystem, std::size_t entityCount);
+BenchmarkResults RunSchedulerBenchmark(TIMGE::JobSystem& jobSystem, std::size_t entityCount);
+BenchmarkResults RunBroadphaseBenchmark(const std::vector<std::size_t>& objectCounts);
+BenchmarkResults RunPhysicsBenchmark(TIMGE::JobSystem& jobSystem, std::size_t pileCount);
+BenchmarkResults RunParticleBenchmark(TIMGE::JobSystem& jobSystem, std::size_t particleCount);
+BenchmarkResults RunSceneBenchmark(std::size_t entityCount);
+// Issues GL calls, so it has to run on the thread owning the context.
+BenchmarkResults RunDrawBenchmark(TIMGE::JobSystem& jobSystem, std::size_t drawCount);
+
+#endif //BENCHMARKS_HPP
@@ -2,13 +2,36 @@
 #define GAME_HPP
 
 #include <array>
+#include <functional>
+#include <future>
+#include <memory>
 #include <TIMGE/TIMGE.hpp>
+#include "Benchmarks.hpp"
 #include "Callbacks.hpp"
 #include "TIMGE/Utils/Vector.hpp"
 
 class Game : public TIMGE::Application
 {
     public:
+        enum class Command : TIMGE::Input::Action
+        {
+            EXIT,
+            MINIMIZE,
+            MAXIMIZE,
+            WINDOW_RESTORE,
+            MOUSE_RESTORE,
+            RAW_MOUSE_MOTION,
+            SHOW,
+            HIDE,
+            FULLSCREEN,
+            BORDERLESS_FULLSCREEN,
+            CENTER_CURSOR,
+            HIDE_CURSOR,
+            CAPTURE_CURSOR,
+            DISABLE_CURSOR,
+            COUNT
+        };
+
         Game();
         ~Game();
         void Run();
@@ -33,19 +56,26 @@ class Game : public TIMGE::Application
         const std::vector<TIMGE::Monitor>& mMonitors;
 
         static TIMGE::Application::Info mGameInfo;
+        static constexpr const char* mCONFIG_PATH = "config.ini";
+        static TIMGE::Config& mGetConfig();
         static Game* mInstance;
         static Game* GetInstance();
         void mWindowSettings();
         void mMonitorSettings();
         void mMouseSettings();
         void mKeybindings();
+        void mRegisterCommands();
+        void mOnKey(const TIMGE::KeyEvent& event);
+        void mGamepads();
+        void mBenchmarks();
         void mMenu();
 
-        static constexpr std::array<decltype(&Game::mWindowSettings), 4> windowsXP = {
+        static constexpr std::array<decltype(&Game::mWindowSettings), 5> windowsXP = {
             &Game::mWindowSettings,
             &Game::mMonitorSettings,
             &Game::mMouseSettings,
-            &Game::mKeybindings
+            &Game::mKeybindings,
+            &Game::mBenchmarks
         };
  
         void mWindowInfoPosition();
@@ -80,6 +110,7 @@ class Game : public TIMGE::Application
         void mMonitorInfoVirtualPosition();
         void mMonitorInfoWorkarea();
         void mMonitorInfoGamma();
+        void mMonitorInfoVideoModes();
 
         void mMouseInfoPosition();
         void mMouseInfoScrollOffset();
@@ -92,6 +123,63 @@ class Game : public TIMGE::Application
         void mMouseInfoRawMotion();
         void mMouseInfoCursors();
 
+        void mBenchmarkRun(std::function<BenchmarkResults()> benchmark);
+        void mBenchmarkResults();
+        void mInputRecording();
+        void mInputLatency();
+        void mDebugWindows();
+        void mRendering();
+        void mRenderGraph();
+        void mIndirectDraw();
+        void mDrawIndirectScene();
+        void mText();
+        void mDrawText();
+        void mParticles();
+        void mDrawParticles();
+        void mHotReload();
+        void mHotReloadImage();
+        void mHotReloadShader();
+        void mConfig();
+
+        std::future<BenchmarkResults> mBenchmarkFuture;
+        BenchmarkResults mBenchmarkResultsList;
+
+        TIMGE::Input::Action mRebindAction;
+
+        TIMGE::Input::Recorder mRecorder;
+        TIMGE::Input::Replayer mReplayer;
+
+        TIMGE::Window* mDebugWindow;
+
+        std::unique_ptr<TIMGE::Render::IndirectRenderer> mIndirectRenderer;
+        uint32_t mIndirectCube;
+        int mIndirectGrid;
+        bool mIndirectEnabled;
+        bool mIndirectCulling;
+        TIMGE::Render::Culler mCuller;
+        TIMGE::Render::OcclusionBuffer mOcclusionBuffer;
+        TIMGE::Render::BoxBounds mCubeBounds;
+        std::vector<uint32_t> mVisibleCubes;
+
+        std::unique_ptr<TIMGE::Render::TextRenderer> mTextRenderer;
+        uint32_t mFont;
+        bool mTextEnabled;
+        std::unique_ptr<TIMGE::Render::ParticleRenderer> mParticleRenderer;
+        TIMGE::Render::ParticleSystem mParticleSystem;
+        uint32_t mFountain;
+        int mParticleRate;
+        bool mParticlesEnabled;
+        GLuint mReloadTexture;
+        TIMGE::V2f mReloadSize;
+        uint32_t mReloadWatch;
+        std::unique_ptr<TIMGE::Render::Shader> mReloadShader;
+        GLuint mReloadFramebuffer;
+        GLuint mReloadTarget;
+        GLuint mReloadVertexArray;
+        uint32_t mReloadShaderWatch;
+        uint32_t mConfigWatch;
+        bool mConfigLive;
+
         friend void ErrorCallback(int errorCode, std::string_view description);
         friend void WindowPosCallback(const TIMGE::V2i32& position);
         friend void WindowSizeCallback(const TIMGE::V2ui32& size);
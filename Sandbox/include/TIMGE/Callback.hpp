@@ -9,6 +9,11 @@
 
 #include <GLFW/glfw3.h>
 
+namespace TIMGE
+{
+    class Application;
+}
+
 namespace TIMGE::Callback
 {
     using Error_t = void (*)(int errorCode, std::string_view description);
@@ -97,5 +102,13 @@ namespace TIMGE::Callback
         Monitor_t mMonitor;
         Joystick_t mJoystick;
     };
+
+    struct Route
+    {
+        Application* mApplication;
+        Window* mWindow;
+        const Callbacks* mCallbacks;
+        bool mPrimary;
+    };
 }
 #endif // CALLBACKDEFS_HPP
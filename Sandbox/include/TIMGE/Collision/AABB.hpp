@@ -0,0 +1,122 @@
+#ifndef COLLISION_AABB_HPP
+#define COLLISION_AABB_HPP
+
+#include "TIMGE/Exception.hpp"
+#include "TIMGE/Utils/Vector.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace TIMGE::Collision
+{
+    class CollisionException : public Exception
+    {
+        public:
+            CollisionException(std::string message);
+    };
+
+    using Proxy = uint32_t;
+
+    static constexpr Proxy NULL_PROXY = std::numeric_limits<Proxy>::max();
+
+    struct Ray
+    {
+        V2f mOrigin;
+        V2f mDirection;
+        float mMaxDistance;
+    };
+
+    struct RaycastHit
+    {
+        uint32_t mUserData;
+        float mDistance;
+    };
+
+    struct Pair
+    {
+        uint32_t mFirst;
+        uint32_t mSecond;
+    };
+
+    struct AABB
+    {
+        V2f mMin;
+        V2f mMax;
+
+        [[nodiscard]] bool Overlaps(const AABB& aabb) const;
+        [[nodiscard]] bool Contains(const AABB& aabb) const;
+        [[nodiscard]] float GetPerimeter() const;
+        [[nodiscard]] AABB Merge(const AABB& aabb) const;
+        [[nodiscard]] AABB Fatten(float margin) const;
+        [[nodiscard]] bool Raycast(const Ray& ray, float& distance) const;
+    };
+
+    [[nodiscard]] inline bool AABB::Overlaps(const AABB& aabb) const
+    {
+        return mMin[V2f::X] <= aabb.mMax[V2f::X] && aabb.mMin[V2f::X] <= mMax[V2f::X]
+            && mMin[V2f::Y] <= aabb.mMax[V2f::Y] && aabb.mMin[V2f::Y] <= mMax[V2f::Y];
+    }
+
+    [[nodiscard]] inline bool AABB::Contains(const AABB& aabb) const
+    {
+        return mMin[V2f::X] <= aabb.mMin[V2f::X] && aabb.mMax[V2f::X] <= mMax[V2f::X]
+            && mMin[V2f::Y] <= aabb.mMin[V2f::Y] && aabb.mMax[V2f::Y] <= mMax[V2f::Y];
+    }
+
+    [[nodiscard]] inline float AABB::GetPerimeter() const {
+        return 2.0f * ((mMax[V2f::X] - mMin[V2f::X]) + (mMax[V2f::Y] - mMin[V2f::Y]));
+    }
+
+    [[nodiscard]] inline AABB AABB::Merge(const AABB& aabb) const
+    {
+        return {
+            { std::min(mMin[V2f::X], aabb.mMin[V2f::X]), std::min(mMin[V2f::Y], aabb.mMin[V2f::Y]) },
+            { std::max(mMax[V2f::X], aabb.mMax[V2f::X]), std::max(mMax[V2f::Y], aabb.mMax[V2f::Y]) }
+        };
+    }
+
+    [[nodiscard]] inline AABB AABB::Fatten(float margin) const
+    {
+        return {
+            { mMin[V2f::X] - margin, mMin[V2f::Y] - margin },
+            { mMax[V2f::X] + margin, mMax[V2f::Y] + margin }
+        };
+    }
+
+    [[nodiscard]] inline bool AABB::Raycast(const Ray& ray, float& distance) const
+    {
+        float tMin = 0.0f;
+        float tMax = ray.mMaxDistance;
+
+        for (std::size_t axis = 0; axis < 2; axis++)
+        {
+            float origin = ray.mOrigin[axis];
+            float direction = ray.mDirection[axis];
+
+            if (direction == 0.0f)
+            {
+                if (origin < mMin[axis] || origin > mMax[axis]) {
+                    return false;
+                }
+                continue;
+            }
+
+            float inverse = 1.0f / direction;
+            float t1 = (mMin[axis] - origin) * inverse;
+            float t2 = (mMax[axis] - origin) * inverse;
+
+            tMin = std::max(tMin, std::min(t1, t2));
+            tMax = std::min(tMax, std::max(t1, t2));
+
+            if (tMin > tMax) {
+                return false;
+            }
+        }
+
+        distance = tMin;
+        return true;
+    }
+}
+
+#endif // COLLISION_AABB_HPP
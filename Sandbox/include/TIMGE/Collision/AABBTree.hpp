@@ -0,0 +1,64 @@
+#ifndef COLLISION_AABBTREE_HPP
+#define COLLISION_AABBTREE_HPP
+
+#include "AABB.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace TIMGE::Collision
+{
+    class AABBTree
+    {
+        public:
+            AABBTree(float margin = 0.1f);
+
+            [[maybe_unused]] Proxy CreateProxy(const AABB& bounds, uint32_t userData);
+            [[maybe_unused]] bool MoveProxy(Proxy proxy, const AABB& bounds);
+            void DestroyProxy(Proxy proxy);
+            void SetUserData(Proxy proxy, uint32_t userData);
+            void Clear();
+
+            void FindPairs(std::vector<Pair>& pairs);
+            void QueryRegion(const AABB& region, std::vector<uint32_t>& results);
+            void Raycast(const Ray& ray, std::vector<RaycastHit>& hits);
+
+            [[nodiscard]] const AABB& GetBounds(Proxy proxy) const;
+            [[nodiscard]] const AABB& GetFatBounds(Proxy proxy) const;
+            [[nodiscard]] uint32_t GetHeight() const;
+            [[nodiscard]] float GetMargin() const;
+            [[nodiscard]] std::size_t GetProxyCount() const;
+        private:
+            struct Node
+            {
+                AABB mFatBounds;
+                AABB mBounds;
+                uint32_t mUserData;
+                uint32_t mParent;
+                uint32_t mChildren[2];
+                int32_t mHeight;
+
+                [[nodiscard]] bool IsLeaf() const { return mChildren[0] == NULL_PROXY; }
+            };
+
+            [[nodiscard]] uint32_t mAllocateNode();
+            void mFreeNode(uint32_t node);
+            void mInsertLeaf(uint32_t leaf);
+            void mRemoveLeaf(uint32_t leaf);
+            [[nodiscard]] uint32_t mBalance(uint32_t node);
+            void mRefit(uint32_t node);
+            [[nodiscard]] const Node& mGetLeaf(Proxy proxy) const;
+
+            float mMargin;
+            std::vector<Node> mNodes;
+            uint32_t mRoot;
+            uint32_t mFreeList;
+            std::size_t mProxyCount;
+            std::vector<uint32_t> mStack;
+            std::vector<std::pair<uint32_t, uint32_t>> mPairStack;
+    };
+}
+
+#endif // COLLISION_AABBTREE_HPP
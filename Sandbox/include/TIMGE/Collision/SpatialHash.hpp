@@ -0,0 +1,69 @@
+#ifndef COLLISION_SPATIALHASH_HPP
+#define COLLISION_SPATIALHASH_HPP
+
+#include "AABB.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TIMGE::Collision
+{
+    class SpatialHash
+    {
+        public:
+            SpatialHash(float cellSize);
+
+            [[maybe_unused]] Proxy CreateProxy(const AABB& bounds, uint32_t userData);
+            void MoveProxy(Proxy proxy, const AABB& bounds);
+            void DestroyProxy(Proxy proxy);
+            void Clear();
+
+            void FindPairs(std::vector<Pair>& pairs);
+            void QueryRegion(const AABB& region, std::vector<uint32_t>& results);
+            void Raycast(const Ray& ray, std::vector<RaycastHit>& hits);
+
+            [[nodiscard]] const AABB& GetBounds(Proxy proxy) const;
+            [[nodiscard]] float GetCellSize() const;
+            [[nodiscard]] std::size_t GetProxyCount() const;
+        private:
+            struct Object
+            {
+                AABB mBounds;
+                uint32_t mUserData;
+                uint32_t mStamp;
+                bool mAlive;
+            };
+
+            struct Entry
+            {
+                int32_t mX;
+                int32_t mY;
+                Proxy mProxy;
+            };
+
+            void mRebuild();
+            void mVisitCell(int32_t x, int32_t y, const AABB& region, std::vector<uint32_t>& results);
+            [[nodiscard]] Object& mGetObject(Proxy proxy);
+            [[nodiscard]] int32_t mToCell(float coordinate) const;
+            [[nodiscard]] uint32_t mGetBucket(int32_t x, int32_t y) const;
+
+            float mCellSize;
+            float mInverseCellSize;
+
+            std::vector<Object> mObjects;
+            std::vector<Proxy> mFreeProxies;
+            std::size_t mProxyCount;
+
+            std::vector<Entry> mEntries;
+            std::vector<Entry> mScratch;
+            std::vector<uint32_t> mBucketStarts;
+            std::vector<uint32_t> mBucketCursors;
+            uint32_t mBucketMask;
+            AABB mWorldBounds;
+            uint32_t mStamp;
+            bool mDirty;
+    };
+}
+
+#endif // COLLISION_SPATIALHASH_HPP
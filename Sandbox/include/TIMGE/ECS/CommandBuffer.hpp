@@ -0,0 +1,97 @@
+#ifndef ECS_COMMANDBUFFER_HPP
+#define ECS_COMMANDBUFFER_HPP
+
+#include "Component.hpp"
+#include "Entity.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace TIMGE::ECS
+{
+    class CommandBuffer
+    {
+        public:
+            CommandBuffer();
+            ~CommandBuffer();
+
+            CommandBuffer(const CommandBuffer&) = delete;
+            CommandBuffer& operator=(const CommandBuffer&) = delete;
+            CommandBuffer(CommandBuffer&& commandBuffer) noexcept;
+            CommandBuffer& operator=(CommandBuffer&& commandBuffer) noexcept;
+
+            void CreateEntity();
+            template<typename... Components_T>
+            void CreateEntity(Components_T&&... components);
+            void DestroyEntity(Entity entity);
+
+            template<typename Type_T>
+            void AddComponent(Entity entity, Type_T&& component);
+            template<typename Type_T>
+            void RemoveComponent(Entity entity);
+
+            void Clear();
+
+            [[nodiscard]] bool IsEmpty() const;
+            [[nodiscard]] std::size_t GetSize() const;
+        private:
+            enum class Type : uint8_t
+            {
+                CREATE,
+                DESTROY,
+                ADD,
+                REMOVE
+            };
+
+            struct Command
+            {
+                Type mType;
+                ComponentID mComponent;
+                Entity mEntity;
+                void* mPayload;
+            };
+
+            [[nodiscard]] void* mAllocate(std::size_t size, std::size_t alignment);
+            void mReset();
+
+            static constexpr std::size_t mBLOCK_SIZE = 4096;
+
+            std::vector<Command> mCommands;
+            std::vector<std::unique_ptr<std::byte[]>> mBlocks;
+            std::vector<std::size_t> mBlockSizes;
+            std::size_t mBlockIndex;
+            std::size_t mBlockOffset;
+
+            friend class World;
+    };
+
+    template<typename... Components_T>
+    void CommandBuffer::CreateEntity(Components_T&&... components)
+    {
+        CreateEntity();
+        (AddComponent(Entity{}, std::forward<Components_T>(components)), ...);
+    }
+
+    template<typename Type_T>
+    void CommandBuffer::AddComponent(Entity entity, Type_T&& component)
+    {
+        using Component_T = std::remove_cvref_t<Type_T>;
+
+        void* payload = mAllocate(sizeof(Component_T), alignof(Component_T));
+        new (payload) Component_T(std::forward<Type_T>(component));
+
+        mCommands.push_back({ Type::ADD, Component::GetID<Component_T>(), entity, payload });
+    }
+
+    template<typename Type_T>
+    void CommandBuffer::RemoveComponent(Entity entity) {
+        mCommands.push_back({ Type::REMOVE, Component::GetID<Type_T>(), entity, nullptr });
+    }
+}
+
+#endif // ECS_COMMANDBUFFER_HPP
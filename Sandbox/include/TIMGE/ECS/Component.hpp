@@ -0,0 +1,85 @@
+#ifndef ECS_COMPONENT_HPP
+#define ECS_COMPONENT_HPP
+
+#include "TIMGE/Exception.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace TIMGE::ECS
+{
+    class ECSException : public Exception
+    {
+        public:
+            ECSException(std::string message);
+    };
+
+    using ComponentID = uint32_t;
+    using Signature = uint64_t;
+
+    static constexpr uint32_t MAX_COMPONENTS = 64;
+
+    struct ComponentInfo
+    {
+        std::size_t mSize;
+        std::size_t mAlignment;
+        void (*mMoveConstruct)(void* destination, void* source);
+        void (*mDestroy)(void* data);
+    };
+
+    class Component
+    {
+        public:
+            template<typename Type_T>
+            [[nodiscard]] static ComponentID GetID();
+
+            template<typename... Types_T>
+            [[nodiscard]] static Signature GetSignature();
+
+            [[nodiscard]] static const ComponentInfo& GetInfo(ComponentID id);
+            [[nodiscard]] static uint32_t GetCount();
+        private:
+            template<typename Type_T>
+            [[nodiscard]] static ComponentID mGetID();
+            [[nodiscard]] static ComponentID mRegister(const ComponentInfo& info);
+
+            static std::array<ComponentInfo, MAX_COMPONENTS> mInfos;
+            static uint32_t mCount;
+    };
+
+    template<typename Type_T>
+    [[nodiscard]] ComponentID Component::GetID() {
+        return mGetID<std::remove_cvref_t<Type_T>>();
+    }
+
+    template<typename Component_T>
+    [[nodiscard]] ComponentID Component::mGetID()
+    {
+        static_assert(std::is_move_constructible_v<Component_T>, "Components must be move constructible.");
+        static_assert(std::is_destructible_v<Component_T>, "Components must be destructible.");
+
+        static const ComponentID id = mRegister(ComponentInfo {
+            sizeof(Component_T),
+            alignof(Component_T),
+            [](void* destination, void* source) {
+                new (destination) Component_T(std::move(*static_cast<Component_T*>(source)));
+            },
+            [](void* data) {
+                static_cast<Component_T*>(data)->~Component_T();
+            }
+        });
+
+        return id;
+    }
+
+    template<typename... Types_T>
+    [[nodiscard]] Signature Component::GetSignature() {
+        return (Signature{0} | ... | (Signature{1} << GetID<Types_T>()));
+    }
+}
+
+#endif // ECS_COMPONENT_HPP
@@ -0,0 +1,22 @@
+#ifndef ECS_ENTITY_HPP
+#define ECS_ENTITY_HPP
+
+#include "TIMGE/Utils/HandlePool.hpp"
+
+#include <cstdint>
+
+namespace TIMGE::ECS
+{
+    class Archetype;
+
+    struct EntityRecord
+    {
+        Archetype* mArchetype;
+        uint32_t mChunk;
+        uint32_t mRow;
+    };
+
+    using Entity = HandlePool<EntityRecord>::Handle_T;
+}
+
+#endif // ECS_ENTITY_HPP
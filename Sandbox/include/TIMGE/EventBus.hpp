@@ -0,0 +1,137 @@
+#ifndef EVENTBUS_HPP
+#define EVENTBUS_HPP
+
+#include "Exception.hpp"
+#include "Utils/Delegate.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace TIMGE
+{
+    class EventBusException : public Exception
+    {
+        public:
+            EventBusException(std::string message);
+    };
+
+    enum class Priority : uint8_t
+    {
+        HIGHEST,
+        HIGH,
+        NORMAL,
+        LOW,
+        LOWEST,
+        COUNT
+    };
+
+    class EventBus
+    {
+        public:
+            static constexpr uint32_t MAX_EVENT_TYPES = 64;
+            static constexpr std::size_t DELEGATE_CAPACITY = 4 * sizeof(void*);
+
+            struct Subscription
+            {
+                uint32_t mType = UINT32_MAX;
+                uint32_t mIndex = UINT32_MAX;
+                uint32_t mGeneration = 0;
+
+                [[nodiscard]] bool IsNull() const;
+            };
+
+            EventBus();
+
+            EventBus(const EventBus&) = delete;
+            EventBus& operator=(const EventBus&) = delete;
+
+            template<typename Event_T, typename Function_T>
+            [[maybe_unused]] Subscription Subscribe(Function_T&& function, Priority priority = Priority::NORMAL);
+            void Unsubscribe(Subscription& subscription);
+            void Clear();
+
+            template<typename Event_T>
+            void Publish(const Event_T& event);
+
+            [[nodiscard]] bool IsSubscribed(const Subscription& subscription) const;
+
+            template<typename Event_T>
+            [[nodiscard]] std::size_t GetListenerCount() const;
+        private:
+            using Listener_T = Delegate<void(const void*), DELEGATE_CAPACITY>;
+
+            static constexpr uint32_t mNULL_INDEX = UINT32_MAX;
+            static constexpr std::size_t mPAGE_SIZE = 64;
+            static constexpr std::size_t mPRIORITIES = static_cast<std::size_t>(Priority::COUNT);
+
+            struct Node
+            {
+                Listener_T mListener;
+                uint32_t mPrevious;
+                uint32_t mNext;
+                uint32_t mGeneration;
+                uint32_t mType;
+                Priority mPriority;
+                bool mActive;
+            };
+
+            struct Channel
+            {
+                std::array<uint32_t, mPRIORITIES> mHeads;
+                std::array<uint32_t, mPRIORITIES> mTails;
+                std::size_t mCount;
+            };
+
+            using Page_T = std::array<Node, mPAGE_SIZE>;
+
+            template<typename Event_T>
+            [[nodiscard]] static uint32_t mGetType();
+            [[nodiscard]] static uint32_t mRegisterType();
+
+            [[nodiscard]] Subscription mSubscribe(uint32_t type, Listener_T&& listener, Priority priority);
+            void mPublish(uint32_t type, const void* event);
+            void mEndDispatch();
+            [[nodiscard]] Node& mGetNode(uint32_t index);
+            [[nodiscard]] const Node& mGetNode(uint32_t index) const;
+
+            std::array<Channel, MAX_EVENT_TYPES> mChannels;
+            std::vector<std::unique_ptr<Page_T>> mPages;
+            std::vector<uint32_t> mFree;
+            std::vector<uint32_t> mRetired;
+            uint32_t mDispatchDepth;
+    };
+
+    template<typename Event_T, typename Function_T>
+    [[maybe_unused]] EventBus::Subscription EventBus::Subscribe(Function_T&& function, Priority priority)
+    {
+        static_assert(std::is_invocable_v<std::decay_t<Function_T>&, const Event_T&>, "Listener must be callable with the event type.");
+
+        return mSubscribe(mGetType<Event_T>(), Listener_T([function = std::forward<Function_T>(function)](const void* event) mutable {
+            function(*static_cast<const Event_T*>(event));
+        }), priority);
+    }
+
+    template<typename Event_T>
+    void EventBus::Publish(const Event_T& event) {
+        mPublish(mGetType<Event_T>(), &event);
+    }
+
+    template<typename Event_T>
+    [[nodiscard]] std::size_t EventBus::GetListenerCount() const {
+        return mChannels[mGetType<Event_T>()].mCount;
+    }
+
+    template<typename Event_T>
+    [[nodiscard]] uint32_t EventBus::mGetType()
+    {
+        static const uint32_t type = mRegisterType();
+        return type;
+    }
+}
+
+#endif // EVENTBUS_HPP
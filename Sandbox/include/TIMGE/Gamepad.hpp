@@ -0,0 +1,109 @@
+#ifndef GAMEPAD_HPP
+#define GAMEPAD_HPP
+
+#include "Window.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <GLFW/glfw3.h>
+
+namespace TIMGE
+{
+    enum class GamepadButton
+    {
+        A = GLFW_GAMEPAD_BUTTON_A,
+        B = GLFW_GAMEPAD_BUTTON_B,
+        X = GLFW_GAMEPAD_BUTTON_X,
+        Y = GLFW_GAMEPAD_BUTTON_Y,
+        LEFT_BUMPER = GLFW_GAMEPAD_BUTTON_LEFT_BUMPER,
+        RIGHT_BUMPER = GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER,
+        BACK = GLFW_GAMEPAD_BUTTON_BACK,
+        START = GLFW_GAMEPAD_BUTTON_START,
+        GUIDE = GLFW_GAMEPAD_BUTTON_GUIDE,
+        LEFT_THUMB = GLFW_GAMEPAD_BUTTON_LEFT_THUMB,
+        RIGHT_THUMB = GLFW_GAMEPAD_BUTTON_RIGHT_THUMB,
+        DPAD_UP = GLFW_GAMEPAD_BUTTON_DPAD_UP,
+        DPAD_RIGHT = GLFW_GAMEPAD_BUTTON_DPAD_RIGHT,
+        DPAD_DOWN = GLFW_GAMEPAD_BUTTON_DPAD_DOWN,
+        DPAD_LEFT = GLFW_GAMEPAD_BUTTON_DPAD_LEFT,
+        LAST = GLFW_GAMEPAD_BUTTON_LAST
+    };
+
+    enum class GamepadAxis
+    {
+        LEFT_X = GLFW_GAMEPAD_AXIS_LEFT_X,
+        LEFT_Y = GLFW_GAMEPAD_AXIS_LEFT_Y,
+        RIGHT_X = GLFW_GAMEPAD_AXIS_RIGHT_X,
+        RIGHT_Y = GLFW_GAMEPAD_AXIS_RIGHT_Y,
+        LEFT_TRIGGER = GLFW_GAMEPAD_AXIS_LEFT_TRIGGER,
+        RIGHT_TRIGGER = GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER,
+        LAST = GLFW_GAMEPAD_AXIS_LAST
+    };
+
+    class GamepadException : public Exception
+    {
+        public:
+            GamepadException(std::string message);
+    };
+
+    class Gamepad
+    {
+        private:
+            using GetGamepadState_t = int (*)(int jid, GLFWgamepadstate* state);
+            using GetGamepadName_t = const char* (*)(int jid);
+        public:
+            static constexpr std::size_t MAX_GAMEPADS = GLFW_JOYSTICK_LAST + 1;
+            static constexpr std::size_t BUTTON_COUNT = GLFW_GAMEPAD_BUTTON_LAST + 1;
+            static constexpr std::size_t AXIS_COUNT = GLFW_GAMEPAD_AXIS_LAST + 1;
+            static constexpr uint32_t NONE = UINT32_MAX;
+
+            struct Snapshot
+            {
+                bool mConnected;
+                uint16_t mButtons;
+                std::array<float, AXIS_COUNT> mAxes;
+            };
+
+            Gamepad();
+
+            void Poll();
+
+            void SetDeadzone(float deadzone);
+            void SetTriggerDeadzone(float deadzone);
+
+            [[nodiscard]] bool IsConnected(uint32_t pad) const;
+            [[nodiscard]] bool Pressed(uint32_t pad, GamepadButton button) const;
+            [[nodiscard]] bool Released(uint32_t pad, GamepadButton button) const;
+            [[nodiscard]] bool JustPressed(uint32_t pad, GamepadButton button) const;
+            [[nodiscard]] bool JustReleased(uint32_t pad, GamepadButton button) const;
+            [[nodiscard]] float GetAxis(uint32_t pad, GamepadAxis axis) const;
+            [[nodiscard]] std::string_view GetName(uint32_t pad) const;
+
+            [[nodiscard]] const Snapshot& GetSnapshot(uint32_t pad) const;
+            [[nodiscard]] const Snapshot& GetPreviousSnapshot(uint32_t pad) const;
+            [[nodiscard]] uint32_t GetPrimary() const;
+            [[nodiscard]] std::size_t GetConnectedCount() const;
+            [[nodiscard]] float GetDeadzone() const;
+            [[nodiscard]] float GetTriggerDeadzone() const;
+
+            static GetGamepadState_t GetGamepadState;
+            static GetGamepadName_t GetGamepadName;
+        private:
+            void mCheckPad(uint32_t pad) const;
+            void mFilterStick(float& x, float& y) const;
+            [[nodiscard]] float mFilterTrigger(float value) const;
+
+            std::array<Snapshot, MAX_GAMEPADS> mCurrent;
+            std::array<Snapshot, MAX_GAMEPADS> mPrevious;
+            std::array<std::string, MAX_GAMEPADS> mNames;
+
+            float mDeadzone;
+            float mTriggerDeadzone;
+    };
+}
+
+#endif // GAMEPAD_HPP
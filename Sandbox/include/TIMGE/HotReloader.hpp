@@ -0,0 +1,127 @@
+#ifndef HOT_RELOADER_HPP
+#define HOT_RELOADER_HPP
+
+#include "Exception.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace TIMGE
+{
+    class HotReloaderException : public Exception
+    {
+        public:
+            HotReloaderException(std::string message);
+    };
+
+    class HotReloader
+    {
+        public:
+            struct Failure
+            {
+                std::filesystem::path mPath;
+                std::string mMessage;
+            };
+
+            struct Statistics
+            {
+                uint32_t mReloads;
+                uint32_t mFailures;
+            };
+
+            // Editors often save in several writes, so a file has to be quiet
+            // for this long before it is read again.
+            static constexpr std::chrono::milliseconds DEBOUNCE{50};
+
+            // onPending runs on the watcher thread whenever reloaded assets are
+            // waiting for Apply, e.g. to wake up a blocked event loop.
+            HotReloader(std::function<void()> onPending = {});
+            ~HotReloader();
+
+            HotReloader(const HotReloader&) = delete;
+            HotReloader& operator=(const HotReloader&) = delete;
+
+            // load runs on the watcher thread and must not touch GL; apply runs
+            // inside Apply. The asset is not loaded up front, only on changes.
+            template<typename Asset_T>
+            [[maybe_unused]] uint32_t Watch(const std::filesystem::path& path, std::function<Asset_T(const std::filesystem::path&)> load, std::function<void(Asset_T&)> apply);
+            void Unwatch(uint32_t watch);
+
+            // Swaps in every asset reloaded since the last call. Meant to be called
+            // at a frame boundary on the thread owning the GL context.
+            [[maybe_unused]] std::size_t Apply();
+
+            [[nodiscard]] std::size_t GetWatchCount() const;
+            [[nodiscard]] const std::vector<Failure>& GetFailures() const;
+            [[nodiscard]] const Statistics& GetStatistics() const;
+        private:
+            using Applier_T = std::function<void()>;
+            using Loader_T = std::function<Applier_T(const std::filesystem::path&)>;
+
+            struct Entry
+            {
+                uint32_t mId;
+                std::filesystem::path mPath;
+                Loader_T mLoad;
+                std::filesystem::file_time_type mWriteTime;
+                std::chrono::steady_clock::time_point mChanged;
+                bool mDirty;
+            };
+
+            struct Result
+            {
+                uint32_t mId;
+                std::filesystem::path mPath;
+                Applier_T mApply;
+                std::string mError;
+            };
+
+            [[maybe_unused]] uint32_t mAdd(const std::filesystem::path& path, Loader_T load);
+            void mStart();
+            void mRun();
+            void mMarkDirty(const std::filesystem::path& path);
+            void mPollWriteTimes();
+            void mLoadDirty();
+            [[nodiscard]] bool mHasDirty();
+
+            std::vector<Entry> mEntries;
+            std::vector<Result> mResults;
+            std::vector<Failure> mFailures;
+            Statistics mStatistics;
+            uint32_t mNextId;
+
+            std::function<void()> mOnPending;
+            std::thread mThread;
+            std::atomic<bool> mRunning;
+            mutable std::mutex mMutex;
+            std::condition_variable mCondition;
+
+            // inotify descriptor, watched directories and the pipe used to wake
+            // the watcher for shutdown; unused where the watcher polls instead.
+            int mNotify;
+            int mWake[2];
+            std::unordered_map<int, std::filesystem::path> mDirectories;
+    };
+
+    template<typename Asset_T>
+    [[maybe_unused]] uint32_t HotReloader::Watch(const std::filesystem::path& path, std::function<Asset_T(const std::filesystem::path&)> load, std::function<void(Asset_T&)> apply)
+    {
+        return mAdd(path, [load = std::move(load), apply = std::move(apply)](const std::filesystem::path& file) -> Applier_T {
+            std::shared_ptr<Asset_T> asset = std::make_shared<Asset_T>(load(file));
+            return [asset, apply]{ apply(*asset); };
+        });
+    }
+}
+
+#endif // HOT_RELOADER_HPP
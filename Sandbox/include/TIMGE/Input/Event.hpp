@@ -0,0 +1,86 @@
+#ifndef INPUT_EVENT_HPP
+#define INPUT_EVENT_HPP
+
+#include "TIMGE/Exception.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace TIMGE::Input
+{
+    class InputException : public Exception
+    {
+        public:
+            InputException(std::string message);
+    };
+
+    enum class EventType : uint8_t
+    {
+        FRAME,
+        MOUSE_BUTTON,
+        CURSOR_POS,
+        CURSOR_ENTER,
+        SCROLL,
+        KEY,
+        CHAR,
+        CHAR_MODS,
+        DROP,
+        JOYSTICK,
+        COUNT
+    };
+
+    struct Event
+    {
+        EventType mType;
+        uint64_t mFrame;
+        uint64_t mTimestamp;
+        std::array<int32_t, 4> mIntegers;
+        std::array<double, 2> mReals;
+        std::vector<std::string> mPaths;
+    };
+
+    class EventWriter
+    {
+        public:
+            EventWriter();
+
+            void Write(const Event& event);
+            void Clear();
+
+            [[nodiscard]] const std::vector<uint8_t>& GetData() const;
+            [[nodiscard]] std::size_t GetEventCount() const;
+        private:
+            void mWriteHeader();
+            void mWriteVarint(uint64_t value);
+            void mWriteInteger(int32_t value);
+            void mWriteReal(double value);
+
+            std::vector<uint8_t> mData;
+            uint64_t mFrame;
+            uint64_t mTimestamp;
+            std::size_t mEventCount;
+    };
+
+    class EventReader
+    {
+        public:
+            EventReader(std::span<const uint8_t> data = {});
+
+            [[nodiscard]] bool Read(Event& event);
+        private:
+            [[nodiscard]] uint64_t mReadVarint();
+            [[nodiscard]] int32_t mReadInteger();
+            [[nodiscard]] double mReadReal();
+
+            std::span<const uint8_t> mData;
+            std::size_t mOffset;
+            uint64_t mFrame;
+            uint64_t mTimestamp;
+    };
+}
+
+#endif // INPUT_EVENT_HPP
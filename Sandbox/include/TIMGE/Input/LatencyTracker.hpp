@@ -0,0 +1,88 @@
+#ifndef INPUT_LATENCY_TRACKER_HPP
+#define INPUT_LATENCY_TRACKER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace TIMGE::Input
+{
+    class LatencyTracker
+    {
+        public:
+            enum class Source : uint8_t
+            {
+                KEY,
+                MOUSE_BUTTON,
+                CURSOR_POS,
+                SCROLL,
+                COUNT
+            };
+
+            struct Statistics
+            {
+                uint64_t mCount;
+                double mMin;
+                double mMax;
+                double mMean;
+                double mP50;
+                double mP90;
+                double mP99;
+            };
+
+            static constexpr std::size_t BIN_COUNT = 512;
+            static constexpr double BIN_WIDTH = 0.25;
+            static constexpr std::size_t MAX_PENDING = 256;
+
+            LatencyTracker();
+
+            void SetEnabled(bool enabled);
+            void Reset();
+
+            void OnInput(Source source);
+            void OnFrameBegin();
+            void OnFramePresented();
+
+            [[nodiscard]] bool IsEnabled() const;
+            [[nodiscard]] uint64_t GetFrame() const;
+            [[nodiscard]] uint64_t GetDropped() const;
+            [[nodiscard]] Statistics GetStatistics(Source source) const;
+            [[nodiscard]] std::span<const uint32_t> GetHistogram(Source source) const;
+            [[nodiscard]] std::string Dump() const;
+        private:
+            using Clock_T = std::chrono::steady_clock;
+
+            struct Pending
+            {
+                Source mSource;
+                Clock_T::time_point mArrival;
+            };
+
+            struct Distribution
+            {
+                std::array<uint32_t, BIN_COUNT + 1> mBins;
+                uint64_t mCount;
+                double mSum;
+                double mMin;
+                double mMax;
+            };
+
+            [[nodiscard]] double mPercentile(const Distribution& distribution, double fraction) const;
+
+            std::array<Pending, MAX_PENDING> mPending;
+            std::array<Pending, MAX_PENDING> mInFlight;
+            std::size_t mPendingCount;
+            std::size_t mInFlightCount;
+
+            std::array<Distribution, static_cast<std::size_t>(Source::COUNT)> mDistributions;
+
+            uint64_t mFrame;
+            uint64_t mDropped;
+            bool mEnabled;
+    };
+}
+
+#endif // INPUT_LATENCY_TRACKER_HPP
@@ -0,0 +1,58 @@
+#ifndef INPUT_RECORDER_HPP
+#define INPUT_RECORDER_HPP
+
+#include "Event.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace TIMGE
+{
+    class Application;
+}
+
+namespace TIMGE::Input
+{
+    class Recorder
+    {
+        public:
+            Recorder();
+            ~Recorder();
+
+            Recorder(const Recorder&) = delete;
+            Recorder& operator=(const Recorder&) = delete;
+
+            void Start(Application& application);
+            void Stop();
+            void Save(const std::filesystem::path& path) const;
+
+            void Record(EventType type, const std::array<int32_t, 4>& integers = {}, const std::array<double, 2>& reals = {});
+            void RecordDrop(int pathCount, const char* paths[]);
+
+            [[nodiscard]] bool IsRecording() const;
+            [[nodiscard]] uint64_t GetFrame() const;
+            [[nodiscard]] std::size_t GetEventCount() const;
+            [[nodiscard]] const std::vector<uint8_t>& GetData() const;
+
+            [[nodiscard]] static Recorder* GetActive();
+        private:
+            using EventProcessor_T = void (*)();
+
+            static void mProcessEvents();
+            void mWrite(Event& event);
+
+            EventWriter mWriter;
+            Application* mApplication;
+            EventProcessor_T mPreviousProcessor;
+            std::chrono::steady_clock::time_point mStartTime;
+            uint64_t mFrame;
+
+            static Recorder* mActive;
+    };
+}
+
+#endif // INPUT_RECORDER_HPP
@@ -0,0 +1,118 @@
+#ifndef JOBSYSTEM_HPP
+#define JOBSYSTEM_HPP
+
+#include "Exception.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TIMGE
+{
+    class JobSystemException : public Exception
+    {
+        public:
+            JobSystemException(std::string message);
+    };
+
+    class JobSystem
+    {
+        public:
+            using Counter = std::atomic<uint32_t>;
+
+            struct Job
+            {
+                void (*mFunction)(void* data, uint32_t workerIndex);
+                void* mData;
+            };
+
+            JobSystem(uint32_t threadCount = 0);
+            ~JobSystem();
+
+            JobSystem(const JobSystem&) = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+
+            void Submit(const Job& job, Counter& counter);
+            // May be called from any thread. While waiting it only runs jobs
+            // submitted with this counter, so a thread outside the pool, which
+            // always acts as worker 0, never runs another caller's batch.
+            void Wait(const Counter& counter);
+
+            template<typename Function_T>
+            void ParallelFor(uint32_t count, uint32_t batchSize, const Function_T& function);
+
+            [[nodiscard]] uint32_t GetThreadCount() const;
+            // 0 on every thread outside the pool; 1 to GetThreadCount() - 1 on
+            // the workers.
+            [[nodiscard]] static uint32_t GetWorkerIndex();
+        private:
+            struct QueuedJob
+            {
+                Job mJob;
+                Counter* mCounter;
+            };
+
+            void mWorkerLoop(uint32_t workerIndex);
+            [[nodiscard]] bool mTryExecute(const Counter& counter);
+            static void mExecute(const QueuedJob& job);
+
+            std::vector<std::thread> mThreads;
+            std::deque<QueuedJob> mQueue;
+            std::mutex mMutex;
+            std::condition_variable mCondition;
+            bool mRunning;
+
+            static thread_local uint32_t mWorkerIndex;
+    };
+
+    template<typename Function_T>
+    void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const Function_T& function)
+    {
+        if (count == 0) {
+            return;
+        }
+
+        batchSize = std::max(batchSize, 1u);
+        uint32_t batchCount = (count + batchSize - 1) / batchSize;
+
+        if (batchCount == 1 || mThreads.empty())
+        {
+            function(0u, count, GetWorkerIndex());
+            return;
+        }
+
+        struct Context
+        {
+            const Function_T* mFunction;
+            std::atomic<uint32_t> mNext;
+            uint32_t mCount;
+            uint32_t mBatchSize;
+        };
+
+        Context context{ &function, 0, count, batchSize };
+
+        auto run = [](void* data, uint32_t workerIndex)
+        {
+            Context& ctx = *static_cast<Context*>(data);
+            for (uint32_t begin = ctx.mNext.fetch_add(ctx.mBatchSize); begin < ctx.mCount; begin = ctx.mNext.fetch_add(ctx.mBatchSize)) {
+                (*ctx.mFunction)(begin, std::min(begin + ctx.mBatchSize, ctx.mCount), workerIndex);
+            }
+        };
+
+        Counter counter{0};
+        uint32_t helperCount = std::min(batchCount, GetThreadCount()) - 1;
+        for (uint32_t i = 0; i < helperCount; i++) {
+            Submit({ run, &context }, counter);
+        }
+
+        run(&context, GetWorkerIndex());
+        Wait(counter);
+    }
+}
+
+#endif // JOBSYSTEM_HPP
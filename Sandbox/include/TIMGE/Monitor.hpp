@@ -4,7 +4,9 @@
 #include "Exception.hpp"
 #include "Utils/Vector.hpp"
 
+#include <cstdint>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <glad/glad.h>
@@ -21,11 +23,21 @@ namespace TIMGE
     class Monitor
     {
         public:
+            struct VideoMode
+            {
+                V2ui32 mSize;
+                uint32_t mRefreshRate;
+                uint32_t mBitDepth;
+
+                [[nodiscard]] bool operator==(const VideoMode& videoMode) const = default;
+            };
+
             Monitor(const Monitor& monitor) = default;
             ~Monitor();
 
             [[nodiscard]] static const std::vector<Monitor>& GetMonitors();
             [[nodiscard]] static const Monitor& GetPrimaryMonitor();
+            [[nodiscard]] static uint64_t GetGeneration();
 
             [[nodiscard]] const V2ui32& GetPhysicalSize() const;
             [[nodiscard]] const V2f& GetContentScale() const;
@@ -37,25 +49,31 @@ namespace TIMGE
 
             [[nodiscard]] const float& GetGamma() const;
 
+            [[nodiscard]] const std::vector<VideoMode>& GetVideoModes() const;
+            [[nodiscard]] const VideoMode& GetVideoMode() const;
+            [[nodiscard]] const VideoMode& GetBestVideoMode(const V2ui32& size, uint32_t refreshRate) const;
+
             void SetGamma(float gamma);
         private:
             Monitor(GLFWmonitor* monitor);
 
             [[nodiscard]] GLFWmonitor* mGetMonitor() const;
+            [[nodiscard]] static const Monitor* mFind(GLFWmonitor* monitor);
             static void mRetrieveMonitors();
+            static void mInvalidate();
  
             void mRetrievePhysicalSize();
             void mRetrieveContentScale();
             void mRetrievePosition();
             void mRetrieveWorkarea();
             void mRetrieveName();
-
-            static void mConnect(GLFWmonitor* monitor);
-            static void mDisconnect(GLFWmonitor* monitor);
+            void mRetrieveVideoModes();
 
             GLFWmonitor* mMonitor;
 
             static std::vector<Monitor> mMonitors;
+            static std::unordered_map<GLFWmonitor*, std::size_t> mIndices;
+            static uint64_t mGeneration;
 
             static bool mMonitorsRetrieved;
 
@@ -69,6 +87,9 @@ namespace TIMGE
 
             mutable float mGamma;
 
+            std::vector<VideoMode> mVideoModes;
+            VideoMode mVideoMode;
+
             friend class Application;
             friend class Window;
     };
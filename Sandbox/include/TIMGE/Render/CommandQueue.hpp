@@ -0,0 +1,131 @@
+#ifndef RENDER_COMMAND_QUEUE_HPP
+#define RENDER_COMMAND_QUEUE_HPP
+
+#include "TIMGE/Exception.hpp"
+#include "TIMGE/JobSystem.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace TIMGE::Render
+{
+    class CommandQueueException : public Exception
+    {
+        public:
+            CommandQueueException(std::string message);
+    };
+
+    enum class Primitive : uint8_t
+    {
+        TRIANGLES,
+        LINES,
+        POINTS
+    };
+
+    // Handles are opaque to the recording side; only CommandQueue::Execute
+    // interprets them as GL object names.
+    struct Packet
+    {
+        uint64_t mKey;
+        uint32_t mProgram;
+        uint32_t mVertexArray;
+        uint32_t mTexture;
+        int32_t mUniformLocation;
+        uint32_t mFirstIndex;
+        uint32_t mIndexCount;
+        uint32_t mUniformOffset;
+        uint32_t mSequence;
+        uint16_t mUniformCount;
+        uint8_t mBuffer;
+        Primitive mPrimitive;
+    };
+
+    class CommandBuffer
+    {
+        public:
+            CommandBuffer(uint8_t index);
+
+            // Fills in mUniformOffset, mSequence, mUniformCount and mBuffer;
+            // uniforms are copied as vec4s and uploaded to mUniformLocation on
+            // replay.
+            void Draw(const Packet& packet, std::span<const float> uniforms = {});
+            void Clear();
+
+            [[nodiscard]] std::size_t GetSize() const;
+            [[nodiscard]] const std::vector<Packet>& GetPackets() const;
+        private:
+            uint8_t mIndex;
+            uint32_t mSequence;
+            std::vector<Packet> mPackets;
+            std::vector<float> mUniforms;
+
+            friend class CommandQueue;
+    };
+
+    class CommandQueue
+    {
+        public:
+            struct Statistics
+            {
+                uint32_t mPackets;
+                uint32_t mDrawCalls;
+                uint32_t mProgramBinds;
+                uint32_t mVertexArrayBinds;
+                uint32_t mTextureBinds;
+            };
+
+            static constexpr uint32_t MAX_BUFFERS = UINT8_MAX + 1;
+
+            CommandQueue(uint32_t bufferCount);
+
+            CommandQueue(const CommandQueue&) = delete;
+            CommandQueue& operator=(const CommandQueue&) = delete;
+
+            template<typename Function_T>
+            void Record(JobSystem& jobSystem, uint32_t count, uint32_t batchSize, const Function_T& function);
+
+            void Sort(JobSystem& jobSystem);
+            void Sort();
+            void Execute();
+            void Reset();
+
+            [[nodiscard]] CommandBuffer& GetBuffer(uint32_t index);
+            [[nodiscard]] uint32_t GetBufferCount() const;
+            [[nodiscard]] std::size_t GetSize() const;
+            [[nodiscard]] const Statistics& GetStatistics() const;
+
+            [[nodiscard]] static uint64_t MakeKey(uint8_t layer, uint16_t program, uint16_t material, float depth);
+        private:
+            void mMerge();
+
+            std::vector<CommandBuffer> mBuffers;
+            std::vector<const Packet*> mMerged;
+            Statistics mStatistics;
+            bool mSorted;
+    };
+
+    template<typename Function_T>
+    void CommandQueue::Record(JobSystem& jobSystem, uint32_t count, uint32_t batchSize, const Function_T& function)
+    {
+        if (jobSystem.GetThreadCount() > mBuffers.size()) {
+            throw CommandQueueException("Not enough command buffers for every worker thread.");
+        }
+
+        mSorted = false;
+        jobSystem.ParallelFor(count, batchSize, [this, &function](uint32_t begin, uint32_t end, uint32_t workerIndex) {
+            CommandBuffer& buffer = mBuffers[workerIndex];
+            for (uint32_t i = begin; i < end; i++)
+            {
+                // Which worker records an item changes from run to run, so the
+                // item index is what orders packets with equal keys.
+                buffer.mSequence = i;
+                function(i, buffer);
+            }
+            buffer.mSequence = 0;
+        });
+    }
+}
+
+#endif // RENDER_COMMAND_QUEUE_HPP
@@ -0,0 +1,125 @@
+#ifndef RENDER_CULLING_HPP
+#define RENDER_CULLING_HPP
+
+#include "Frustum.hpp"
+#include "TIMGE/Exception.hpp"
+#include "TIMGE/JobSystem.hpp"
+#include "TIMGE/Utils/Vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace TIMGE::Render
+{
+    class CullingException : public Exception
+    {
+        public:
+            CullingException(std::string message);
+    };
+
+    struct SphereBounds
+    {
+        std::vector<float> mX;
+        std::vector<float> mY;
+        std::vector<float> mZ;
+        std::vector<float> mRadius;
+
+        void Add(const std::array<float, 3>& center, float radius);
+        void Clear();
+        [[nodiscard]] std::size_t GetSize() const;
+    };
+
+    struct BoxBounds
+    {
+        std::vector<float> mMinX;
+        std::vector<float> mMinY;
+        std::vector<float> mMinZ;
+        std::vector<float> mMaxX;
+        std::vector<float> mMaxY;
+        std::vector<float> mMaxZ;
+
+        void Add(const std::array<float, 3>& min, const std::array<float, 3>& max);
+        void Clear();
+        [[nodiscard]] std::size_t GetSize() const;
+    };
+
+    class OcclusionBuffer
+    {
+        public:
+            OcclusionBuffer(uint32_t width = 256, uint32_t height = 128);
+
+            void Begin(const Mat4& viewProjection);
+            void AddOccluder(const std::array<float, 3>& min, const std::array<float, 3>& max);
+            void AddOccluder(std::span<const std::array<float, 3>> vertices, std::span<const uint32_t> indices);
+            void Rasterize(JobSystem& jobSystem);
+
+            [[nodiscard]] bool IsOccluded(const std::array<float, 3>& min, const std::array<float, 3>& max) const;
+            [[nodiscard]] const V2ui32& GetSize() const;
+            [[nodiscard]] std::size_t GetLevelCount() const;
+            [[nodiscard]] const std::vector<float>& GetLevel(std::size_t level) const;
+            [[nodiscard]] std::size_t GetTriangleCount() const;
+        private:
+            struct Triangle
+            {
+                std::array<float, 3> mX;
+                std::array<float, 3> mY;
+                std::array<float, 3> mZ;
+                bool mValid;
+            };
+
+            struct Level
+            {
+                uint32_t mWidth;
+                uint32_t mHeight;
+                std::vector<float> mDepth;
+            };
+
+            static constexpr uint32_t mBAND_HEIGHT = 8;
+            static constexpr float mNEAR_W = 1.0E-4f;
+
+            [[nodiscard]] std::array<float, 4> mProject(const std::array<float, 3>& point) const;
+            void mSetup(uint32_t triangle);
+            void mRasterizeBand(uint32_t band);
+            void mBuildHierarchy();
+
+            V2ui32 mSize;
+            Mat4 mViewProjection;
+            std::vector<std::array<float, 3>> mVertices;
+            std::vector<uint32_t> mIndices;
+            std::vector<Triangle> mTriangles;
+            std::vector<Level> mLevels;
+            bool mRasterized;
+    };
+
+    class Culler
+    {
+        public:
+            struct Statistics
+            {
+                uint32_t mTested;
+                uint32_t mFrustumCulled;
+                uint32_t mOcclusionCulled;
+                uint32_t mVisible;
+            };
+
+            static constexpr std::size_t BATCH_SIZE = 8;
+
+            Culler();
+
+            // Both clear visible and fill it with the indices of the bounds
+            // that pass, in ascending order.
+            void CullSpheres(const Frustum& frustum, const SphereBounds& bounds, std::vector<uint32_t>& visible, const OcclusionBuffer* occlusion = nullptr);
+            void CullBoxes(const Frustum& frustum, const BoxBounds& bounds, std::vector<uint32_t>& visible, const OcclusionBuffer* occlusion = nullptr);
+            void NewFrame();
+
+            [[nodiscard]] const Statistics& GetStatistics() const;
+        private:
+            Statistics mStatistics;
+            Statistics mFrameStatistics;
+    };
+}
+
+#endif // RENDER_CULLING_HPP
@@ -0,0 +1,184 @@
+#ifndef RENDER_GRAPH_HPP
+#define RENDER_GRAPH_HPP
+
+#include "TIMGE/Exception.hpp"
+#include "TIMGE/Utils/Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace TIMGE::Render
+{
+    class GraphException : public Exception
+    {
+        public:
+            GraphException(std::string message);
+    };
+
+    enum class Access : uint8_t
+    {
+        SAMPLED,
+        ATTACHMENT,
+        STORAGE
+    };
+
+    struct TextureDesc
+    {
+        V2ui32 mSize;
+        GLenum mFormat;
+
+        [[nodiscard]] bool operator==(const TextureDesc& desc) const = default;
+    };
+
+    struct Resource
+    {
+        uint32_t mIndex = UINT32_MAX;
+
+        [[nodiscard]] bool IsNull() const;
+    };
+
+    class Graph
+    {
+        public:
+            class Builder
+            {
+                public:
+                    [[maybe_unused]] Resource Create(std::string name, const TextureDesc& desc);
+                    [[maybe_unused]] Resource Read(Resource resource, Access access = Access::SAMPLED);
+                    [[maybe_unused]] Resource Write(Resource resource, Access access = Access::ATTACHMENT);
+                    void SetSideEffect();
+                private:
+                    Builder(Graph& graph, uint32_t pass);
+
+                    Graph& mGraph;
+                    uint32_t mPass;
+
+                    friend class Graph;
+            };
+
+            class Context
+            {
+                public:
+                    [[nodiscard]] GLuint GetTexture(Resource resource) const;
+                    [[nodiscard]] const TextureDesc& GetDesc(Resource resource) const;
+                    [[nodiscard]] GLuint GetFramebuffer() const;
+                private:
+                    Context(const Graph& graph, GLuint framebuffer);
+
+                    const Graph& mGraph;
+                    GLuint mFramebuffer;
+
+                    friend class Graph;
+            };
+
+            using Setup_T = std::function<void(Builder& builder)>;
+            using Execute_T = std::function<void(const Context& context)>;
+
+            static constexpr uint32_t MAX_COLOR_ATTACHMENTS = 8;
+
+            Graph();
+            ~Graph();
+
+            Graph(const Graph&) = delete;
+            Graph& operator=(const Graph&) = delete;
+
+            [[maybe_unused]] Resource Import(std::string name, GLuint texture, const TextureDesc& desc);
+            [[maybe_unused]] Resource ImportBackbuffer(const V2ui32& size);
+            void AddPass(std::string name, const Setup_T& setup, Execute_T execute);
+
+            void Compile();
+            void Execute();
+            void Reset();
+            void ReleaseResources();
+
+            [[nodiscard]] std::size_t GetPassCount() const;
+            [[nodiscard]] std::size_t GetCulledPassCount() const;
+            [[nodiscard]] uint64_t GetTransientBytes() const;
+            [[nodiscard]] uint64_t GetAllocatedBytes() const;
+            [[nodiscard]] uint32_t GetFramebufferSwitches() const;
+            [[nodiscard]] std::string Dump() const;
+
+            [[nodiscard]] static uint32_t GetBytesPerPixel(GLenum format);
+        private:
+            static constexpr uint32_t mNONE = UINT32_MAX;
+
+            struct Use
+            {
+                uint32_t mResource;
+                Access mAccess;
+                bool mWrite;
+            };
+
+            struct Pass
+            {
+                std::string mName;
+                Execute_T mExecute;
+                std::vector<Use> mUses;
+                std::vector<uint32_t> mDependencies;
+                std::vector<uint32_t> mProducers;
+                std::vector<uint32_t> mAttachments;
+                GLbitfield mBarrier;
+                bool mSideEffect;
+                bool mLive;
+            };
+
+            struct VirtualResource
+            {
+                std::string mName;
+                TextureDesc mDesc;
+                GLuint mImported;
+                bool mTransient;
+                bool mBackbuffer;
+                uint32_t mFirstUse;
+                uint32_t mLastUse;
+                uint32_t mPhysical;
+            };
+
+            struct PhysicalTexture
+            {
+                TextureDesc mDesc;
+                uint32_t mFreeAfter;
+                GLuint mTexture;
+            };
+
+            struct PooledTexture
+            {
+                TextureDesc mDesc;
+                GLuint mTexture;
+                bool mTaken;
+            };
+
+            [[nodiscard]] uint32_t mAddResource(VirtualResource&& resource);
+            void mUse(uint32_t pass, Resource resource, Access access, bool write);
+            void mLink();
+            void mCull();
+            void mSchedule();
+            void mAlias();
+            void mPlaceBarriers();
+            [[nodiscard]] GLuint mAcquireTexture(const TextureDesc& desc);
+            [[nodiscard]] GLuint mAcquireFramebuffer(const Pass& pass);
+            [[nodiscard]] GLuint mGetTexture(uint32_t resource) const;
+            [[nodiscard]] static uint32_t mCountSwitches(const std::vector<const Pass*>& passes);
+
+            std::vector<Pass> mPasses;
+            std::vector<VirtualResource> mResources;
+            std::vector<uint32_t> mOrder;
+            std::vector<PhysicalTexture> mPhysical;
+            std::vector<GLuint> mPhysicalTextures;
+
+            std::vector<PooledTexture> mPool;
+            std::map<std::vector<GLuint>, GLuint> mFramebuffers;
+
+            uint32_t mFramebufferSwitches;
+            uint32_t mDeclaredSwitches;
+            bool mCompiled;
+    };
+}
+
+#endif // RENDER_GRAPH_HPP
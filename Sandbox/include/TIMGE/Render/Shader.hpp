@@ -0,0 +1,53 @@
+#ifndef RENDER_SHADER_HPP
+#define RENDER_SHADER_HPP
+
+#include "TIMGE/Exception.hpp"
+
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+#include <glad/glad.h>
+
+namespace TIMGE::Render
+{
+    class ShaderException : public Exception
+    {
+        public:
+            ShaderException(std::string message);
+    };
+
+    class Shader
+    {
+        public:
+            struct Stage
+            {
+                GLenum mType;
+                std::string_view mSource;
+            };
+
+            struct Attribute
+            {
+                GLuint mLocation;
+                const char* mName;
+            };
+
+            Shader(std::initializer_list<Stage> stages, std::initializer_list<Attribute> attributes = {});
+            Shader(Shader&& shader) noexcept;
+            ~Shader();
+
+            Shader(const Shader&) = delete;
+            Shader& operator=(const Shader&) = delete;
+
+            void Use() const;
+
+            [[nodiscard]] GLuint GetProgram() const;
+            [[nodiscard]] GLint GetUniformLocation(const char* name) const;
+        private:
+            [[nodiscard]] static GLuint mCompile(const Stage& stage);
+
+            GLuint mProgram;
+    };
+}
+
+#endif // RENDER_SHADER_HPP
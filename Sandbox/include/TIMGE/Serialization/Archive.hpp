@@ -0,0 +1,332 @@
+#ifndef SERIALIZATION_ARCHIVE_HPP
+#define SERIALIZATION_ARCHIVE_HPP
+
+#include "TIMGE/Exception.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace TIMGE::Serialization
+{
+    static_assert(std::endian::native == std::endian::little, "Archives are read in place and are always little endian.");
+
+    class SerializationException : public Exception
+    {
+        public:
+            SerializationException(std::string message);
+    };
+
+    template<typename Type_T>
+    concept Storable = std::is_trivially_copyable_v<Type_T> && std::is_standard_layout_v<Type_T>;
+
+    // Distance in bytes from the offset itself to its target, so archives
+    // need no fix-up pass after being mapped. Zero means null.
+    template<typename Type_T>
+    struct Offset
+    {
+        int32_t mOffset;
+
+        [[nodiscard]] const Type_T* Get() const;
+        [[nodiscard]] bool IsNull() const;
+    };
+
+    template<typename Type_T>
+    struct Array
+    {
+        Offset<Type_T> mData;
+        uint32_t mCount;
+
+        [[nodiscard]] std::span<const Type_T> Get() const;
+        [[nodiscard]] std::string_view GetString() const requires std::same_as<Type_T, char>;
+        [[nodiscard]] uint32_t GetSize() const;
+    };
+
+    using String = Array<char>;
+
+    struct Header
+    {
+        std::array<char, 4> mMagic;
+        uint16_t mFormatVersion;
+        uint16_t mSchemaVersion;
+        uint64_t mSize;
+        uint32_t mRoot;
+        uint32_t mReserved;
+    };
+
+    // Positions of data already written, used to link later records to it.
+    template<typename Type_T>
+    struct Ref
+    {
+        uint32_t mPosition;
+    };
+
+    template<typename Type_T>
+    struct ArrayRef
+    {
+        uint32_t mPosition;
+        uint32_t mCount;
+    };
+
+    class Writer;
+
+    // Records are built here and written in one go. Their position is fixed
+    // when they are prepared, which is what lets Link compute relative offsets.
+    template<typename Type_T>
+    class Pending
+    {
+        public:
+            [[nodiscard]] Type_T& operator[](std::size_t index);
+            [[nodiscard]] std::size_t GetSize() const;
+
+            template<typename Target_T>
+            void Link(std::size_t index, Offset<Target_T> Type_T::* member, Ref<Target_T> target);
+            template<typename Target_T>
+            void Link(std::size_t index, Array<Target_T> Type_T::* member, ArrayRef<Target_T> target);
+        private:
+            Pending(uint32_t position, std::size_t count);
+
+            template<typename Field_T>
+            [[nodiscard]] int32_t mRelative(std::size_t index, Field_T Type_T::* member, uint32_t target) const;
+
+            uint32_t mPosition;
+            std::vector<Type_T> mValues;
+
+            friend class Writer;
+    };
+
+    // Streams records straight to the file. Everything a record points at has
+    // to be written before it, so archives are written leaves first and only
+    // the header is patched at the end.
+    class Writer
+    {
+        public:
+            static constexpr std::array<char, 4> MAGIC = { 'T', 'I', 'M', 'G' };
+            static constexpr uint16_t FORMAT_VERSION = 1;
+
+            Writer(const std::filesystem::path& path, uint16_t schemaVersion);
+
+            Writer(const Writer&) = delete;
+            Writer& operator=(const Writer&) = delete;
+
+            template<Storable Type_T>
+            [[nodiscard]] Pending<Type_T> Prepare(std::size_t count = 1);
+            template<Storable Type_T>
+            [[maybe_unused]] ArrayRef<Type_T> Write(const Pending<Type_T>& pending);
+
+            template<Storable Type_T>
+            [[maybe_unused]] Ref<Type_T> Write(const Type_T& value);
+            template<Storable Type_T>
+            [[maybe_unused]] ArrayRef<Type_T> Write(std::span<const Type_T> values);
+            [[maybe_unused]] ArrayRef<char> WriteString(std::string_view string);
+
+            // Streams an array piece by piece through Append instead of gathering
+            // it first; EndArray checks that exactly count elements arrived.
+            template<Storable Type_T>
+            [[nodiscard]] ArrayRef<Type_T> BeginArray(uint32_t count, std::size_t alignment = alignof(Type_T));
+            void Append(const void* data, std::size_t size);
+            template<Storable Type_T>
+            void EndArray(ArrayRef<Type_T> array);
+
+            template<Storable Root_T>
+            void Finish(Ref<Root_T> root);
+
+            [[nodiscard]] uint32_t GetPosition() const;
+        private:
+            [[nodiscard]] uint32_t mAlign(std::size_t alignment);
+            void mWrite(const void* data, std::size_t size);
+
+            std::ofstream mStream;
+            uint64_t mPosition;
+            uint16_t mSchemaVersion;
+            bool mFinished;
+    };
+
+    // Maps an archive read-only and hands out its root in place.
+    class Archive
+    {
+        public:
+            Archive(const std::filesystem::path& path);
+            ~Archive();
+
+            Archive(const Archive&) = delete;
+            Archive& operator=(const Archive&) = delete;
+
+            template<Storable Root_T>
+            [[nodiscard]] const Root_T& GetRoot() const;
+
+            // True when [data, data + size) lies inside the archive, for callers
+            // that do not trust the file they were given.
+            [[nodiscard]] bool Contains(const void* data, std::size_t size) const;
+            [[nodiscard]] const Header& GetHeader() const;
+            [[nodiscard]] uint16_t GetSchemaVersion() const;
+            [[nodiscard]] std::size_t GetSize() const;
+        private:
+            const std::byte* mData;
+            std::size_t mSize;
+            std::vector<std::byte> mBuffer;
+    };
+
+    template<typename Type_T>
+    [[nodiscard]] const Type_T* Offset<Type_T>::Get() const
+    {
+        if (mOffset == 0) {
+            return nullptr;
+        }
+        return reinterpret_cast<const Type_T*>(reinterpret_cast<const std::byte*>(this) + mOffset);
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] bool Offset<Type_T>::IsNull() const {
+        return mOffset == 0;
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] std::span<const Type_T> Array<Type_T>::Get() const
+    {
+        if (mCount == 0) {
+            return {};
+        }
+        return { mData.Get(), mCount };
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] std::string_view Array<Type_T>::GetString() const requires std::same_as<Type_T, char>
+    {
+        if (mCount == 0) {
+            return {};
+        }
+        return { mData.Get(), mCount };
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] uint32_t Array<Type_T>::GetSize() const {
+        return mCount;
+    }
+
+    template<typename Type_T>
+    Pending<Type_T>::Pending(uint32_t position, std::size_t count)
+     : mPosition{position},
+       mValues(count)
+    {}
+
+    template<typename Type_T>
+    [[nodiscard]] Type_T& Pending<Type_T>::operator[](std::size_t index) {
+        return mValues.at(index);
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] std::size_t Pending<Type_T>::GetSize() const {
+        return mValues.size();
+    }
+
+    template<typename Type_T>
+    template<typename Target_T>
+    void Pending<Type_T>::Link(std::size_t index, Offset<Target_T> Type_T::* member, Ref<Target_T> target) {
+        (mValues.at(index).*member).mOffset = mRelative(index, member, target.mPosition);
+    }
+
+    template<typename Type_T>
+    template<typename Target_T>
+    void Pending<Type_T>::Link(std::size_t index, Array<Target_T> Type_T::* member, ArrayRef<Target_T> target)
+    {
+        Array<Target_T>& array = mValues.at(index).*member;
+        array.mData.mOffset = target.mCount == 0 ? 0 : mRelative(index, member, target.mPosition);
+        array.mCount = target.mCount;
+    }
+
+    template<typename Type_T>
+    template<typename Field_T>
+    [[nodiscard]] int32_t Pending<Type_T>::mRelative(std::size_t index, Field_T Type_T::* member, uint32_t target) const
+    {
+        const Type_T& value = mValues[index];
+        std::size_t field = static_cast<std::size_t>(reinterpret_cast<const std::byte*>(&(value.*member)) - reinterpret_cast<const std::byte*>(&value));
+        int64_t position = static_cast<int64_t>(mPosition) + static_cast<int64_t>(index * sizeof(Type_T) + field);
+
+        return static_cast<int32_t>(static_cast<int64_t>(target) - position);
+    }
+
+    template<Storable Type_T>
+    [[nodiscard]] Pending<Type_T> Writer::Prepare(std::size_t count) {
+        return Pending<Type_T>(mAlign(alignof(Type_T)), count);
+    }
+
+    template<Storable Type_T>
+    [[maybe_unused]] ArrayRef<Type_T> Writer::Write(const Pending<Type_T>& pending)
+    {
+        if (mAlign(alignof(Type_T)) != pending.mPosition) {
+            throw SerializationException("Something was written between preparing a record and writing it.");
+        }
+
+        mWrite(pending.mValues.data(), pending.mValues.size() * sizeof(Type_T));
+        return { pending.mPosition, static_cast<uint32_t>(pending.mValues.size()) };
+    }
+
+    template<Storable Type_T>
+    [[maybe_unused]] Ref<Type_T> Writer::Write(const Type_T& value)
+    {
+        uint32_t position = mAlign(alignof(Type_T));
+        mWrite(&value, sizeof(Type_T));
+        return { position };
+    }
+
+    template<Storable Type_T>
+    [[maybe_unused]] ArrayRef<Type_T> Writer::Write(std::span<const Type_T> values)
+    {
+        uint32_t position = mAlign(alignof(Type_T));
+        mWrite(values.data(), values.size_bytes());
+        return { position, static_cast<uint32_t>(values.size()) };
+    }
+
+    template<Storable Type_T>
+    [[nodiscard]] ArrayRef<Type_T> Writer::BeginArray(uint32_t count, std::size_t alignment) {
+        return { mAlign(std::max(alignment, alignof(Type_T))), count };
+    }
+
+    template<Storable Type_T>
+    void Writer::EndArray(ArrayRef<Type_T> array)
+    {
+        if (mPosition != array.mPosition + static_cast<uint64_t>(array.mCount) * sizeof(Type_T)) {
+            throw SerializationException("Streamed array size doesn't match its count.");
+        }
+    }
+
+    template<Storable Root_T>
+    void Writer::Finish(Ref<Root_T> root)
+    {
+        if (mFinished) {
+            throw SerializationException("The archive has already been finished.");
+        }
+
+        Header header{ MAGIC, FORMAT_VERSION, mSchemaVersion, mPosition, root.mPosition, 0 };
+        mStream.seekp(0);
+        mStream.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        mStream.flush();
+
+        if (!mStream) {
+            throw SerializationException("Failed to write the archive header.");
+        }
+        mFinished = true;
+    }
+
+    template<Storable Root_T>
+    [[nodiscard]] const Root_T& Archive::GetRoot() const
+    {
+        const Header& header = GetHeader();
+        if (header.mRoot % alignof(Root_T) != 0 || !Contains(mData + header.mRoot, sizeof(Root_T))) {
+            throw SerializationException("The archive root is out of bounds.");
+        }
+        return *reinterpret_cast<const Root_T*>(mData + header.mRoot);
+    }
+}
+
+#endif // SERIALIZATION_ARCHIVE_HPP
@@ -0,0 +1,157 @@
+#ifndef SERIALIZATION_SCENE_HPP
+#define SERIALIZATION_SCENE_HPP
+
+#include "Archive.hpp"
+#include "TIMGE/ECS/World.hpp"
+#include "TIMGE/Window.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace TIMGE::Serialization
+{
+    struct WindowSettings
+    {
+        String mTitle;
+        uint32_t mSize[2];
+        uint32_t mSizeLimits[4];
+        int32_t mPosition[2];
+        uint32_t mAspectRatio[2];
+        float mOpacity;
+        uint32_t mOpenGLVersion[2];
+        uint32_t mFlags;
+    };
+
+    enum class ResourceType : uint32_t
+    {
+        IMAGE,
+        FONT,
+        SHADER,
+        OTHER
+    };
+
+    struct ResourceReference
+    {
+        String mPath;
+        ResourceType mType;
+    };
+
+    struct Resource
+    {
+        std::string_view mPath;
+        ResourceType mType;
+    };
+
+    // One component type across every archetype holding it. mEntities are
+    // indices into the scene's entities, mData their tightly packed values.
+    struct ComponentColumn
+    {
+        String mName;
+        uint32_t mSize;
+        uint32_t mAlignment;
+        Array<uint32_t> mEntities;
+        Array<std::byte> mData;
+    };
+
+    struct Scene
+    {
+        static constexpr uint16_t VERSION = 1;
+
+        Offset<WindowSettings> mWindow;
+        Array<ResourceReference> mResources;
+        uint32_t mEntityCount;
+        Array<ComponentColumn> mComponents;
+    };
+
+    // Component ids depend on registration order, so archives name their
+    // columns instead. Only registered components are saved and loaded.
+    class ComponentRegistry
+    {
+        public:
+            struct Entry
+            {
+                std::string mName;
+                ECS::ComponentID mId;
+                uint32_t mSize;
+                uint32_t mAlignment;
+                void (*mAdd)(ECS::World& world, ECS::Entity entity, const void* data);
+            };
+
+            template<typename Type_T>
+            void Register(std::string name);
+
+            [[nodiscard]] const Entry* Find(std::string_view name) const;
+            [[nodiscard]] const Entry* Find(ECS::ComponentID id) const;
+            [[nodiscard]] const std::vector<Entry>& GetEntries() const;
+        private:
+            std::vector<Entry> mEntries;
+    };
+
+    class SceneWriter
+    {
+        public:
+            SceneWriter(const std::filesystem::path& path);
+
+            void WriteWindow(const Window::Info& info);
+            void AddResource(std::string_view path, ResourceType type);
+            // Saves the entities holding at least one registered component.
+            void WriteWorld(const ECS::World& world, const ComponentRegistry& registry);
+            void Finish();
+        private:
+            struct Column
+            {
+                ArrayRef<char> mName;
+                uint32_t mSize;
+                uint32_t mAlignment;
+                ArrayRef<uint32_t> mEntities;
+                ArrayRef<std::byte> mData;
+            };
+
+            Writer mWriter;
+            Ref<WindowSettings> mWindow;
+            std::vector<std::pair<ArrayRef<char>, ResourceType>> mResources;
+            uint32_t mEntityCount;
+            std::vector<Column> mColumns;
+            bool mWorldWritten;
+    };
+
+    // Checks the schema version and returns the scene in place.
+    [[nodiscard]] const Scene& GetScene(const Archive& archive);
+
+    // Recreates the saved entities in world, in their saved order. Columns of
+    // components missing from registry are skipped. The whole archive is
+    // validated before anything is added to world.
+    [[maybe_unused]] std::vector<ECS::Entity> LoadWorld(const Archive& archive, ECS::World& world, const ComponentRegistry& registry);
+
+    // Paths point into the archive, which has to outlive the result.
+    [[nodiscard]] std::vector<Resource> LoadResources(const Archive& archive);
+
+    // Empty when no window settings were written. The title points into the
+    // archive, which has to outlive the result.
+    [[nodiscard]] std::optional<Window::Info> LoadWindow(const Archive& archive);
+
+    template<typename Type_T>
+    void ComponentRegistry::Register(std::string name)
+    {
+        static_assert(std::is_trivially_copyable_v<Type_T>, "Only trivially copyable components can be serialized.");
+
+        ECS::ComponentID id = ECS::Component::GetID<Type_T>();
+        if (Find(name) != nullptr || Find(id) != nullptr) {
+            throw SerializationException(std::format("Component \"{}\" is already registered!", name));
+        }
+
+        mEntries.push_back({ std::move(name), id, sizeof(Type_T), alignof(Type_T), [](ECS::World& world, ECS::Entity entity, const void* data) {
+            world.AddComponent<Type_T>(entity, *static_cast<const Type_T*>(data));
+        }});
+    }
+}
+
+#endif // SERIALIZATION_SCENE_HPP
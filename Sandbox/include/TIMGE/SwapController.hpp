@@ -0,0 +1,75 @@
+#ifndef SWAP_CONTROLLER_HPP
+#define SWAP_CONTROLLER_HPP
+
+#include "Exception.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace TIMGE
+{
+    class Window;
+    class Monitor;
+
+    class SwapControllerException : public Exception
+    {
+        public:
+            SwapControllerException(std::string message);
+    };
+
+    class SwapController
+    {
+        public:
+            enum class Strategy : uint8_t
+            {
+                IMMEDIATE,
+                VSYNC,
+                ADAPTIVE,
+                HALF_RATE,
+                LATENCY_OPTIMIZED,
+                COUNT
+            };
+
+            static constexpr std::size_t WINDOW_SIZE = 64;
+            static constexpr uint32_t EVALUATION_INTERVAL = 30;
+
+            SwapController(Window& window, const Monitor& monitor);
+
+            void SetStrategy(Strategy strategy);
+            void SetAutomatic(bool automatic);
+
+            void OnFrameEnd(double workTime);
+
+            [[nodiscard]] Strategy GetStrategy() const;
+            [[nodiscard]] bool IsAutomatic() const;
+            [[nodiscard]] double GetRefreshPeriod() const;
+            [[nodiscard]] double GetWorkTime() const;
+            [[nodiscard]] double GetFrameDelay() const;
+
+            [[nodiscard]] static std::string_view GetName(Strategy strategy);
+        private:
+            void mApply(Strategy strategy);
+            [[nodiscard]] Strategy mSelect() const;
+            [[nodiscard]] double mPercentile(double fraction) const;
+
+            Window& mWindow;
+            const Monitor& mMonitor;
+
+            std::array<double, WINDOW_SIZE> mSamples;
+            std::size_t mSampleCount;
+            std::size_t mNextSample;
+            uint32_t mFramesSinceEvaluation;
+
+            Strategy mStrategy;
+            Strategy mCandidate;
+            bool mAutomatic;
+            double mFrameDelay;
+
+            static constexpr double mDEFAULT_REFRESH_RATE = 60.0;
+            static constexpr double mSLEEP_MARGIN = 0.0015;
+    };
+}
+
+#endif // SWAP_CONTROLLER_HPP
@@ -6,7 +6,32 @@
 #include "Mouse.hpp"
 #include "Monitor.hpp"
 #include "Keyboard.hpp"
+#include "Gamepad.hpp"
 #include "Callback.hpp"
+#include "Config.hpp"
+#include "EventBus.hpp"
+#include "Events.hpp"
+#include "HotReloader.hpp"
+#include "JobSystem.hpp"
+#include "ResolutionScaler.hpp"
+#include "SwapController.hpp"
+#include "ECS/World.hpp"
+#include "ECS/Scheduler.hpp"
+#include "Collision/AABBTree.hpp"
+#include "Collision/SpatialHash.hpp"
+#include "Input/ActionMap.hpp"
+#include "Input/LatencyTracker.hpp"
+#include "Input/Recorder.hpp"
+#include "Input/Replayer.hpp"
+#include "Physics/World.hpp"
+#include "Render/CommandQueue.hpp"
+#include "Render/Culling.hpp"
+#include "Render/Graph.hpp"
+#include "Render/IndirectRenderer.hpp"
+#include "Render/Particles.hpp"
+#include "Render/TextRenderer.hpp"
+#include "Serialization/Archive.hpp"
+#include "Serialization/Scene.hpp"
 #include "Utils/Vector.hpp"
 
 #endif //TIMGE_HPP
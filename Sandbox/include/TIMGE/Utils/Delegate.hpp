@@ -0,0 +1,214 @@
+#ifndef UTILS_DELEGATE_HPP
+#define UTILS_DELEGATE_HPP
+
+#include "TIMGE/Exception.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace TIMGE
+{
+    class DelegateException : public Exception
+    {
+        public:
+            DelegateException(std::string message);
+    };
+
+    template<typename Signature_T, std::size_t CAPACITY = 4 * sizeof(void*)> class Delegate;
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    class Delegate<Return_T(Args_T...), CAPACITY>
+    {
+        public:
+            Delegate();
+            Delegate(std::nullptr_t);
+            Delegate(const Delegate& delegate);
+            Delegate(Delegate&& delegate) noexcept;
+            ~Delegate();
+
+            template<typename Function_T>
+            requires (!std::is_same_v<std::remove_cvref_t<Function_T>, Delegate<Return_T(Args_T...), CAPACITY>> && std::is_invocable_r_v<Return_T, std::decay_t<Function_T>&, Args_T...>)
+            Delegate(Function_T&& function);
+
+            [[maybe_unused]] Delegate& operator=(const Delegate& delegate);
+            [[maybe_unused]] Delegate& operator=(Delegate&& delegate) noexcept;
+
+            Return_T operator()(Args_T... args) const;
+            [[nodiscard]] explicit operator bool() const;
+
+            void Reset();
+        private:
+            enum class Operation
+            {
+                COPY,
+                MOVE,
+                DESTROY
+            };
+
+            using Invoke_T = Return_T (*)(void* storage, Args_T&&... args);
+            using Manage_T = void (*)(Operation operation, void* destination, void* source);
+
+            void mAssign(const Delegate& delegate);
+            void mAssign(Delegate&& delegate);
+
+            alignas(std::max_align_t) mutable std::array<std::byte, CAPACITY> mStorage;
+            Invoke_T mInvoke;
+            Manage_T mManage;
+    };
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    Delegate<Return_T(Args_T...), CAPACITY>::Delegate()
+     : mStorage{},
+       mInvoke{nullptr},
+       mManage{nullptr}
+    {}
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    Delegate<Return_T(Args_T...), CAPACITY>::Delegate(std::nullptr_t)
+     : Delegate()
+    {}
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    Delegate<Return_T(Args_T...), CAPACITY>::Delegate(const Delegate& delegate)
+     : Delegate()
+    {
+        mAssign(delegate);
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    Delegate<Return_T(Args_T...), CAPACITY>::Delegate(Delegate&& delegate) noexcept
+     : Delegate()
+    {
+        mAssign(std::move(delegate));
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    Delegate<Return_T(Args_T...), CAPACITY>::~Delegate() {
+        Reset();
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    template<typename Function_T>
+    requires (!std::is_same_v<std::remove_cvref_t<Function_T>, Delegate<Return_T(Args_T...), CAPACITY>> && std::is_invocable_r_v<Return_T, std::decay_t<Function_T>&, Args_T...>)
+    Delegate<Return_T(Args_T...), CAPACITY>::Delegate(Function_T&& function)
+     : Delegate()
+    {
+        using Callable_T = std::decay_t<Function_T>;
+
+        static_assert(sizeof(Callable_T) <= CAPACITY, "Callable does not fit the delegate storage, capture less or raise CAPACITY.");
+        static_assert(alignof(Callable_T) <= alignof(std::max_align_t), "Callable is over-aligned for delegate storage.");
+        static_assert(std::is_nothrow_move_constructible_v<Callable_T>, "Delegates require nothrow move constructible callables.");
+
+        if constexpr (std::is_pointer_v<Callable_T> || std::is_member_pointer_v<Callable_T>)
+        {
+            if (function == nullptr) {
+                return;
+            }
+        }
+
+        new (mStorage.data()) Callable_T(std::forward<Function_T>(function));
+
+        mInvoke = [](void* storage, Args_T&&... args) -> Return_T {
+            return std::invoke(*static_cast<Callable_T*>(storage), std::forward<Args_T>(args)...);
+        };
+
+        if constexpr (!std::is_trivially_copyable_v<Callable_T> || !std::is_trivially_destructible_v<Callable_T>)
+        {
+            mManage = [](Operation operation, void* destination, void* source) {
+                switch (operation)
+                {
+                    case Operation::COPY:
+                        new (destination) Callable_T(*static_cast<const Callable_T*>(source));
+                        break;
+                    case Operation::MOVE:
+                        new (destination) Callable_T(std::move(*static_cast<Callable_T*>(source)));
+                        static_cast<Callable_T*>(source)->~Callable_T();
+                        break;
+                    case Operation::DESTROY:
+                        static_cast<Callable_T*>(destination)->~Callable_T();
+                        break;
+                }
+            };
+        }
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    [[maybe_unused]] Delegate<Return_T(Args_T...), CAPACITY>& Delegate<Return_T(Args_T...), CAPACITY>::operator=(const Delegate& delegate)
+    {
+        if (this != &delegate)
+        {
+            Reset();
+            mAssign(delegate);
+        }
+        return *this;
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    [[maybe_unused]] Delegate<Return_T(Args_T...), CAPACITY>& Delegate<Return_T(Args_T...), CAPACITY>::operator=(Delegate&& delegate) noexcept
+    {
+        if (this != &delegate)
+        {
+            Reset();
+            mAssign(std::move(delegate));
+        }
+        return *this;
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    Return_T Delegate<Return_T(Args_T...), CAPACITY>::operator()(Args_T... args) const
+    {
+        if (mInvoke == nullptr) {
+            throw DelegateException("Cannot invoke an empty delegate.");
+        }
+        return mInvoke(mStorage.data(), std::forward<Args_T>(args)...);
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    [[nodiscard]] Delegate<Return_T(Args_T...), CAPACITY>::operator bool() const {
+        return mInvoke != nullptr;
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    void Delegate<Return_T(Args_T...), CAPACITY>::Reset()
+    {
+        if (mManage != nullptr) {
+            mManage(Operation::DESTROY, mStorage.data(), nullptr);
+        }
+        mInvoke = nullptr;
+        mManage = nullptr;
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    void Delegate<Return_T(Args_T...), CAPACITY>::mAssign(const Delegate& delegate)
+    {
+        if (delegate.mManage != nullptr) {
+            delegate.mManage(Operation::COPY, mStorage.data(), delegate.mStorage.data());
+        } else {
+            std::memcpy(mStorage.data(), delegate.mStorage.data(), CAPACITY);
+        }
+        mInvoke = delegate.mInvoke;
+        mManage = delegate.mManage;
+    }
+
+    template<typename Return_T, typename... Args_T, std::size_t CAPACITY>
+    void Delegate<Return_T(Args_T...), CAPACITY>::mAssign(Delegate&& delegate)
+    {
+        if (delegate.mManage != nullptr) {
+            delegate.mManage(Operation::MOVE, mStorage.data(), delegate.mStorage.data());
+        } else {
+            std::memcpy(mStorage.data(), delegate.mStorage.data(), CAPACITY);
+        }
+        mInvoke = delegate.mInvoke;
+        mManage = delegate.mManage;
+
+        delegate.mInvoke = nullptr;
+        delegate.mManage = nullptr;
+    }
+}
+
+#endif // UTILS_DELEGATE_HPP
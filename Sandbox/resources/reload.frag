@@ -0,0 +1,11 @@
+// Edit while the Sandbox runs with "Watch resources/reload.frag" enabled. The
+// #version line is prepended on load, and a version that fails to compile
+// leaves the previous program on screen.
+in vec2 vPosition;
+uniform float uTime;
+out vec4 oColor;
+
+void main()
+{
+    oColor = vec4(vPosition, 0.5 + 0.5 * sin(uTime), 1.0);
+}
@@ -0,0 +1,629 @@
+#include "Benchmarks.hpp"
+
+#include <TIMGE/Collision/AABBTree.hpp>
+#include <TIMGE/Collision/SpatialHash.hpp>
+#include <TIMGE/ECS/Scheduler.hpp>
+#include <TIMGE/ECS/World.hpp>
+#include <TIMGE/Physics/World.hpp>
+#include <TIMGE/Render/CommandQueue.hpp>
+#include <TIMGE/Render/Particles.hpp>
+#include <TIMGE/Render/Shader.hpp>
+#include <TIMGE/Serialization/Scene.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <random>
+
+#include <glad/glad.h>
+
+namespace
+{
+    struct Position
+    {
+        float mX;
+        float mY;
+    };
+
+    struct Velocity
+    {
+        float mX;
+        float mY;
+    };
+
+    struct Age
+    {
+        float mSeconds;
+    };
+
+    template<typename Function_T>
+    BenchmarkResult Measure(std::string name, std::size_t items, Function_T&& function)
+    {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        return { std::move(name), milliseconds, items / (milliseconds * 1.0E-3) };
+    }
+
+    struct MovingBox
+    {
+        TIMGE::Collision::AABB mBounds;
+        TIMGE::V2f mVelocity;
+    };
+
+    std::vector<MovingBox> GenerateBoxes(std::size_t count)
+    {
+        std::mt19937 random(1337);
+        float extent = std::sqrt(static_cast<float>(count)) * 4.0f;
+        std::uniform_real_distribution<float> position(0.0f, extent);
+        std::uniform_real_distribution<float> size(0.5f, 1.5f);
+        std::uniform_real_distribution<float> velocity(-0.25f, 0.25f);
+
+        std::vector<MovingBox> boxes(count);
+        for (MovingBox& box : boxes)
+        {
+            TIMGE::V2f min{ position(random), position(random) };
+            box.mBounds = { min, min + TIMGE::V2f{ size(random), size(random) } };
+            box.mVelocity = { velocity(random), velocity(random) };
+        }
+
+        return boxes;
+    }
+
+    void StepBoxes(std::vector<MovingBox>& boxes)
+    {
+        for (MovingBox& box : boxes)
+        {
+            box.mBounds.mMin += box.mVelocity;
+            box.mBounds.mMax += box.mVelocity;
+        }
+    }
+
+    template<typename Broadphase_T>
+    BenchmarkResult MeasureBroadphase(std::string name, Broadphase_T& broadphase, std::size_t count, std::size_t frames)
+    {
+        std::vector<MovingBox> boxes = GenerateBoxes(count);
+        std::vector<TIMGE::Collision::Proxy> proxies(count);
+        for (std::size_t i = 0; i < count; i++) {
+            proxies[i] = broadphase.CreateProxy(boxes[i].mBounds, static_cast<uint32_t>(i));
+        }
+
+        std::vector<TIMGE::Collision::Pair> pairs;
+        BenchmarkResult result = Measure(std::move(name), count * frames, [&]{
+            for (std::size_t frame = 0; frame < frames; frame++)
+            {
+                StepBoxes(boxes);
+                for (std::size_t i = 0; i < count; i++) {
+                    broadphase.MoveProxy(proxies[i], boxes[i].mBounds);
+                }
+
+                pairs.clear();
+                broadphase.FindPairs(pairs);
+            }
+        });
+
+        result.mName += std::format(" ({} pairs)", pairs.size());
+        result.mMilliseconds /= frames;
+        return result;
+    }
+
+    BenchmarkResult MeasureBruteForce(std::size_t count, std::size_t frames)
+    {
+        std::vector<MovingBox> boxes = GenerateBoxes(count);
+
+        std::vector<TIMGE::Collision::Pair> pairs;
+        BenchmarkResult result = Measure(std::format("Brute force x{}", count), count * frames, [&]{
+            for (std::size_t frame = 0; frame < frames; frame++)
+            {
+                StepBoxes(boxes);
+
+                pairs.clear();
+                for (std::size_t i = 0; i < count; i++) {
+                    for (std::size_t j = i + 1; j < count; j++) {
+                        if (boxes[i].mBounds.Overlaps(boxes[j].mBounds)) {
+                            pairs.push_back({ static_cast<uint32_t>(i), static_cast<uint32_t>(j) });
+                        }
+                    }
+                }
+            }
+        });
+
+        result.mName += std::format(" ({} pairs)", pairs.size());
+        result.mMilliseconds /= frames;
+        return result;
+    }
+
+    std::vector<TIMGE::Physics::Body> BuildPiles(TIMGE::Physics::World& world, std::size_t pileCount)
+    {
+        static constexpr std::size_t PILE_HEIGHT = 15;
+
+        std::vector<TIMGE::Physics::Body> bodies;
+
+        for (std::size_t pile = 0; pile < pileCount; pile++)
+        {
+            float x = static_cast<float>(pile) * 6.0f;
+            world.CreateBody({ TIMGE::Physics::BodyType::STATIC, TIMGE::Physics::Shape::Box(2.0f, 0.5f), { x, -0.5f }, 0.0f, {}, 0.0f, 1.0f, 0.6f, 0.0f });
+
+            for (std::size_t i = 0; i < PILE_HEIGHT; i++)
+            {
+                TIMGE::Physics::Shape shape = i % 2 == 0 ? TIMGE::Physics::Shape::Box(0.5f, 0.5f) : TIMGE::Physics::Shape::Circle(0.45f);
+                float offset = (i % 3) * 0.1f - 0.1f;
+                bodies.push_back(world.CreateBody({ TIMGE::Physics::BodyType::DYNAMIC, shape, { x + offset, 0.5f + i * 1.05f }, 0.0f, {}, 0.0f, 1.0f, 0.6f, 0.0f }));
+            }
+        }
+
+        return bodies;
+    }
+
+    BenchmarkResult MeasurePhysics(std::string name, TIMGE::JobSystem& jobSystem, std::size_t pileCount, std::size_t steps, std::vector<float>& state)
+    {
+        TIMGE::Physics::World world;
+        std::vector<TIMGE::Physics::Body> bodies = BuildPiles(world, pileCount);
+
+        BenchmarkResult result = Measure(std::move(name), bodies.size() * steps, [&]{
+            for (std::size_t step = 0; step < steps; step++) {
+                world.Step(1.0f / 60.0f, jobSystem);
+            }
+        });
+
+        result.mName += std::format(" ({} contacts, {} islands)", world.GetContactCount(), world.GetIslandCount());
+        result.mMilliseconds /= steps;
+
+        for (TIMGE::Physics::Body body : bodies)
+        {
+            TIMGE::V2f position = world.GetPosition(body);
+            state.insert(state.end(), { position[TIMGE::V2f::X], position[TIMGE::V2f::Y], world.GetAngle(body) });
+        }
+
+        return result;
+    }
+
+    template<typename... Args_T>
+    BenchmarkResult MeasureParticles(std::string name, std::size_t particleCount, std::size_t steps, Args_T&... args)
+    {
+        TIMGE::Render::EmitterInfo info{
+            { 0.0f, 0.0f, 0.0f },
+            { 0.0f, 4.0f, 0.0f },
+            { 2.0f, 2.0f, 2.0f },
+            { 0.0f, -9.81f, 0.0f },
+            0.1f,
+            static_cast<float>(particleCount) / 1.25f,
+            0.5f,
+            2.0f,
+            0.1f,
+            0.02f,
+            { 1.0f, 0.8f, 0.2f, 1.0f },
+            { 1.0f, 0.1f, 0.0f, 0.0f },
+            static_cast<uint32_t>(particleCount)
+        };
+
+        TIMGE::Render::ParticleSystem particles;
+        particles.Emit(particles.CreateEmitter(info), static_cast<uint32_t>(particleCount));
+
+        uint32_t died = 0;
+        BenchmarkResult result = Measure(std::move(name), particleCount * steps, [&]{
+            for (std::size_t step = 0; step < steps; step++)
+            {
+                particles.Update(1.0f / 60.0f, args...);
+                died += particles.GetStatistics().mDied;
+            }
+        });
+
+        result.mName += std::format(" ({} alive, {} died)", particles.GetParticleCount(), died);
+        result.mMilliseconds /= steps;
+        return result;
+    }
+
+    struct DrawScene
+    {
+        static constexpr std::size_t PROGRAMS = 4;
+        static constexpr std::size_t TEXTURES = 8;
+        static constexpr std::size_t VERTEX_ARRAYS = 2;
+        static constexpr GLsizei TARGET_SIZE = 256;
+
+        struct Object
+        {
+            uint16_t mProgram;
+            uint16_t mTexture;
+            uint16_t mVertexArray;
+        };
+
+        std::vector<TIMGE::Render::Shader> mShaders;
+        std::array<GLint, PROGRAMS> mLocations;
+        std::array<GLuint, TEXTURES> mTextures;
+        std::array<GLuint, VERTEX_ARRAYS> mVertexArrays;
+        GLuint mVertexBuffer;
+        GLuint mIndexBuffer;
+        GLuint mFramebuffer;
+        GLuint mRenderbuffer;
+        std::vector<Object> mObjects;
+
+        DrawScene(std::size_t drawCount)
+        {
+            static constexpr std::string_view VERTEX = R"(
+                in vec2 aPosition;
+                uniform vec4 uData[2];
+                void main()
+                {
+                    gl_Position = vec4(aPosition * uData[0].zw + uData[0].xy, 0.0, 1.0);
+                }
+            )";
+            static constexpr std::string_view FRAGMENT = R"(
+                uniform vec4 uData[2];
+                uniform sampler2D uTexture;
+                out vec4 oColor;
+                void main()
+                {
+                    oColor = texture(uTexture, vec2(0.5)) * uData[1];
+                }
+            )";
+
+            std::string_view version = GLAD_GL_VERSION_3_2 ? "150 core" : "130";
+            std::string vertex = std::format("#version {}\n{}", version, VERTEX);
+            std::string fragment = std::format("#version {}\n{}", version, FRAGMENT);
+
+            mShaders.reserve(PROGRAMS);
+            for (std::size_t i = 0; i < PROGRAMS; i++)
+            {
+                mShaders.emplace_back(std::initializer_list<TIMGE::Render::Shader::Stage>{
+                    { GL_VERTEX_SHADER, vertex },
+                    { GL_FRAGMENT_SHADER, fragment }
+                }, std::initializer_list<TIMGE::Render::Shader::Attribute>{ { 0, "aPosition" } });
+                mLocations[i] = mShaders.back().GetUniformLocation("uData");
+            }
+
+            glGenTextures(TEXTURES, mTextures.data());
+            for (std::size_t i = 0; i < TEXTURES; i++)
+            {
+                std::array<uint8_t, 4> texel{ static_cast<uint8_t>(i * 32), 128, 255, 255 };
+                glBindTexture(GL_TEXTURE_2D, mTextures[i]);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, texel.data());
+            }
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            static constexpr std::array<float, 8> QUAD = { -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f };
+            static constexpr std::array<uint32_t, 6> INDICES = { 0, 1, 2, 0, 2, 3 };
+
+            glGenBuffers(1, &mVertexBuffer);
+            glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(QUAD), QUAD.data(), GL_STATIC_DRAW);
+
+            glGenBuffers(1, &mIndexBuffer);
+            glGenVertexArrays(VERTEX_ARRAYS, mVertexArrays.data());
+            for (GLuint vertexArray : mVertexArrays)
+            {
+                glBindVertexArray(vertexArray);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(INDICES), INDICES.data(), GL_STATIC_DRAW);
+                glEnableVertexAttribArray(0);
+                glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+            }
+            glBindVertexArray(0);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+            glGenRenderbuffers(1, &mRenderbuffer);
+            glBindRenderbuffer(GL_RENDERBUFFER, mRenderbuffer);
+            glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, TARGET_SIZE, TARGET_SIZE);
+            glGenFramebuffers(1, &mFramebuffer);
+            glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mRenderbuffer);
+
+            std::mt19937 random(1337);
+            mObjects.resize(drawCount);
+            for (Object& object : mObjects) {
+                object = { static_cast<uint16_t>(random() % PROGRAMS), static_cast<uint16_t>(random() % TEXTURES), static_cast<uint16_t>(random() % VERTEX_ARRAYS) };
+            }
+        }
+
+        ~DrawScene()
+        {
+            glDeleteFramebuffers(1, &mFramebuffer);
+            glDeleteRenderbuffers(1, &mRenderbuffer);
+            glDeleteVertexArrays(VERTEX_ARRAYS, mVertexArrays.data());
+            glDeleteBuffers(1, &mVertexBuffer);
+            glDeleteBuffers(1, &mIndexBuffer);
+            glDeleteTextures(TEXTURES, mTextures.data());
+        }
+
+        static void ComputeUniforms(std::size_t index, std::array<float, 8>& uniforms)
+        {
+            float t = static_cast<float>(index);
+            uniforms = { std::sin(t * 0.37f), std::cos(t * 0.91f), 0.02f, 0.02f, 1.0f, std::fmod(t * 0.01f, 1.0f), 0.5f, 1.0f };
+        }
+    };
+
+    void DrawImmediate(const DrawScene& scene)
+    {
+        std::array<float, 8> uniforms;
+        for (std::size_t i = 0; i < scene.mObjects.size(); i++)
+        {
+            const DrawScene::Object& object = scene.mObjects[i];
+            DrawScene::ComputeUniforms(i, uniforms);
+
+            glUseProgram(scene.mShaders[object.mProgram].GetProgram());
+            glBindVertexArray(scene.mVertexArrays[object.mVertexArray]);
+            glBindTexture(GL_TEXTURE_2D, scene.mTextures[object.mTexture]);
+            glUniform4fv(scene.mLocations[object.mProgram], 2, uniforms.data());
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+        }
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glBindVertexArray(0);
+        glUseProgram(0);
+    }
+
+    void RecordCommands(const DrawScene& scene, TIMGE::JobSystem& jobSystem, TIMGE::Render::CommandQueue& queue)
+    {
+        queue.Record(jobSystem, static_cast<uint32_t>(scene.mObjects.size()), 1024, [&scene](uint32_t i, TIMGE::Render::CommandBuffer& buffer) {
+            const DrawScene::Object& object = scene.mObjects[i];
+
+            std::array<float, 8> uniforms;
+            DrawScene::ComputeUniforms(i, uniforms);
+
+            TIMGE::Render::Packet packet{};
+            packet.mKey = TIMGE::Render::CommandQueue::MakeKey(0, object.mProgram, static_cast<uint16_t>(object.mTexture * DrawScene::VERTEX_ARRAYS + object.mVertexArray), 0.0f);
+            packet.mProgram = scene.mShaders[object.mProgram].GetProgram();
+            packet.mVertexArray = scene.mVertexArrays[object.mVertexArray];
+            packet.mTexture = scene.mTextures[object.mTexture];
+            packet.mUniformLocation = scene.mLocations[object.mProgram];
+            packet.mIndexCount = 6;
+            packet.mPrimitive = TIMGE::Render::Primitive::TRIANGLES;
+            buffer.Draw(packet, uniforms);
+        });
+    }
+}
+
+BenchmarkResults RunECSBenchmark(TIMGE::JobSystem& jobSystem, std::size_t entityCount)
+{
+    BenchmarkResults results;
+
+    {
+        TIMGE::ECS::World world;
+        results.push_back(Measure(std::format("ECS: CreateEntity x{}", entityCount), entityCount, [&]{
+            for (std::size_t i = 0; i < entityCount; i++) {
+                world.CreateEntity(Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 1.0f });
+            }
+        }));
+    }
+
+    TIMGE::ECS::World world;
+    results.push_back(Measure(std::format("ECS: CreateEntities x{}", entityCount), entityCount, [&]{
+        world.CreateEntities(entityCount, Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 1.0f });
+    }));
+
+    auto& query = world.GetQuery<Position, const Velocity>();
+    results.push_back(Measure("ECS: ForEach (1 thread)", entityCount, [&]{
+        query.ForEach([](Position& position, const Velocity& velocity) {
+            position.mX += velocity.mX;
+            position.mY += velocity.mY;
+        });
+    }));
+
+    results.push_back(Measure(std::format("ECS: ParallelForEach ({} threads)", jobSystem.GetThreadCount()), entityCount, [&]{
+        query.ParallelForEach(jobSystem, [](Position& position, const Velocity& velocity) {
+            position.mX += velocity.mX;
+            position.mY += velocity.mY;
+        });
+    }));
+
+    results.push_back(Measure("ECS: Clear", entityCount, [&]{
+        world.Clear();
+    }));
+
+    return results;
+}
+
+BenchmarkResults RunSchedulerBenchmark(TIMGE::JobSystem& jobSystem, std::size_t entityCount)
+{
+    static constexpr std::size_t FRAMES = 60;
+    static constexpr double TIMESTEP = 1.0 / 60.0;
+    static constexpr float LIFETIME = 0.5f;
+
+    using TIMGE::ECS::Read;
+    using TIMGE::ECS::Stage;
+    using TIMGE::ECS::SystemContext;
+    using TIMGE::ECS::Write;
+
+    BenchmarkResults results;
+
+    // Half of the entities expire halfway through the run.
+    TIMGE::ECS::World world;
+    world.CreateEntities(entityCount / 2, Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 0.0f }, Age{ 0.0f });
+    world.CreateEntities(entityCount - entityCount / 2, Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 0.0f }, Age{ -1.0f });
+
+    float maxSpeed = 0.0f;
+
+    // Age and Gravity start together, Integrate, Speed and Expire once their
+    // inputs are written. Speed and Integrate both read Velocity side by side.
+    TIMGE::ECS::Scheduler scheduler;
+    scheduler.AddSystem<Read<>, Write<Age>>("Age", Stage::UPDATE, [](SystemContext& context) {
+        context.mWorld.GetQuery<Age>().ParallelForEach(context.mJobSystem, [timestep = static_cast<float>(context.mDeltaTime)](Age& age) {
+            age.mSeconds += timestep;
+        });
+    });
+    scheduler.AddSystem<Read<>, Write<Velocity>>("Gravity", Stage::UPDATE, [](SystemContext& context) {
+        context.mWorld.GetQuery<Velocity>().ParallelForEach(context.mJobSystem, [timestep = static_cast<float>(context.mDeltaTime)](Velocity& velocity) {
+            velocity.mY -= 9.81f * timestep;
+        });
+    });
+    scheduler.AddSystem<Read<Velocity>, Write<Position>>("Integrate", Stage::UPDATE, [](SystemContext& context) {
+        context.mWorld.GetQuery<Position, const Velocity>().ParallelForEach(context.mJobSystem, [timestep = static_cast<float>(context.mDeltaTime)](Position& position, const Velocity& velocity) {
+            position.mX += velocity.mX * timestep;
+            position.mY += velocity.mY * timestep;
+        });
+    });
+    scheduler.AddSystem<Read<Velocity>>("Speed", Stage::UPDATE, [&maxSpeed](SystemContext& context) {
+        maxSpeed = 0.0f;
+        context.mWorld.GetQuery<const Velocity>().ForEach([&maxSpeed](const Velocity& velocity) {
+            maxSpeed = std::max(maxSpeed, std::hypot(velocity.mX, velocity.mY));
+        });
+    });
+    scheduler.AddSystem<Read<Age>>("Expire", Stage::UPDATE, [](SystemContext& context) {
+        context.mWorld.GetQuery<const Age>().ForEach([&context](TIMGE::ECS::Entity entity, const Age& age) {
+            if (age.mSeconds > LIFETIME) {
+                context.mCommands.DestroyEntity(entity);
+            }
+        });
+    });
+
+    results.push_back(Measure(std::format("Scheduler: 5 systems x{} frames ({} threads)", FRAMES, jobSystem.GetThreadCount()), entityCount * FRAMES, [&]{
+        for (std::size_t frame = 0; frame < FRAMES; frame++) {
+            scheduler.Run(Stage::UPDATE, world, jobSystem, TIMESTEP);
+        }
+    }));
+    results.back().mMilliseconds /= FRAMES;
+    results.back().mName += std::format(", {} left, max speed {:.2f}, critical path {:.3f} ms", world.GetEntityCount(), maxSpeed, scheduler.GetCriticalPathTime(Stage::UPDATE));
+
+    return results;
+}
+
+BenchmarkResults RunBroadphaseBenchmark(const std::vector<std::size_t>& objectCounts)
+{
+    static constexpr std::size_t FRAMES = 10;
+
+    BenchmarkResults results;
+
+    for (std::size_t count : objectCounts)
+    {
+        TIMGE::Collision::SpatialHash spatialHash(2.0f);
+        results.push_back(MeasureBroadphase(std::format("Spatial hash x{}", count), spatialHash, count, FRAMES));
+
+        TIMGE::Collision::AABBTree tree(0.5f);
+        results.push_back(MeasureBroadphase(std::format("AABB tree x{}", count), tree, count, FRAMES));
+
+        results.push_back(MeasureBruteForce(count, count > 10'000 ? 1 : FRAMES));
+    }
+
+    return results;
+}
+
+BenchmarkResults RunPhysicsBenchmark(TIMGE::JobSystem& jobSystem, std::size_t pileCount)
+{
+    static constexpr std::size_t STEPS = 300;
+
+    BenchmarkResults results;
+
+    TIMGE::JobSystem serial(1);
+    std::vector<float> serialState;
+    results.push_back(MeasurePhysics(std::format("Physics x{} piles (1 thread)", pileCount), serial, pileCount, STEPS, serialState));
+
+    std::vector<float> parallelState;
+    results.push_back(MeasurePhysics(std::format("Physics x{} piles ({} threads)", pileCount, jobSystem.GetThreadCount()), jobSystem, pileCount, STEPS, parallelState));
+
+    bool deterministic = serialState == parallelState;
+    results.back().mName += deterministic ? " deterministic" : " DIVERGED";
+
+    return results;
+}
+
+BenchmarkResults RunParticleBenchmark(TIMGE::JobSystem& jobSystem, std::size_t particleCount)
+{
+    static constexpr std::size_t STEPS = 60;
+
+    BenchmarkResults results;
+    results.push_back(MeasureParticles(std::format("Particles x{} (1 thread)", particleCount), particleCount, STEPS));
+    results.push_back(MeasureParticles(std::format("Particles x{} ({} threads)", particleCount, jobSystem.GetThreadCount()), particleCount, STEPS, jobSystem));
+
+    return results;
+}
+
+BenchmarkResults RunSceneBenchmark(std::size_t entityCount)
+{
+    BenchmarkResults results;
+
+    TIMGE::Serialization::ComponentRegistry registry;
+    registry.Register<Position>("Position");
+    registry.Register<Velocity>("Velocity");
+
+    TIMGE::ECS::World world;
+    world.CreateEntities(entityCount, Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 1.0f });
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "timge_scene_benchmark.bin";
+    results.push_back(Measure(std::format("Scene: save x{}", entityCount), entityCount, [&]{
+        TIMGE::Serialization::SceneWriter writer(path);
+        writer.WriteWorld(world, registry);
+        writer.Finish();
+    }));
+
+    {
+        std::size_t columns = 0;
+        results.push_back(Measure("Scene: map and read in place", entityCount, [&]{
+            TIMGE::Serialization::Archive archive(path);
+            columns = TIMGE::Serialization::GetScene(archive).mComponents.GetSize();
+        }));
+        results.back().mName += std::format(" ({} columns)", columns);
+    }
+
+    TIMGE::Serialization::Archive archive(path);
+    TIMGE::ECS::World loaded;
+    results.push_back(Measure("Scene: load into world", entityCount, [&]{
+        TIMGE::Serialization::LoadWorld(archive, loaded, registry);
+    }));
+
+    std::filesystem::remove(path);
+    return results;
+}
+
+BenchmarkResults RunDrawBenchmark(TIMGE::JobSystem& jobSystem, std::size_t drawCount)
+{
+    static constexpr std::size_t FRAMES = 10;
+
+    BenchmarkResults results;
+
+    std::array<GLint, 4> viewport;
+    glGetIntegerv(GL_VIEWPORT, viewport.data());
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+
+    {
+        DrawScene scene(drawCount);
+        glViewport(0, 0, DrawScene::TARGET_SIZE, DrawScene::TARGET_SIZE);
+        glActiveTexture(GL_TEXTURE0);
+
+        DrawImmediate(scene);
+        glFinish();
+
+        results.push_back(Measure(std::format("Draws: immediate x{}", drawCount), drawCount * FRAMES, [&]{
+            for (std::size_t frame = 0; frame < FRAMES; frame++) {
+                DrawImmediate(scene);
+            }
+            glFinish();
+        }));
+        results.back().mMilliseconds /= FRAMES;
+
+        TIMGE::Render::CommandQueue queue(jobSystem.GetThreadCount());
+        RecordCommands(scene, jobSystem, queue);
+        queue.Execute();
+        glFinish();
+
+        double recordMilliseconds = 0.0;
+        results.push_back(Measure(std::format("Draws: command queue x{} ({} threads)", drawCount, jobSystem.GetThreadCount()), drawCount * FRAMES, [&]{
+            for (std::size_t frame = 0; frame < FRAMES; frame++)
+            {
+                auto start = std::chrono::steady_clock::now();
+                RecordCommands(scene, jobSystem, queue);
+                queue.Sort(jobSystem);
+                recordMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                queue.Execute();
+            }
+            glFinish();
+        }));
+        results.back().mMilliseconds /= FRAMES;
+
+        const TIMGE::Render::CommandQueue::Statistics& statistics = queue.GetStatistics();
+        results.back().mName += std::format(" ({:.3f} ms record+sort, {} program / {} vao / {} texture binds)",
+            recordMilliseconds / FRAMES, statistics.mProgramBinds, statistics.mVertexArrayBinds, statistics.mTextureBinds);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+    return results;
+}
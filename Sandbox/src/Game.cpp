@@ -7,10 +7,162 @@
 #include <TIMGE/CallbackDefs.hpp>
 
 #include <imgui.h>
+#include <stb_image/stb_image.h>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <fstream>
 #include <vector>
 
 Game* Game::mInstance = nullptr;
 
+static int SimulatedGamepadState(int jid, GLFWgamepadstate* state)
+{
+    if (jid != GLFW_JOYSTICK_1) {
+        return GLFW_FALSE;
+    }
+
+    double time = glfwGetTime();
+    *state = {};
+    state->axes[GLFW_GAMEPAD_AXIS_LEFT_X] = static_cast<float>(std::sin(time));
+    state->axes[GLFW_GAMEPAD_AXIS_LEFT_Y] = static_cast<float>(std::cos(time));
+    state->axes[GLFW_GAMEPAD_AXIS_LEFT_TRIGGER] = -1.0f;
+    state->axes[GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER] = static_cast<float>(std::sin(time * 0.5));
+    state->buttons[GLFW_GAMEPAD_BUTTON_A] = std::fmod(time, 1.0) < 0.5 ? GLFW_PRESS : GLFW_RELEASE;
+
+    return GLFW_TRUE;
+}
+
+static const char* SimulatedGamepadName(int) {
+    return "Simulated gamepad";
+}
+
+struct Image
+{
+    int mWidth;
+    int mHeight;
+    std::vector<uint8_t> mPixels;
+};
+
+static Image LoadImage(const std::filesystem::path& path)
+{
+    Image image{};
+    uint8_t* pixels = stbi_load(path.string().c_str(), &image.mWidth, &image.mHeight, nullptr, 4);
+    if (pixels == nullptr) {
+        throw TIMGE::Exception(std::format("Failed to decode \"{}\": {}", path.string(), stbi_failure_reason()));
+    }
+
+    image.mPixels.assign(pixels, pixels + static_cast<std::size_t>(image.mWidth) * image.mHeight * 4);
+    stbi_image_free(pixels);
+
+    return image;
+}
+
+static std::string LoadText(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream) {
+        throw TIMGE::Exception(std::format("Failed to open \"{}\"", path.string()));
+    }
+
+    std::string text(static_cast<std::size_t>(stream.tellg()), '\0');
+    stream.seekg(0);
+    stream.read(text.data(), static_cast<std::streamsize>(text.size()));
+
+    return text;
+}
+
+// Draws one triangle covering the target, vPosition runs from 0 to 1 across it.
+static std::unique_ptr<TIMGE::Render::Shader> CreateReloadShader(std::string_view fragment)
+{
+    static constexpr std::string_view VERTEX = R"(
+        out vec2 vPosition;
+        void main()
+        {
+            vec2 position = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 4.0 - 1.0;
+            vPosition = position * 0.5 + 0.5;
+            gl_Position = vec4(position, 0.0, 1.0);
+        }
+    )";
+
+    std::string_view version = GLAD_GL_VERSION_3_2 ? "150 core" : "130";
+    std::string vertexSource = std::format("#version {}\n{}", version, VERTEX);
+    std::string fragmentSource = std::format("#version {}\n{}", version, fragment);
+
+    return std::make_unique<TIMGE::Render::Shader>(std::initializer_list<TIMGE::Render::Shader::Stage>{
+        { GL_VERTEX_SHADER, vertexSource },
+        { GL_FRAGMENT_SHADER, fragmentSource }
+    });
+}
+
+static TIMGE::Render::Mat4 Multiply(const TIMGE::Render::Mat4& a, const TIMGE::Render::Mat4& b)
+{
+    TIMGE::Render::Mat4 result{};
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 4; row++) {
+            for (int k = 0; k < 4; k++) {
+                result[column * 4 + row] += a[k * 4 + row] * b[column * 4 + k];
+            }
+        }
+    }
+    return result;
+}
+
+static TIMGE::Render::Mat4 Perspective(float fovY, float aspect, float zNear, float zFar)
+{
+    float f = 1.0f / std::tan(fovY / 2.0f);
+    return {
+        f / aspect, 0.0f, 0.0f, 0.0f,
+        0.0f, f, 0.0f, 0.0f,
+        0.0f, 0.0f, (zFar + zNear) / (zNear - zFar), -1.0f,
+        0.0f, 0.0f, 2.0f * zFar * zNear / (zNear - zFar), 0.0f
+    };
+}
+
+static TIMGE::Render::Mat4 LookAt(const std::array<float, 3>& eye, const std::array<float, 3>& target)
+{
+    auto normalize = [](std::array<float, 3> v) {
+        float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        return std::array<float, 3>{ v[0] / length, v[1] / length, v[2] / length };
+    };
+    auto cross = [](const std::array<float, 3>& a, const std::array<float, 3>& b) {
+        return std::array<float, 3>{ a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+    };
+    auto dot = [](const std::array<float, 3>& a, const std::array<float, 3>& b) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    };
+
+    std::array<float, 3> f = normalize({ target[0] - eye[0], target[1] - eye[1], target[2] - eye[2] });
+    std::array<float, 3> s = normalize(cross(f, { 0.0f, 1.0f, 0.0f }));
+    std::array<float, 3> u = cross(s, f);
+
+    return {
+        s[0], u[0], -f[0], 0.0f,
+        s[1], u[1], -f[1], 0.0f,
+        s[2], u[2], -f[2], 0.0f,
+        -dot(s, eye), -dot(u, eye), dot(f, eye), 1.0f
+    };
+}
+
+static constexpr std::array<std::pair<std::string_view, std::string_view>, static_cast<std::size_t>(Game::Command::COUNT)> COMMAND_BINDINGS = {{
+    { "Exit", "Escape" },
+    { "Minimize", "M" },
+    { "Maximize", "Shift+M" },
+    { "Window Restore", "R" },
+    { "Mouse Restore", "Control+R" },
+    { "Raw Mouse Motion", "Shift+R" },
+    { "Show", "S" },
+    { "Hide", "Shift+S" },
+    { "Fullscreen", "F11" },
+    { "Borderless Fullscreen", "Control+F11" },
+    { "Center Cursor", "L" },
+    { "Hide cursor", "H" },
+    { "Capture cursor", "C" },
+    { "Disable cursor", "D" }
+}};
+
 TIMGE::Application::Info Game::mGameInfo {
             TIMGE::Window::Info{
                 "TIGMA Ballz!",
@@ -30,7 +182,16 @@ TIMGE::Application::Info Game::mGameInfo {
                 },
                 1.0f,
                 TIMGE::V2ui32{3, 3},
-                671 | TIMGE::Window::TRANSPARENT_FRAMEBUFFER,
+                TIMGE::WindowFlags{
+                    TIMGE::Window::RESIZABLE
+                |   TIMGE::Window::VISIBLE
+                |   TIMGE::Window::DECORATED
+                |   TIMGE::Window::FOCUSED
+                |   TIMGE::Window::AUTO_ICONIFY
+                |   TIMGE::Window::CENTER_CURSOR
+                |   TIMGE::Window::FOCUS_ON_SHOW
+                |   TIMGE::Window::TRANSPARENT_FRAMEBUFFER
+                },
             },
             TIMGE::Vector<float, 4>{
                 1.0f, 0.63f, 0.1f, 1.0f
@@ -65,8 +226,22 @@ TIMGE::Application::Info Game::mGameInfo {
             }
 };
 
+// Loaded before the application exists, so the window is created with the
+// persisted settings. Kept alive for the whole run since the title lives here.
+TIMGE::Config& Game::mGetConfig()
+{
+    static TIMGE::Config config = []{
+        TIMGE::Config loaded(Game::mGameInfo);
+        if (std::filesystem::exists(mCONFIG_PATH)) {
+            loaded.Load(mCONFIG_PATH);
+        }
+        return loaded;
+    }();
+    return config;
+}
+
 Game::Game()
- : Application(Game::mGameInfo),
+ : Application(mGetConfig().GetInfo()),
     monitor{GetMonitor()},
     window{Application::GetWindow()},
     mouse{Application::GetMouse()},
@@ -81,7 +256,35 @@ Game::Game()
     mContentScale{window.GetContentScale()},
     mMonitors{GetMonitor().GetMonitors()},
     mCursorPos{mouse.GetPosition()},
-    mScrollOffset{mouse.GetOffset()}
+    mScrollOffset{mouse.GetOffset()},
+    mDebugWindow{nullptr},
+    mIndirectRenderer{},
+    mIndirectCube{},
+    mIndirectGrid{64},
+    mIndirectEnabled{false},
+    mIndirectCulling{false},
+    mCuller{},
+    mOcclusionBuffer{},
+    mCubeBounds{},
+    mVisibleCubes{},
+    mTextRenderer{},
+    mFont{},
+    mTextEnabled{false},
+    mParticleRenderer{},
+    mParticleSystem{},
+    mFountain{},
+    mParticleRate{20'000},
+    mParticlesEnabled{false},
+    mReloadTexture{},
+    mReloadSize{},
+    mReloadWatch{},
+    mReloadShader{},
+    mReloadFramebuffer{},
+    mReloadTarget{},
+    mReloadVertexArray{},
+    mReloadShaderWatch{},
+    mConfigWatch{},
+    mConfigLive{false}
 {
     if (Game::mInstance) {
         throw "Only one instance of Game is allowed!\n";
@@ -89,6 +292,12 @@ Game::Game()
     mInstance = this;
 
     window.SetIcon("resources/youtube_logo.png");
+    mGetConfig().Apply(*this);
+
+    mRegisterCommands();
+    GetEventBus().Subscribe<TIMGE::KeyEvent>([this](const TIMGE::KeyEvent& event) {
+        mOnKey(event);
+    });
 
     ImGui::SetCurrentContext(GetImGuiContext());
     ImGuiIO& io = ImGui::GetIO(); (void)io;
@@ -102,6 +311,81 @@ Game::Game()
 Game::~Game()
 {}
 
+void Game::mOnKey(const TIMGE::KeyEvent& event)
+{
+    if (event.mWindow != &window || event.mAction != TIMGE::Keyboard::Action::PRESSED) {
+        return;
+    }
+
+    TIMGE::Input::ActionMap& actionMap = GetActionMap();
+
+    if (mRebindAction != TIMGE::Input::NULL_ACTION)
+    {
+        actionMap.Rebind(mRebindAction, 0, { TIMGE::Input::Device::KEYBOARD, static_cast<int32_t>(event.mKey), event.mMods });
+        mRebindAction = TIMGE::Input::NULL_ACTION;
+        return;
+    }
+
+    switch (static_cast<Command>(actionMap.Resolve(event.mKey, event.mMods)))
+    {
+        case Command::EXIT:
+            window.SetShouldClose(true);
+            break;
+        case Command::MINIMIZE:
+            window.Minimize();
+            break;
+        case Command::MAXIMIZE:
+            window.Maximize();
+            break;
+        case Command::WINDOW_RESTORE:
+            window.Restore();
+            break;
+        case Command::MOUSE_RESTORE:
+            mouse.Restore();
+            break;
+        case Command::RAW_MOUSE_MOTION:
+            mouse.RawMotion();
+            break;
+        case Command::SHOW:
+            window.Show();
+            break;
+        case Command::HIDE:
+            window.Hide();
+            break;
+        case Command::FULLSCREEN:
+            window.Fullscreen();
+            break;
+        case Command::BORDERLESS_FULLSCREEN:
+            window.BorderlessFullscreen();
+            break;
+        case Command::CENTER_CURSOR:
+            window.ToggleCenterCursor();
+            break;
+        case Command::HIDE_CURSOR:
+            mouse.Hide();
+            break;
+        case Command::CAPTURE_CURSOR:
+            mouse.Capture();
+            break;
+        case Command::DISABLE_CURSOR:
+            mouse.Disable();
+            break;
+        default:
+            break;
+    }
+}
+
+void Game::mRegisterCommands()
+{
+    TIMGE::Input::ActionMap& actionMap = GetActionMap();
+
+    for (const auto& [name, binding] : COMMAND_BINDINGS) {
+        actionMap.Bind(actionMap.AddAction(name), binding);
+    }
+
+    mRebindAction = TIMGE::Input::NULL_ACTION;
+}
+
 void Game::Run()
 {
     TIMGE::Window& window = GetWindow();
@@ -118,9 +402,18 @@ void Game::Run()
 
 void Game::Update()
 {
+    if (mDebugWindow != nullptr && mDebugWindow->ShouldClose())
+    {
+        RemoveWindow(*mDebugWindow);
+        mDebugWindow = nullptr;
+    }
 }
 
-void Game::Render() {
+void Game::Render()
+{
+    mDrawIndirectScene();
+    mDrawParticles();
+    mDrawText();
     mMenu();
 }
 
@@ -198,6 +491,7 @@ void Game::mMonitorSettings()
     mMonitorInfoVirtualPosition();
     mMonitorInfoWorkarea();
     mMonitorInfoGamma();
+    mMonitorInfoVideoModes();
 
     ImGui::End();
 }
@@ -240,20 +534,117 @@ void Game::mKeybindings()
     |   ImGuiWindowFlags_NoResize
     );
 
-    ImGui::Text("Exit = Escape");
-    ImGui::Text("Minimize = M");
-    ImGui::Text("Maximize = Shift + M");
-    ImGui::Text("Window Restore = R");
-    ImGui::Text("Mouse Restore = Control + R");
-    ImGui::Text("Raw Mouse Motion = Shift + R");
-    ImGui::Text("Show = S");
-    ImGui::Text("Hide = Shift + S");
-    ImGui::Text("Fullscreen = F11");
-    ImGui::Text("Borderless Fullscreen = Control + F11");
-    ImGui::Text("Center Cursor = L");
-    ImGui::Text("Hide cursor = H");
-    ImGui::Text("Capture cursor = C");
-    ImGui::Text("Disable cursor = D");
+    TIMGE::Input::ActionMap& actionMap = GetActionMap();
+
+    for (TIMGE::Input::Action action = 0; action < actionMap.GetActionCount(); action++)
+    {
+        std::string bindings;
+        for (const TIMGE::Input::Binding& binding : actionMap.GetBindings(action)) {
+            bindings += (bindings.empty() ? "" : " | ") + TIMGE::Input::ActionMap::FormatBinding(binding);
+        }
+
+        ImGui::PushID(action);
+        if (ImGui::Button(mRebindAction == action ? "Press a key..." : "Rebind")) {
+            mRebindAction = action;
+        }
+        ImGui::PopID();
+
+        ImGui::SameLine();
+        ImGui::Text("%s = %s", actionMap.GetName(action).data(), bindings.c_str());
+    }
+
+    if (ImGui::CollapsingHeader("Gamepads")) {
+        mGamepads();
+    }
+
+    ImGui::End();
+}
+
+void Game::mBenchmarks()
+{
+    static bool showBenchmarks = true;
+
+    ImGui::SetNextWindowPos({(float)mWindowSize[TIMGE::V2i32::WIDTH] / 3.0f, 0.0f});
+    ImGui::SetNextWindowSize({2.0f * (float)mWindowSize[TIMGE::V2i32::WIDTH] / 3.0f, (float)mWindowSize[TIMGE::V2i32::HEIGHT]});
+    ImGui::Begin("Benchmarks", &showBenchmarks, 
+        ImGuiWindowFlags_NoNav
+    |   ImGuiWindowFlags_NoMove
+    |   ImGuiWindowFlags_NoResize
+    );
+
+    if (ImGui::Button("ECS (1M entities)")) {
+        mBenchmarkRun([this]{ return RunECSBenchmark(GetJobSystem(), 1'000'000); });
+    }
+
+    if (ImGui::Button("System scheduler (100k entities, 60 frames)")) {
+        mBenchmarkRun([this]{ return RunSchedulerBenchmark(GetJobSystem(), 100'000); });
+    }
+
+    if (ImGui::Button("Broadphase (1k/10k/100k objects)")) {
+        mBenchmarkRun([]{ return RunBroadphaseBenchmark({ 1'000, 10'000, 100'000 }); });
+    }
+
+    if (ImGui::Button("Physics (64 piles, 300 steps)")) {
+        mBenchmarkRun([this]{ return RunPhysicsBenchmark(GetJobSystem(), 64); });
+    }
+
+    if (ImGui::Button("Particles (1M, 60 steps)")) {
+        mBenchmarkRun([this]{ return RunParticleBenchmark(GetJobSystem(), 1'000'000); });
+    }
+
+    if (ImGui::Button("Scene save/load (1M entities)")) {
+        mBenchmarkRun([]{ return RunSceneBenchmark(1'000'000); });
+    }
+
+    if (ImGui::Button("Draw calls (100k, immediate vs command queue)") && !mBenchmarkFuture.valid()) {
+        mBenchmarkResultsList = RunDrawBenchmark(GetJobSystem(), 100'000);
+    }
+
+    mBenchmarkResults();
+
+    if (ImGui::CollapsingHeader("Input recording")) {
+        mInputRecording();
+    }
+
+    if (ImGui::CollapsingHeader("Input latency")) {
+        mInputLatency();
+    }
+
+    if (ImGui::CollapsingHeader("Shared windows")) {
+        mDebugWindows();
+    }
+
+    if (ImGui::CollapsingHeader("Rendering")) {
+        mRendering();
+    }
+
+    if (ImGui::CollapsingHeader("Render graph")) {
+        mRenderGraph();
+    }
+
+    if (ImGui::CollapsingHeader("Indirect draw")) {
+        mIndirectDraw();
+    }
+
+    if (ImGui::CollapsingHeader("Text")) {
+        mText();
+    }
+
+    if (ImGui::CollapsingHeader("Particles")) {
+        mParticles();
+    }
+
+    if (ImGui::CollapsingHeader("Hot reload")) {
+        mHotReload();
+    }
+
+    if (ImGui::CollapsingHeader("Config")) {
+        mConfig();
+    }
+
+    if (ImGui::CollapsingHeader("System schedule")) {
+        ImGui::TextUnformatted(GetScheduler().Dump().c_str());
+    }
 
     ImGui::End();
 }
@@ -289,6 +680,10 @@ void Game::mMenu()
         windowsXPIndex = 3;
     }
 
+    if (ImGui::Button("Benchmarks")) {
+        windowsXPIndex = 4;
+    }
+
     (this->*windowsXP[windowsXPIndex])();
 
     ImGui::End();
@@ -625,11 +1020,51 @@ void Game::mMonitorInfoGamma()
     }
 }
 
+void Game::mMonitorInfoVideoModes()
+{
+    static int refreshRate = 60;
+
+    const TIMGE::Monitor::VideoMode& current = monitor.GetVideoMode();
+    ImGui::Text("Video mode: %ux%u @ %u Hz", current.mSize[TIMGE::V2ui32::WIDTH], current.mSize[TIMGE::V2ui32::HEIGHT], current.mRefreshRate);
+
+    if (ImGui::TreeNode("Video modes", "Video modes (%zu)", monitor.GetVideoModes().size()))
+    {
+        for (const TIMGE::Monitor::VideoMode& mode : monitor.GetVideoModes()) {
+            ImGui::Text("%ux%u @ %u Hz, %u bit", mode.mSize[TIMGE::V2ui32::WIDTH], mode.mSize[TIMGE::V2ui32::HEIGHT], mode.mRefreshRate, mode.mBitDepth);
+        }
+        ImGui::TreePop();
+    }
+
+    if (monitor.GetVideoModes().empty()) {
+        return;
+    }
+
+    ImGui::InputInt("Target refresh rate", &refreshRate);
+    refreshRate = std::max(refreshRate, 1);
+
+    const TIMGE::Monitor::VideoMode& best = monitor.GetBestVideoMode(current.mSize, static_cast<uint32_t>(refreshRate));
+    ImGui::Text("Best fullscreen mode: %ux%u @ %u Hz", best.mSize[TIMGE::V2ui32::WIDTH], best.mSize[TIMGE::V2ui32::HEIGHT], best.mRefreshRate);
+    if (ImGui::Button("Use for fullscreen")) {
+        window.SetFullscreenMode(best);
+    }
+}
+
 void Game::mMouseInfoPosition()
 {
     ImGui::Text("Cursor Position:");
     ImGui::Text("\tX: %f", mCursorPos[TIMGE::V2d::X]);
     ImGui::Text("\tX: %f", mCursorPos[TIMGE::V2d::Y]);
+
+    const TIMGE::V2d& delta = mouse.GetDelta();
+    ImGui::Text("Frame Motion:");
+    ImGui::Text("\tX: %f", delta[TIMGE::V2d::X]);
+    ImGui::Text("\tY: %f", delta[TIMGE::V2d::Y]);
+    ImGui::Text("\tSamples: %zu", mouse.GetFrameSampleCount());
+
+    static int capacity = 0;
+    if (ImGui::SliderInt("Motion history", &capacity, 0, 1024)) {
+        mouse.SetHistoryCapacity(static_cast<std::size_t>(capacity));
+    }
 }
 
 void Game::mMouseInfoScrollOffset()
@@ -637,6 +1072,10 @@ void Game::mMouseInfoScrollOffset()
     ImGui::Text("Scroll Offset:");
     ImGui::Text("\tOffset X: %f", mScrollOffset[TIMGE::V2d::X]);
     ImGui::Text("\tOffset Y: %f", mScrollOffset[TIMGE::V2d::Y]);
+
+    const TIMGE::V2d& scroll = mouse.GetScroll();
+    ImGui::Text("\tFrame X: %f", scroll[TIMGE::V2d::X]);
+    ImGui::Text("\tFrame Y: %f", scroll[TIMGE::V2d::Y]);
 }
 
 void Game::mMouseInfoLeftButton()
@@ -700,20 +1139,749 @@ void Game::mMouseInfoRawMotion()
 
 void Game::mMouseInfoCursors()
 {
-    static  std::vector<TIMGE::Cursor*> cursors;
+    static  std::vector<TIMGE::Cursor> cursors;
     cursors = mouse.GetCursors();
 
     for (int i = 0; i < cursors.size(); i++)
     {
         if (ImGui::Button(std::format("Set {}", i).c_str())) {
-            mouse.SetCursor(*cursors[i]);
+            mouse.SetCursor(cursors[i]);
         }
         ImGui::SameLine();
         if (ImGui::Button(std::format("Delete ##{}", i).c_str())) {
-            mouse.DeleteCursor(*cursors[i]);
+            mouse.DeleteCursor(cursors[i]);
         }
     }
     if (ImGui::Button("Reset cursor")) {
         mouse.ResetCursor();
     }
 }
+
+void Game::mBenchmarkRun(std::function<BenchmarkResults()> benchmark)
+{
+    if (mBenchmarkFuture.valid()) {
+        return;
+    }
+
+    mBenchmarkFuture = std::async(std::launch::async, std::move(benchmark));
+}
+
+void Game::mBenchmarkResults()
+{
+    if (mBenchmarkFuture.valid())
+    {
+        if (mBenchmarkFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            ImGui::Text("Running...");
+            return;
+        }
+        mBenchmarkResultsList = mBenchmarkFuture.get();
+    }
+
+    for (const BenchmarkResult& result : mBenchmarkResultsList) {
+        ImGui::Text("%s: %.3f ms (%.2f M/s)", result.mName.c_str(), result.mMilliseconds, result.mThroughput * 1.0E-6);
+    }
+}
+
+void Game::mInputRecording()
+{
+    static constexpr const char* RECORDING_PATH = "input.timr";
+
+    if (mRecorder.IsRecording())
+    {
+        ImGui::Text("Recording: frame %llu, %zu events", static_cast<unsigned long long>(mRecorder.GetFrame()), mRecorder.GetEventCount());
+        if (ImGui::Button("Stop recording")) {
+            mRecorder.Stop();
+        }
+        return;
+    }
+
+    if (mReplayer.IsReplaying())
+    {
+        ImGui::Text("Replaying: frame %llu, %zu events", static_cast<unsigned long long>(mReplayer.GetFrame()), mReplayer.GetEventCount());
+        if (ImGui::Button("Stop replay")) {
+            mReplayer.Stop();
+        }
+        return;
+    }
+
+    if (ImGui::Button("Record")) {
+        mRecorder.Start(*this);
+    }
+
+    if (mRecorder.GetEventCount() != 0)
+    {
+        ImGui::SameLine();
+        if (ImGui::Button("Replay")) {
+            mReplayer.SetData(mRecorder.GetData());
+            mReplayer.Start(*this);
+        }
+
+        ImGui::SameLine();
+        if (ImGui::Button("Save")) {
+            mRecorder.Save(RECORDING_PATH);
+        }
+
+        ImGui::Text("%zu events, %zu bytes", mRecorder.GetEventCount(), mRecorder.GetData().size());
+    }
+
+    ImGui::SameLine();
+    if (ImGui::Button("Load and replay")) {
+        mReplayer.Load(RECORDING_PATH);
+        mReplayer.Start(*this);
+    }
+}
+
+void Game::mInputLatency()
+{
+    TIMGE::Input::LatencyTracker& tracker = GetLatencyTracker();
+
+    bool enabled = tracker.IsEnabled();
+    if (ImGui::Checkbox("Measure input to swap latency", &enabled)) {
+        tracker.SetEnabled(enabled);
+    }
+
+    ImGui::SameLine();
+    if (ImGui::Button("Reset")) {
+        tracker.Reset();
+    }
+
+    ImGui::TextUnformatted(tracker.Dump().c_str());
+
+    static int source = 0;
+    ImGui::Combo("Histogram", &source, "Key\0Mouse button\0Cursor position\0Scroll\0");
+
+    std::span<const uint32_t> histogram = tracker.GetHistogram(static_cast<TIMGE::Input::LatencyTracker::Source>(source));
+    std::array<float, 128> bins{};
+    for (std::size_t i = 0; i < histogram.size() - 1; i++) {
+        bins[i * bins.size() / (histogram.size() - 1)] += static_cast<float>(histogram[i]);
+    }
+    ImGui::PlotHistogram("##latency", bins.data(), static_cast<int>(bins.size()), 0, "0 - 128 ms", 0.0f, FLT_MAX, ImVec2(0.0f, 80.0f));
+}
+
+void Game::mRendering()
+{
+    static float timeout = 0.25f;
+    static float delay = 1.0f;
+
+    bool onDemand = GetRenderMode() == RenderMode::ON_DEMAND;
+    if (ImGui::Checkbox("Render on demand", &onDemand)) {
+        SetRenderMode(onDemand ? RenderMode::ON_DEMAND : RenderMode::CONTINUOUS);
+    }
+
+    if (ImGui::SliderFloat("Idle timeout (s)", &timeout, 0.01f, 2.0f)) {
+        SetIdleTimeout(timeout);
+    }
+
+    ImGui::SliderFloat("Delay (s)", &delay, 0.0f, 5.0f);
+    ImGui::SameLine();
+    if (ImGui::Button("Schedule redraw")) {
+        ScheduleRedraw(delay);
+    }
+
+    ImGui::Text("Skipped frames: %llu", static_cast<unsigned long long>(GetSkippedFrames()));
+
+    ImGui::Separator();
+    ImGui::Text("Swap strategy:");
+
+    TIMGE::SwapController& swap = GetSwapController();
+
+    bool automatic = swap.IsAutomatic();
+    if (ImGui::Checkbox("Select automatically", &automatic)) {
+        swap.SetAutomatic(automatic);
+    }
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(TIMGE::SwapController::Strategy::COUNT); i++)
+    {
+        TIMGE::SwapController::Strategy strategy = static_cast<TIMGE::SwapController::Strategy>(i);
+        if (strategy == TIMGE::SwapController::Strategy::ADAPTIVE && !window.SupportsAdaptiveVSync()) {
+            continue;
+        }
+        if (ImGui::RadioButton(TIMGE::SwapController::GetName(strategy).data(), swap.GetStrategy() == strategy) && !automatic) {
+            swap.SetStrategy(strategy);
+        }
+    }
+
+    ImGui::Text("Strategy: %s", TIMGE::SwapController::GetName(swap.GetStrategy()).data());
+    ImGui::Text("Refresh period: %.2f ms", swap.GetRefreshPeriod() * 1000.0);
+    ImGui::Text("Frame work (p90): %.2f ms", swap.GetWorkTime() * 1000.0);
+    ImGui::Text("Frame start delay: %.2f ms", swap.GetFrameDelay() * 1000.0);
+
+    ImGui::Separator();
+    ImGui::Text("Resolution scaling:");
+
+    TIMGE::ResolutionScaler& scaler = GetResolutionScaler();
+
+    bool scaling = scaler.IsEnabled();
+    if (ImGui::Checkbox("Render scene offscreen", &scaling)) {
+        scaler.SetEnabled(scaling);
+    }
+
+    bool dynamic = scaler.IsDynamic();
+    if (ImGui::Checkbox("Dynamic scale", &dynamic)) {
+        scaler.SetDynamic(dynamic);
+    }
+
+    float scale = scaler.GetScale();
+    if (ImGui::SliderFloat("Scale", &scale, scaler.GetMinScale(), scaler.GetMaxScale()) && !dynamic) {
+        scaler.SetScale(scale);
+    }
+
+    float target = static_cast<float>(scaler.GetTargetFrameTime() * 1000.0);
+    if (ImGui::SliderFloat("Target GPU time (ms)", &target, 1.0f, 50.0f)) {
+        scaler.SetTargetFrameTime(target / 1000.0);
+    }
+
+    const TIMGE::V2ui32& renderSize = scaler.GetRenderSize();
+    ImGui::Text("Render size: %ux%u", renderSize[TIMGE::V2ui32::WIDTH], renderSize[TIMGE::V2ui32::HEIGHT]);
+    ImGui::Text("GPU scene time: %.2f ms", scaler.GetGpuTime() * 1000.0);
+}
+
+void Game::mRenderGraph()
+{
+    static bool debugView = false;
+    ImGui::Checkbox("Include debug view", &debugView);
+
+    const TIMGE::V2ui32& size = window.GetFramebufferSize();
+    TIMGE::V2ui32 half{ std::max(size[TIMGE::V2ui32::WIDTH] / 2, 1u), std::max(size[TIMGE::V2ui32::HEIGHT] / 2, 1u) };
+
+    TIMGE::Render::Graph graph;
+    TIMGE::Render::Resource backbuffer = graph.ImportBackbuffer(size);
+    TIMGE::Render::Resource color, depth, bright, blurred, debug;
+
+    graph.AddPass("scene", [&](TIMGE::Render::Graph::Builder& builder) {
+        color = builder.Write(builder.Create("scene_color", { size, GL_RGBA16F }));
+        depth = builder.Write(builder.Create("scene_depth", { size, GL_DEPTH24_STENCIL8 }));
+    }, nullptr);
+    graph.AddPass("debug_view", [&](TIMGE::Render::Graph::Builder& builder) {
+        builder.Read(depth);
+        debug = builder.Write(builder.Create("debug_view", { size, GL_RGBA8 }));
+    }, nullptr);
+    graph.AddPass("bright", [&](TIMGE::Render::Graph::Builder& builder) {
+        builder.Read(color);
+        bright = builder.Write(builder.Create("bloom_bright", { half, GL_RGBA16F }));
+    }, nullptr);
+    graph.AddPass("blur_h", [&](TIMGE::Render::Graph::Builder& builder) {
+        builder.Read(bright);
+        blurred = builder.Write(builder.Create("bloom_blur_h", { half, GL_RGBA16F }));
+    }, nullptr);
+    graph.AddPass("blur_v", [&](TIMGE::Render::Graph::Builder& builder) {
+        builder.Read(blurred);
+        bright = builder.Write(builder.Create("bloom_blur_v", { half, GL_RGBA16F }));
+    }, nullptr);
+    graph.AddPass("composite", [&](TIMGE::Render::Graph::Builder& builder) {
+        builder.Read(color);
+        builder.Read(bright);
+        if (debugView) {
+            builder.Read(debug);
+        }
+        builder.Write(backbuffer);
+    }, nullptr);
+    graph.Compile();
+
+    ImGui::TextUnformatted(graph.Dump().c_str());
+}
+
+void Game::mIndirectDraw()
+{
+    ImGui::Checkbox("Draw cube grid", &mIndirectEnabled);
+    ImGui::SliderInt("Grid size", &mIndirectGrid, 8, 256);
+
+    if (mIndirectRenderer == nullptr) {
+        return;
+    }
+
+    bool gpu = mIndirectRenderer->GetPath() == TIMGE::Render::IndirectRenderer::Path::GPU;
+    if (mIndirectRenderer->IsGpuSupported()) {
+        if (ImGui::Checkbox("GPU culling + multi-draw indirect", &gpu)) {
+            mIndirectRenderer->SetPath(gpu ? TIMGE::Render::IndirectRenderer::Path::GPU : TIMGE::Render::IndirectRenderer::Path::CPU);
+        }
+    } else {
+        ImGui::Text("OpenGL 4.3 unavailable, using the CPU path");
+    }
+
+    const TIMGE::Render::IndirectRenderer::Statistics& statistics = mIndirectRenderer->GetStatistics();
+    ImGui::Text("Objects: %u", statistics.mObjects);
+    if (gpu) {
+        ImGui::Text("Visible: %u (read back from the GPU, a few frames late)", statistics.mVisible);
+    } else {
+        ImGui::Text("Visible: %u", statistics.mVisible);
+    }
+    ImGui::Text("Draw calls: %u", statistics.mDrawCalls);
+
+    ImGui::Checkbox("Pre-cull on the CPU (SIMD frustum + HiZ occlusion)", &mIndirectCulling);
+    if (mIndirectCulling)
+    {
+        const TIMGE::Render::Culler::Statistics& culling = mCuller.GetStatistics();
+        ImGui::Text("Tested: %u, frustum culled: %u, occluded: %u, visible: %u", culling.mTested, culling.mFrustumCulled, culling.mOcclusionCulled, culling.mVisible);
+    }
+}
+
+void Game::mDrawIndirectScene()
+{
+    if (!mIndirectEnabled) {
+        return;
+    }
+
+    if (mIndirectRenderer == nullptr)
+    {
+        mIndirectRenderer = std::make_unique<TIMGE::Render::IndirectRenderer>();
+
+        std::vector<TIMGE::Render::IndirectRenderer::Vertex> vertices;
+        std::vector<uint32_t> indices;
+        for (int axis = 0; axis < 3; axis++) {
+            for (float sign : { -1.0f, 1.0f })
+            {
+                std::array<float, 3> normal{};
+                normal[axis] = sign;
+                int u = (axis + 1) % 3;
+                int v = (axis + 2) % 3;
+
+                uint32_t base = static_cast<uint32_t>(vertices.size());
+                for (auto [a, b] : { std::pair{-0.5f, -0.5f}, {0.5f, -0.5f}, {0.5f, 0.5f}, {-0.5f, 0.5f} })
+                {
+                    std::array<float, 3> position{};
+                    position[axis] = 0.5f * sign;
+                    position[u] = a;
+                    position[v] = b * sign;
+                    vertices.push_back({ position, normal });
+                }
+                indices.insert(indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+            }
+        }
+        mIndirectCube = mIndirectRenderer->AddMesh(vertices, indices);
+    }
+
+    float extent = static_cast<float>(mIndirectGrid) * 1.5f;
+    float time = static_cast<float>(GetTime());
+    std::array<float, 3> eye{ std::cos(time * 0.2f) * extent, extent * 0.35f, std::sin(time * 0.2f) * extent };
+
+    float aspect = static_cast<float>(mFramebufferSize[TIMGE::V2ui32::WIDTH]) / static_cast<float>(std::max(mFramebufferSize[TIMGE::V2ui32::HEIGHT], 1u));
+    TIMGE::Render::Mat4 viewProjection = Multiply(Perspective(1.0f, aspect, 0.1f, extent * 4.0f), LookAt(eye, { 0.0f, 0.0f, 0.0f }));
+
+    auto cubeTransform = [&](int x, int z) {
+        float px = (static_cast<float>(x) - mIndirectGrid / 2.0f) * 2.0f;
+        float pz = (static_cast<float>(z) - mIndirectGrid / 2.0f) * 2.0f;
+        return TIMGE::Render::Mat4{
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f,
+            px, std::sin(px * 0.1f + time) * 2.0f, pz, 1.0f
+        };
+    };
+    auto cubeColor = [&](int x, int z) {
+        return TIMGE::V4f{ static_cast<float>(x) / mIndirectGrid, 0.5f, static_cast<float>(z) / mIndirectGrid, 1.0f };
+    };
+
+    std::array<std::pair<std::array<float, 3>, std::array<float, 3>>, 2> walls;
+    for (std::size_t i = 0; i < walls.size(); i++)
+    {
+        float z = (i == 0 ? -1.0f : 1.0f) * mIndirectGrid * 0.5f;
+        walls[i] = { { -mIndirectGrid * 0.75f, -4.0f, z - 1.0f }, { mIndirectGrid * 0.75f, 12.0f, z + 1.0f } };
+
+        const auto& [min, max] = walls[i];
+        TIMGE::Render::Mat4 transform{
+            max[0] - min[0], 0.0f, 0.0f, 0.0f,
+            0.0f, max[1] - min[1], 0.0f, 0.0f,
+            0.0f, 0.0f, max[2] - min[2], 0.0f,
+            (min[0] + max[0]) * 0.5f, (min[1] + max[1]) * 0.5f, (min[2] + max[2]) * 0.5f, 1.0f
+        };
+        mIndirectRenderer->Submit(mIndirectCube, transform, { 0.6f, 0.6f, 0.6f, 1.0f });
+    }
+
+    if (!mIndirectCulling)
+    {
+        for (int x = 0; x < mIndirectGrid; x++) {
+            for (int z = 0; z < mIndirectGrid; z++) {
+                mIndirectRenderer->Submit(mIndirectCube, cubeTransform(x, z), cubeColor(x, z));
+            }
+        }
+    }
+    else
+    {
+        mCubeBounds.Clear();
+        for (int x = 0; x < mIndirectGrid; x++) {
+            for (int z = 0; z < mIndirectGrid; z++)
+            {
+                TIMGE::Render::Mat4 transform = cubeTransform(x, z);
+                mCubeBounds.Add({ transform[12] - 0.5f, transform[13] - 0.5f, transform[14] - 0.5f }, { transform[12] + 0.5f, transform[13] + 0.5f, transform[14] + 0.5f });
+            }
+        }
+
+        mOcclusionBuffer.Begin(viewProjection);
+        for (const auto& [min, max] : walls) {
+            mOcclusionBuffer.AddOccluder(min, max);
+        }
+        mOcclusionBuffer.Rasterize(GetJobSystem());
+
+        mCuller.NewFrame();
+        mCuller.CullBoxes(TIMGE::Render::Frustum(viewProjection), mCubeBounds, mVisibleCubes, &mOcclusionBuffer);
+        for (uint32_t index : mVisibleCubes)
+        {
+            int x = static_cast<int>(index) / mIndirectGrid;
+            int z = static_cast<int>(index) % mIndirectGrid;
+            mIndirectRenderer->Submit(mIndirectCube, cubeTransform(x, z), cubeColor(x, z));
+        }
+    }
+
+    glEnable(GL_DEPTH_TEST);
+    mIndirectRenderer->Render(viewProjection);
+    glDisable(GL_DEPTH_TEST);
+}
+
+void Game::mText()
+{
+    static std::array<char, 256> fontPath{ "resources/font.ttf" };
+
+    ImGui::InputText("Font", fontPath.data(), fontPath.size());
+    if (!std::filesystem::exists(fontPath.data())) {
+        ImGui::Text("No TrueType font at this path");
+    }
+    else if (ImGui::Button("Load font"))
+    {
+        if (mTextRenderer == nullptr) {
+            mTextRenderer = std::make_unique<TIMGE::Render::TextRenderer>();
+        }
+        mFont = mTextRenderer->LoadFont(fontPath.data());
+        mTextEnabled = true;
+    }
+
+    if (mTextRenderer == nullptr) {
+        return;
+    }
+
+    ImGui::Checkbox("Draw HUD text", &mTextEnabled);
+
+    const TIMGE::Render::TextRenderer::Statistics& statistics = mTextRenderer->GetStatistics();
+    ImGui::Text("Glyphs: %u in %u draw call(s)", statistics.mGlyphs, statistics.mDrawCalls);
+    ImGui::Text("Runs: %u shaped, %u cached", statistics.mShapedRuns, statistics.mCachedRuns);
+    ImGui::Text("Atlas: %u / %u cells, %u rasterized, %u evicted", mTextRenderer->GetUsedCellCount(), mTextRenderer->GetCellCount(), statistics.mRasterized, statistics.mEvictions);
+}
+
+void Game::mDrawText()
+{
+    if (!mTextEnabled || mTextRenderer == nullptr) {
+        return;
+    }
+
+    static const TIMGE::V4f WHITE{ 1.0f, 1.0f, 1.0f, 1.0f };
+
+    mTextRenderer->DrawStatic(mFont, "TIGMA Ballz!", { 16.0f, 16.0f }, 48.0f, WHITE);
+    mTextRenderer->DrawStatic(mFont, "Signed distance field text\nscales without blurring", { 16.0f, 72.0f }, 20.0f, WHITE);
+    mTextRenderer->Draw(mFont, std::format("{:.1f} FPS", 1.0 / std::max(mDeltaTime, 1.0E-6)), { 16.0f, 128.0f }, 24.0f, { 1.0f, 0.85f, 0.2f, 1.0f });
+    mTextRenderer->Render();
+}
+
+void Game::mParticles()
+{
+    ImGui::Checkbox("Draw fountain", &mParticlesEnabled);
+    ImGui::SliderInt("Particles per second", &mParticleRate, 1'000, 500'000);
+
+    const TIMGE::Render::ParticleSystem::Statistics& statistics = mParticleSystem.GetStatistics();
+    ImGui::Text("Alive: %u, spawned: %u, died: %u", statistics.mAlive, statistics.mSpawned, statistics.mDied);
+}
+
+void Game::mDrawParticles()
+{
+    if (!mParticlesEnabled) {
+        return;
+    }
+
+    if (mParticleRenderer == nullptr)
+    {
+        mParticleRenderer = std::make_unique<TIMGE::Render::ParticleRenderer>();
+        mFountain = mParticleSystem.CreateEmitter({
+            { 0.0f, 0.0f, 0.0f },
+            { 0.0f, 8.0f, 0.0f },
+            { 1.5f, 1.0f, 1.5f },
+            { 0.0f, -9.81f, 0.0f },
+            0.2f,
+            static_cast<float>(mParticleRate),
+            1.0f,
+            2.5f,
+            0.15f,
+            0.05f,
+            { 0.3f, 0.6f, 1.0f, 1.0f },
+            { 1.0f, 1.0f, 1.0f, 0.0f },
+            1'000'000
+        });
+    }
+
+    TIMGE::Render::EmitterInfo info = mParticleSystem.GetEmitter(mFountain);
+    info.mRate = static_cast<float>(mParticleRate);
+    mParticleSystem.SetEmitter(mFountain, info);
+    mParticleSystem.Update(static_cast<float>(std::min(mDeltaTime, 0.1)), GetJobSystem());
+
+    float time = static_cast<float>(GetTime());
+    std::array<float, 3> eye{ std::cos(time * 0.3f) * 12.0f, 6.0f, std::sin(time * 0.3f) * 12.0f };
+
+    float aspect = static_cast<float>(mFramebufferSize[TIMGE::V2ui32::WIDTH]) / static_cast<float>(std::max(mFramebufferSize[TIMGE::V2ui32::HEIGHT], 1u));
+    mParticleRenderer->Render(mParticleSystem, LookAt(eye, { 0.0f, 3.0f, 0.0f }), Perspective(1.0f, aspect, 0.1f, 100.0f));
+}
+
+void Game::mHotReload()
+{
+    TIMGE::HotReloader& hotReloader = GetHotReloader();
+
+    const TIMGE::HotReloader::Statistics& statistics = hotReloader.GetStatistics();
+    ImGui::Text("Watching %zu file(s), %u reload(s), %u failure(s)", hotReloader.GetWatchCount(), statistics.mReloads, statistics.mFailures);
+    for (const TIMGE::HotReloader::Failure& failure : hotReloader.GetFailures()) {
+        ImGui::TextWrapped("%s", failure.mMessage.c_str());
+    }
+
+    mHotReloadImage();
+    mHotReloadShader();
+}
+
+void Game::mHotReloadImage()
+{
+    static constexpr const char* IMAGE_PATH = "resources/nice.png";
+
+    TIMGE::HotReloader& hotReloader = GetHotReloader();
+
+    if (mReloadTexture == 0)
+    {
+        if (!ImGui::Button("Watch resources/nice.png")) {
+            return;
+        }
+
+        // The texture is only ever replaced once a new image has decoded, so a
+        // half-written or broken file leaves the previous one on screen.
+        auto apply = [this](Image& image) {
+            GLuint texture;
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, image.mWidth, image.mHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, image.mPixels.data());
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            glDeleteTextures(1, &mReloadTexture);
+            mReloadTexture = texture;
+            mReloadSize = { static_cast<float>(image.mWidth), static_cast<float>(image.mHeight) };
+        };
+
+        Image image = LoadImage(IMAGE_PATH);
+        apply(image);
+        mReloadWatch = hotReloader.Watch<Image>(IMAGE_PATH, LoadImage, apply);
+    }
+
+    if (ImGui::Button("Stop watching resources/nice.png"))
+    {
+        hotReloader.Unwatch(mReloadWatch);
+        glDeleteTextures(1, &mReloadTexture);
+        mReloadTexture = 0;
+        return;
+    }
+
+    float scale = 128.0f / std::max(mReloadSize[TIMGE::V2f::X], mReloadSize[TIMGE::V2f::Y]);
+    ImGui::Image(static_cast<ImTextureID>(mReloadTexture), { mReloadSize[TIMGE::V2f::X] * scale, mReloadSize[TIMGE::V2f::Y] * scale });
+}
+
+void Game::mHotReloadShader()
+{
+    static constexpr const char* SHADER_PATH = "resources/reload.frag";
+    static constexpr GLsizei TARGET_SIZE = 128;
+
+    TIMGE::HotReloader& hotReloader = GetHotReloader();
+
+    if (!mReloadShader)
+    {
+        if (!ImGui::Button("Watch resources/reload.frag")) {
+            return;
+        }
+
+        // Shader throws before mReloadShader is touched when the new source
+        // fails to compile or link, so the last working program keeps drawing.
+        auto apply = [this](std::string& source) {
+            mReloadShader = CreateReloadShader(source);
+        };
+
+        std::string source = LoadText(SHADER_PATH);
+        apply(source);
+        mReloadShaderWatch = hotReloader.Watch<std::string>(SHADER_PATH, LoadText, apply);
+
+        glGenTextures(1, &mReloadTarget);
+        glBindTexture(GL_TEXTURE_2D, mReloadTarget);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, TARGET_SIZE, TARGET_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        GLint framebuffer = 0;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+        glGenFramebuffers(1, &mReloadFramebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, mReloadFramebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mReloadTarget, 0);
+        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+
+        glGenVertexArrays(1, &mReloadVertexArray);
+    }
+
+    if (ImGui::Button("Stop watching resources/reload.frag"))
+    {
+        hotReloader.Unwatch(mReloadShaderWatch);
+        glDeleteVertexArrays(1, &mReloadVertexArray);
+        glDeleteFramebuffers(1, &mReloadFramebuffer);
+        glDeleteTextures(1, &mReloadTarget);
+        mReloadVertexArray = 0;
+        mReloadFramebuffer = 0;
+        mReloadTarget = 0;
+        mReloadShader.reset();
+        return;
+    }
+
+    std::array<GLint, 4> viewport;
+    glGetIntegerv(GL_VIEWPORT, viewport.data());
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mReloadFramebuffer);
+    glViewport(0, 0, TARGET_SIZE, TARGET_SIZE);
+    mReloadShader->Use();
+    glUniform1f(mReloadShader->GetUniformLocation("uTime"), static_cast<float>(glfwGetTime()));
+    glBindVertexArray(mReloadVertexArray);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+    glUseProgram(0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+    ImGui::Image(static_cast<ImTextureID>(mReloadTarget), { static_cast<float>(TARGET_SIZE), static_cast<float>(TARGET_SIZE) });
+}
+
+void Game::mConfig()
+{
+    TIMGE::Config& config = mGetConfig();
+    TIMGE::HotReloader& hotReloader = GetHotReloader();
+
+    ImGui::Text("%s %s", mCONFIG_PATH, std::filesystem::exists(mCONFIG_PATH) ? "" : "(not saved yet)");
+
+    // Window settings take effect on the next start, everything Apply covers
+    // is picked up as soon as the file is saved.
+    if (ImGui::Checkbox("Apply changes to the file live", &mConfigLive))
+    {
+        if (mConfigLive)
+        {
+            mConfigWatch = hotReloader.Watch<TIMGE::Config>(mCONFIG_PATH,
+                [](const std::filesystem::path& path) {
+                    TIMGE::Config loaded(Game::mGameInfo);
+                    loaded.Load(path);
+                    return loaded;
+                },
+                [this](TIMGE::Config& loaded) {
+                    loaded.Apply(*this);
+                }
+            );
+        } else {
+            hotReloader.Unwatch(mConfigWatch);
+        }
+    }
+
+    if (ImGui::Button("Save current window and renderer settings"))
+    {
+        TIMGE::Window::Info& info = config.GetWindowInfo();
+        info.mSize = window.GetSize();
+        info.mPosition = window.GetPosition();
+        info.mOpacity = window.GetOpacity();
+
+        TIMGE::Config::RendererSettings& renderer = config.GetRendererSettings();
+        renderer.mBackground = GetBackgroundColor();
+        renderer.mSwapStrategy = GetSwapController().GetStrategy();
+        renderer.mAutomaticSwap = GetSwapController().IsAutomatic();
+        renderer.mRenderMode = GetRenderMode();
+        renderer.mResolutionScaling = GetResolutionScaler().IsEnabled();
+        renderer.mDynamicResolution = GetResolutionScaler().IsDynamic();
+        renderer.mResolutionScale = GetResolutionScaler().GetScale();
+
+        config.Save(mCONFIG_PATH);
+    }
+}
+
+void Game::mDebugWindows()
+{
+    static TIMGE::Window::Info info {
+        "TIMGE debug view",
+        TIMGE::V2ui32{480, 320},
+        TIMGE::V4ui32{
+            TIMGE::SIZE_LIMITS_DONT_CARE,
+            TIMGE::SIZE_LIMITS_DONT_CARE,
+            TIMGE::SIZE_LIMITS_DONT_CARE,
+            TIMGE::SIZE_LIMITS_DONT_CARE
+        },
+        TIMGE::V2i32{0, 0},
+        TIMGE::V2ui32{
+            TIMGE::ASPECT_RATIO_DONT_CARE,
+            TIMGE::ASPECT_RATIO_DONT_CARE,
+        },
+        1.0f,
+        TIMGE::V2ui32{3, 3},
+        TIMGE::WindowFlags{ TIMGE::Window::RESIZABLE | TIMGE::Window::VISIBLE | TIMGE::Window::DECORATED }
+    };
+    static float rate = 20.0f;
+
+    ImGui::Text("Windows: %zu", GetWindowCount());
+
+    if (mDebugWindow == nullptr)
+    {
+        if (ImGui::Button("Open debug view"))
+        {
+            mDebugWindow = &AddWindow(info);
+            mDebugWindow->SetPresentRate(rate);
+            mDebugWindow->SetRenderer([](TIMGE::Window& window) {
+                const TIMGE::V2ui32& size = window.GetFramebufferSize();
+                float pulse = 0.5f + 0.5f * static_cast<float>(std::sin(glfwGetTime() * 2.0));
+
+                glViewport(0, 0, size[TIMGE::V2ui32::WIDTH], size[TIMGE::V2ui32::HEIGHT]);
+                glClearColor(0.1f, 0.2f * pulse, 0.4f * pulse, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT);
+            });
+        }
+        return;
+    }
+
+    if (ImGui::SliderFloat("Present rate (Hz)", &rate, 0.0f, 240.0f, rate == 0.0f ? "every frame" : "%.0f")) {
+        mDebugWindow->SetPresentRate(rate);
+    }
+
+    if (ImGui::Button("Close debug view"))
+    {
+        RemoveWindow(*mDebugWindow);
+        mDebugWindow = nullptr;
+    }
+}
+
+void Game::mGamepads()
+{
+    static bool simulate = false;
+
+    if (ImGui::Checkbox("Simulate gamepad", &simulate))
+    {
+        TIMGE::Gamepad::GetGamepadState = simulate ? SimulatedGamepadState : glfwGetGamepadState;
+        TIMGE::Gamepad::GetGamepadName = simulate ? SimulatedGamepadName : glfwGetGamepadName;
+    }
+
+    TIMGE::Gamepad& gamepad = GetGamepad();
+
+    float deadzone = gamepad.GetDeadzone();
+    if (ImGui::SliderFloat("Deadzone", &deadzone, 0.0f, 0.9f)) {
+        gamepad.SetDeadzone(deadzone);
+    }
+
+    ImGui::Text("Connected: %zu", gamepad.GetConnectedCount());
+
+    for (uint32_t pad = 0; pad < TIMGE::Gamepad::MAX_GAMEPADS; pad++)
+    {
+        if (!gamepad.IsConnected(pad)) {
+            continue;
+        }
+
+        const TIMGE::Gamepad::Snapshot& snapshot = gamepad.GetSnapshot(pad);
+        ImGui::Text("%u: %s", pad, gamepad.GetName(pad).data());
+        ImGui::Text("Left stick = (%.2f, %.2f)", snapshot.mAxes[GLFW_GAMEPAD_AXIS_LEFT_X], snapshot.mAxes[GLFW_GAMEPAD_AXIS_LEFT_Y]);
+        ImGui::Text("Right stick = (%.2f, %.2f)", snapshot.mAxes[GLFW_GAMEPAD_AXIS_RIGHT_X], snapshot.mAxes[GLFW_GAMEPAD_AXIS_RIGHT_Y]);
+        ImGui::Text("Triggers = (%.2f, %.2f)", snapshot.mAxes[GLFW_GAMEPAD_AXIS_LEFT_TRIGGER], snapshot.mAxes[GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER]);
+        ImGui::Text("Buttons = 0x%04X", snapshot.mButtons);
+    }
+}
@@ -6,11 +6,28 @@
 #include "Callback.hpp"
 #include "Mouse.hpp"
 #include "Keyboard.hpp"
+#include "Gamepad.hpp"
+#include "EventBus.hpp"
+#include "HotReloader.hpp"
+#include "Events.hpp"
 #include "Monitor.hpp"
+#include "JobSystem.hpp"
+#include "ResolutionScaler.hpp"
+#include "SwapController.hpp"
+#include "ECS/Scheduler.hpp"
+#include "ECS/World.hpp"
+#include "Input/ActionMap.hpp"
+#include "Input/LatencyTracker.hpp"
+#include "Input/Replayer.hpp"
+#include "Physics/World.hpp"
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
 #include <string_view>
+#include <vector>
 
 #ifdef TIMGE_ENABLE_IMGUI
 #include <imgui_internal.h>
@@ -47,12 +64,20 @@ namespace TIMGE
 			using EventProcessor_T = decltype(&glfwPollEvents);
 			using GetTime_T = decltype(&glfwGetTime);
 			using SetTime_T = decltype(&glfwSetTime);
+			using WaitEventsTimeout_T = decltype(&glfwWaitEventsTimeout);
 		protected:
 		    static EventProcessor_T PollEvents;
 		    static EventProcessor_T WaitEvents;
+			static WaitEventsTimeout_T WaitEventsTimeout;
 			static GetTime_T GetTime;
 			static SetTime_T SetTime;
 		public:
+			enum class RenderMode
+			{
+				CONTINUOUS,
+				ON_DEMAND
+			};
+
 		    struct Info
 		    {
 		        Window::Info mWindowInfo;
@@ -69,17 +94,44 @@ namespace TIMGE
 		    virtual void Update() = 0;
 		    virtual void Render() = 0;
 
+		    virtual void FixedUpdate(double timestep);
+
 		    virtual void BeginFrame();
 		    virtual void EndFrame();
 
 			void SetMonitor(const Monitor& monitor);
 			void SetBackgroundColor(const V4f& backgroundColor = { });
 			void SetEventProcessor(EventProcessor_T eventProcessor);
+			void SetFixedTimestep(double timestep);
+			void SetRenderMode(RenderMode mode);
+			void SetIdleTimeout(double timeout);
+			void RequestRedraw(uint32_t frames = 1);
+			void ScheduleRedraw(double delay);
+
+			[[maybe_unused]] Window& AddWindow(const Window::Info& info, const Callback::Callbacks& callbacks = {});
+			void RemoveWindow(Window& window);
 
 			[[nodiscard]] Monitor& GetMonitor();
 		    [[nodiscard]] Window& GetWindow();
+			[[nodiscard]] std::size_t GetWindowCount() const;
 			[[nodiscard]] Mouse& GetMouse();
 			[[nodiscard]] Keyboard& GetKeyboard();
+			[[nodiscard]] Gamepad& GetGamepad();
+			[[nodiscard]] JobSystem& GetJobSystem();
+			[[nodiscard]] ECS::World& GetWorld();
+			[[nodiscard]] ECS::Scheduler& GetScheduler();
+			[[nodiscard]] Physics::World& GetPhysicsWorld();
+			[[nodiscard]] Input::ActionMap& GetActionMap();
+			[[nodiscard]] Input::LatencyTracker& GetLatencyTracker();
+			[[nodiscard]] EventBus& GetEventBus();
+			[[nodiscard]] SwapController& GetSwapController();
+			[[nodiscard]] ResolutionScaler& GetResolutionScaler();
+			[[nodiscard]] HotReloader& GetHotReloader();
+			[[nodiscard]] double GetFixedTimestep() const;
+			[[nodiscard]] double GetFixedAlpha() const;
+			[[nodiscard]] RenderMode GetRenderMode() const;
+			[[nodiscard]] bool IsIdle() const;
+			[[nodiscard]] uint64_t GetSkippedFrames() const;
 			[[nodiscard]] const double& GetDeltaTime();
 			[[nodiscard]] const V4f& GetBackgroundColor();
 			[[nodiscard]] EventProcessor_T GetEventProcessor();
@@ -93,11 +145,45 @@ namespace TIMGE
 		    Window mWindow;
 			Mouse mMouse;
 			Keyboard mKeyboard;
+			Gamepad mGamepad;
+			JobSystem mJobSystem;
+			ECS::World mWorld;
+			ECS::Scheduler mScheduler;
+			Physics::World mPhysicsWorld;
+			Input::ActionMap mActionMap;
+			Input::LatencyTracker mLatencyTracker;
+			EventBus mEventBus;
+			SwapController mSwapController;
+			ResolutionScaler mResolutionScaler;
+			HotReloader mHotReloader;
+
+			struct SharedWindow
+			{
+				Window::Info mInfo;
+				Callback::Callbacks mCallbacks;
+				std::unique_ptr<Window> mWindow;
+				Callback::Route mRoute;
+			};
+
+			Callback::Route mRoute;
+			std::vector<std::unique_ptr<SharedWindow>> mSharedWindows;
 
 			std::chrono::steady_clock mSteadyClock;
 
 			double mDeltaTime;
+			double mFixedTimestep;
+			double mFixedAccumulator;
+			double mDeltaTimeOverride;
 			std::chrono::steady_clock::time_point mStartTime;
+			std::chrono::steady_clock::time_point mWorkStart;
+
+			RenderMode mRenderMode;
+			double mIdleTimeout;
+			uint32_t mRedrawFrames;
+			bool mRendering;
+			bool mIdle;
+			uint64_t mSkippedFrames;
+			std::priority_queue<std::chrono::steady_clock::time_point, std::vector<std::chrono::steady_clock::time_point>, std::greater<>> mRedrawTimers;
 
 			EventProcessor_T mEventProcessor;
 			
@@ -107,17 +193,30 @@ namespace TIMGE
 
 		    [[nodiscard]] static Application* mGetInstance();
 
-			static void mConnectMonitor(GLFWmonitor* monitor);
-			static void mDisconnectMonitor(GLFWmonitor* monitor);
+			void mDelayFrameStart();
+			void mRunFixedSteps();
+			void mPollGamepads();
+			void mPresentWindows();
+			void mInvalidate();
+			[[nodiscard]] bool mShouldRender();
+			[[nodiscard]] double mWaitForEvents();
+			void mInstallCallbacks(Window& window, Callback::Route& route);
+
+			static constexpr uint32_t mMAX_FIXED_STEPS = 8;
+			static constexpr uint32_t mINPUT_REDRAW_FRAMES = 3;
+
+			void mRefreshMonitors();
 
 			void mSetCursorPosition(const V2d& cursorPosition);
+			void mSetCursorEntered(bool entered);
 			void mSetScrollOffset(const V2d& cursorScrollOffset);
 
-			void mSetPosition(const V2i32& position);
-			void mSetSize(const V2ui32& size);
-			void mSetFramebufferSize(const V2ui32& framebufferSize);
-    	    void mSetFrameSize(const V4ui32& frameSize);
-			void mSetContentScale(const V2f& contentScale);
+			void mSetPosition(Window& window, const V2i32& position);
+			void mSetSize(Window& window, const V2ui32& size);
+			void mSetFramebufferSize(Window& window, const V2ui32& framebufferSize);
+    	    void mSetFrameSize(Window& window, const V4ui32& frameSize);
+			void mSetContentScale(Window& window, const V2f& contentScale);
+			void mToggleFlags(Window& window, Window::FLAGS flags);
 
 			static Application* mInstance;
 
@@ -141,6 +240,8 @@ namespace TIMGE
     	    friend void Callback::DropCallback(GLFWwindow* window, int pathCount, const char* path[]);
     	    friend void Callback::MonitorCallback(GLFWmonitor* monitor, int event);
     	    friend void Callback::JoystickCallback(int jid, int event);
+
+			friend class Input::Replayer;
 	};
 }
 
@@ -0,0 +1,88 @@
+#ifndef CONFIG_HPP
+#define CONFIG_HPP
+
+#include "Application.hpp"
+#include "Exception.hpp"
+#include "SwapController.hpp"
+#include "Window.hpp"
+#include "Utils/Vector.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace TIMGE
+{
+    class ConfigException : public Exception
+    {
+        public:
+            ConfigException(std::string message);
+    };
+
+    // Engine settings persisted as a small INI file:
+    //
+    //   [window]
+    //   title = "Game"
+    //   size = 1280 720
+    //   fullscreen = on
+    //
+    // Keys missing from the file keep the defaults the Config was created with.
+    class Config
+    {
+        public:
+            struct MonitorSettings
+            {
+                std::string mName;
+                V2ui32 mVideoMode;
+                uint32_t mRefreshRate;
+                float mGamma;
+            };
+
+            struct RendererSettings
+            {
+                V4f mBackground;
+                SwapController::Strategy mSwapStrategy;
+                bool mAutomaticSwap;
+                double mPresentRate;
+                Application::RenderMode mRenderMode;
+                double mIdleTimeout;
+                bool mResolutionScaling;
+                bool mDynamicResolution;
+                float mResolutionScale;
+            };
+
+            Config(const Application::Info& defaults);
+            Config(const Config& config);
+            Config& operator=(const Config& config);
+
+            void Load(const std::filesystem::path& path);
+            void Parse(std::string_view text, std::string_view source = "config");
+            void Save(const std::filesystem::path& path) const;
+
+            // Settings that need a running application: monitor, swap strategy,
+            // render mode and resolution scaling.
+            void Apply(Application& application) const;
+
+            // The window title points into the Config, which has to outlive
+            // the Application created from it.
+            [[nodiscard]] const Application::Info& GetInfo() const;
+            [[nodiscard]] Window::Info& GetWindowInfo();
+            [[nodiscard]] const Window::Info& GetWindowInfo() const;
+            [[nodiscard]] MonitorSettings& GetMonitorSettings();
+            [[nodiscard]] const MonitorSettings& GetMonitorSettings() const;
+            [[nodiscard]] RendererSettings& GetRendererSettings();
+            [[nodiscard]] const RendererSettings& GetRendererSettings() const;
+
+            void SetTitle(std::string title);
+        private:
+            void mValidate(std::string_view source) const;
+
+            Application::Info mInfo;
+            std::string mTitle;
+            MonitorSettings mMonitor;
+            RendererSettings mRenderer;
+    };
+}
+
+#endif // CONFIG_HPP
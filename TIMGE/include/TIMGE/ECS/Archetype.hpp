@@ -0,0 +1,81 @@
+#ifndef ECS_ARCHETYPE_HPP
+#define ECS_ARCHETYPE_HPP
+
+#include "Component.hpp"
+#include "Entity.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace TIMGE::ECS
+{
+    static constexpr std::size_t CHUNK_SIZE = 16 * 1024;
+
+    struct alignas(64) Chunk
+    {
+        std::byte mData[CHUNK_SIZE];
+        uint32_t mCount;
+    };
+
+    class Archetype
+    {
+        public:
+            Archetype(Signature signature);
+            ~Archetype();
+
+            Archetype(const Archetype&) = delete;
+            Archetype& operator=(const Archetype&) = delete;
+
+            [[nodiscard]] Signature GetSignature() const;
+            [[nodiscard]] const std::vector<ComponentID>& GetComponents() const;
+            [[nodiscard]] bool HasComponent(ComponentID id) const;
+            [[nodiscard]] uint32_t GetChunkCapacity() const;
+            [[nodiscard]] std::size_t GetChunkCount() const;
+            [[nodiscard]] std::size_t GetEntityCount() const;
+            [[nodiscard]] Chunk& GetChunk(std::size_t index) const;
+
+            [[nodiscard]] Entity* GetEntities(Chunk& chunk) const;
+            [[nodiscard]] void* GetColumn(Chunk& chunk, ComponentID id) const;
+
+            template<typename Type_T>
+            [[nodiscard]] Type_T* GetColumn(Chunk& chunk) const;
+        private:
+            struct Location
+            {
+                uint32_t mChunk;
+                uint32_t mRow;
+            };
+
+            [[nodiscard]] Location mAllocate(Entity entity);
+            [[nodiscard]] Entity mRemove(Location location);
+            [[nodiscard]] void* mGetComponent(Location location, ComponentID id) const;
+            void mComputeLayout();
+
+            static constexpr uint32_t mNO_COLUMN = std::numeric_limits<uint32_t>::max();
+
+            Signature mSignature;
+            std::vector<ComponentID> mComponents;
+            std::array<uint32_t, MAX_COMPONENTS> mOffsets;
+            uint32_t mCapacity;
+            std::size_t mEntityCount;
+
+            std::vector<std::unique_ptr<Chunk>> mChunks;
+            std::unique_ptr<Chunk> mSpareChunk;
+
+            std::array<Archetype*, MAX_COMPONENTS> mAddEdges;
+            std::array<Archetype*, MAX_COMPONENTS> mRemoveEdges;
+
+            friend class World;
+    };
+
+    template<typename Type_T>
+    [[nodiscard]] Type_T* Archetype::GetColumn(Chunk& chunk) const {
+        return static_cast<Type_T*>(GetColumn(chunk, Component::GetID<Type_T>()));
+    }
+}
+
+#endif // ECS_ARCHETYPE_HPP
@@ -0,0 +1,200 @@
+#ifndef ECS_QUERY_HPP
+#define ECS_QUERY_HPP
+
+#include "Archetype.hpp"
+#include "Component.hpp"
+#include "Entity.hpp"
+#include "TIMGE/JobSystem.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace TIMGE::ECS
+{
+    template<typename... Components_T>
+    class ChunkView
+    {
+        public:
+            ChunkView(Archetype& archetype, Chunk& chunk);
+
+            [[nodiscard]] uint32_t GetCount() const;
+            [[nodiscard]] Entity* GetEntities() const;
+
+            template<typename Type_T>
+            [[nodiscard]] Type_T* Get() const;
+        private:
+            uint32_t mCount;
+            Entity* mEntities;
+            std::tuple<Components_T*...> mColumns;
+    };
+
+    // Systems scheduled side by side share their queries, so the cached
+    // archetype list is refreshed under a lock and chunk lists are gathered per
+    // call. New archetypes may only appear while no query is being iterated.
+    class QueryBase
+    {
+        public:
+            QueryBase(Signature signature, const std::vector<Archetype*>& archetypes);
+            virtual ~QueryBase() = default;
+
+            [[nodiscard]] Signature GetSignature() const;
+            [[nodiscard]] const std::vector<Archetype*>& GetArchetypes();
+            [[nodiscard]] std::size_t GetEntityCount();
+        protected:
+            void mRefresh();
+            [[nodiscard]] std::vector<std::pair<Archetype*, Chunk*>> mGatherChunks() const;
+
+            Signature mSignature;
+            const std::vector<Archetype*>& mWorldArchetypes;
+            std::vector<Archetype*> mArchetypes;
+            std::size_t mArchetypesSeen;
+            std::mutex mMutex;
+    };
+
+    template<typename... Components_T>
+    class Query : public QueryBase
+    {
+        public:
+            Query(const std::vector<Archetype*>& archetypes);
+
+            template<typename Function_T>
+            void ForEach(Function_T&& function);
+
+            template<typename Function_T>
+            void ForEachChunk(Function_T&& function);
+
+            template<typename Function_T>
+            void ParallelForEach(JobSystem& jobSystem, Function_T&& function);
+
+            template<typename Function_T>
+            void ParallelForEachChunk(JobSystem& jobSystem, Function_T&& function);
+        private:
+            template<typename Function_T>
+            static void mIterate(ChunkView<Components_T...>& view, Function_T& function);
+    };
+
+    template<typename... Components_T>
+    ChunkView<Components_T...>::ChunkView(Archetype& archetype, Chunk& chunk)
+     : mCount{chunk.mCount},
+       mEntities{archetype.GetEntities(chunk)},
+       mColumns{archetype.GetColumn<std::remove_const_t<Components_T>>(chunk)...}
+    {}
+
+    template<typename... Components_T>
+    [[nodiscard]] uint32_t ChunkView<Components_T...>::GetCount() const {
+        return mCount;
+    }
+
+    template<typename... Components_T>
+    [[nodiscard]] Entity* ChunkView<Components_T...>::GetEntities() const {
+        return mEntities;
+    }
+
+    template<typename... Components_T>
+    template<typename Type_T>
+    [[nodiscard]] Type_T* ChunkView<Components_T...>::Get() const {
+        return std::get<Type_T*>(mColumns);
+    }
+
+    template<typename... Components_T>
+    Query<Components_T...>::Query(const std::vector<Archetype*>& archetypes)
+     : QueryBase(Component::GetSignature<Components_T...>(), archetypes)
+    {}
+
+    template<typename... Components_T>
+    template<typename Function_T>
+    void Query<Components_T...>::ForEach(Function_T&& function)
+    {
+        mRefresh();
+        for (Archetype* archetype : mArchetypes)
+        {
+            for (std::size_t i = 0; i < archetype->GetChunkCount(); i++)
+            {
+                ChunkView<Components_T...> view(*archetype, archetype->GetChunk(i));
+                mIterate(view, function);
+            }
+        }
+    }
+
+    template<typename... Components_T>
+    template<typename Function_T>
+    void Query<Components_T...>::ForEachChunk(Function_T&& function)
+    {
+        mRefresh();
+        for (Archetype* archetype : mArchetypes)
+        {
+            for (std::size_t i = 0; i < archetype->GetChunkCount(); i++)
+            {
+                ChunkView<Components_T...> view(*archetype, archetype->GetChunk(i));
+                function(view);
+            }
+        }
+    }
+
+    template<typename... Components_T>
+    template<typename Function_T>
+    void Query<Components_T...>::ParallelForEach(JobSystem& jobSystem, Function_T&& function)
+    {
+        mRefresh();
+        std::vector<std::pair<Archetype*, Chunk*>> chunks = mGatherChunks();
+
+        jobSystem.ParallelFor(static_cast<uint32_t>(chunks.size()), 1,
+            [&chunks, &function](uint32_t begin, uint32_t end, uint32_t)
+            {
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    ChunkView<Components_T...> view(*chunks[i].first, *chunks[i].second);
+                    mIterate(view, function);
+                }
+            }
+        );
+    }
+
+    template<typename... Components_T>
+    template<typename Function_T>
+    void Query<Components_T...>::ParallelForEachChunk(JobSystem& jobSystem, Function_T&& function)
+    {
+        mRefresh();
+        std::vector<std::pair<Archetype*, Chunk*>> chunks = mGatherChunks();
+
+        jobSystem.ParallelFor(static_cast<uint32_t>(chunks.size()), 1,
+            [&chunks, &function](uint32_t begin, uint32_t end, uint32_t workerIndex)
+            {
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    ChunkView<Components_T...> view(*chunks[i].first, *chunks[i].second);
+                    function(view, workerIndex);
+                }
+            }
+        );
+    }
+
+    template<typename... Components_T>
+    template<typename Function_T>
+    void Query<Components_T...>::mIterate(ChunkView<Components_T...>& view, Function_T& function)
+    {
+        std::tuple<Components_T*...> columns{ view.template Get<Components_T>()... };
+        uint32_t count = view.GetCount();
+
+        if constexpr (std::is_invocable_v<Function_T&, Entity, Components_T&...>)
+        {
+            Entity* entities = view.GetEntities();
+            for (uint32_t i = 0; i < count; i++) {
+                function(entities[i], std::get<Components_T*>(columns)[i]...);
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; i++) {
+                function(std::get<Components_T*>(columns)[i]...);
+            }
+        }
+    }
+}
+
+#endif // ECS_QUERY_HPP
@@ -0,0 +1,134 @@
+#ifndef ECS_SCHEDULER_HPP
+#define ECS_SCHEDULER_HPP
+
+#include "CommandBuffer.hpp"
+#include "Component.hpp"
+#include "World.hpp"
+#include "TIMGE/JobSystem.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TIMGE::ECS
+{
+    class SchedulerException : public Exception
+    {
+        public:
+            SchedulerException(std::string message);
+    };
+
+    enum class Stage : uint8_t
+    {
+        PRE_UPDATE,
+        UPDATE,
+        POST_UPDATE,
+        COUNT
+    };
+
+    template<typename... Components_T>
+    struct Read
+    {
+        [[nodiscard]] static Signature GetSignature() { return Component::GetSignature<Components_T...>(); }
+    };
+
+    template<typename... Components_T>
+    struct Write
+    {
+        [[nodiscard]] static Signature GetSignature() { return Component::GetSignature<Components_T...>(); }
+    };
+
+    // Systems without conflicting signatures run at the same time on the same
+    // world. They may look up and iterate queries, but structural changes have
+    // to be recorded in mCommands, which run once the stage is done.
+    struct SystemContext
+    {
+        World& mWorld;
+        CommandBuffer& mCommands;
+        JobSystem& mJobSystem;
+        double mDeltaTime;
+        uint32_t mWorkerIndex;
+    };
+
+    class Scheduler
+    {
+        public:
+            using System_T = std::function<void(SystemContext& context)>;
+
+            static constexpr Signature EXCLUSIVE = ~Signature{0};
+
+            Scheduler();
+
+            Scheduler(const Scheduler&) = delete;
+            Scheduler& operator=(const Scheduler&) = delete;
+
+            void AddSystem(std::string name, Stage stage, Signature reads, Signature writes, System_T system);
+            template<typename Read_T, typename Write_T = Write<>>
+            void AddSystem(std::string name, Stage stage, System_T system);
+            void RemoveSystem(std::string_view name);
+            void Clear();
+
+            void Run(Stage stage, World& world, JobSystem& jobSystem, double deltaTime);
+
+            [[nodiscard]] std::size_t GetSystemCount(Stage stage) const;
+            [[nodiscard]] std::vector<std::string_view> GetCriticalPath(Stage stage);
+            [[nodiscard]] double GetCriticalPathTime(Stage stage);
+            [[nodiscard]] std::string Dump();
+            [[nodiscard]] std::string DumpGraphviz();
+        private:
+            struct Graph;
+
+            struct Node
+            {
+                std::string mName;
+                Signature mReads;
+                Signature mWrites;
+                System_T mSystem;
+                CommandBuffer mCommands;
+                std::vector<uint32_t> mPredecessors;
+                std::vector<uint32_t> mSuccessors;
+                std::atomic<uint32_t> mPending;
+                double mMilliseconds;
+                Graph* mGraph;
+            };
+
+            struct Graph
+            {
+                std::vector<std::unique_ptr<Node>> mNodes;
+                std::vector<uint32_t> mRoots;
+                std::vector<uint32_t> mCriticalPath;
+                double mCriticalPathTime;
+                bool mDirty;
+
+                World* mWorld;
+                JobSystem* mJobSystem;
+                JobSystem::Counter* mCounter;
+                double mDeltaTime;
+                std::mutex mErrorMutex;
+                std::exception_ptr mError;
+            };
+
+            void mBuild(Graph& graph);
+            void mComputeCriticalPath(Graph& graph);
+            static void mSubmit(Node& node);
+            static void mExecute(void* data, uint32_t workerIndex);
+            [[nodiscard]] static bool mConflicts(const Node& first, const Node& second);
+            [[nodiscard]] static std::string mFormatSignature(Signature signature);
+
+            std::array<Graph, static_cast<std::size_t>(Stage::COUNT)> mGraphs;
+    };
+
+    template<typename Read_T, typename Write_T>
+    void Scheduler::AddSystem(std::string name, Stage stage, System_T system) {
+        AddSystem(std::move(name), stage, Read_T::GetSignature(), Write_T::GetSignature(), std::move(system));
+    }
+}
+
+#endif // ECS_SCHEDULER_HPP
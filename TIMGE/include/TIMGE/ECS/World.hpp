@@ -0,0 +1,180 @@
+#ifndef ECS_WORLD_HPP
+#define ECS_WORLD_HPP
+
+#include "Archetype.hpp"
+#include "CommandBuffer.hpp"
+#include "Component.hpp"
+#include "Entity.hpp"
+#include "Query.hpp"
+#include "TIMGE/Utils/HandlePool.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace TIMGE::ECS
+{
+    class World
+    {
+        public:
+            World();
+            ~World();
+
+            World(const World&) = delete;
+            World& operator=(const World&) = delete;
+
+            [[maybe_unused]] Entity CreateEntity();
+            template<typename... Components_T>
+            [[maybe_unused]] Entity CreateEntity(Components_T&&... components);
+            template<typename... Components_T>
+            void CreateEntities(std::size_t count, const Components_T&... components);
+            void DestroyEntity(Entity entity);
+
+            template<typename Type_T, typename... Args_T>
+            [[maybe_unused]] Type_T& AddComponent(Entity entity, Args_T&&... args);
+            template<typename Type_T>
+            void RemoveComponent(Entity entity);
+
+            template<typename Type_T>
+            [[nodiscard]] Type_T& GetComponent(Entity entity);
+            template<typename Type_T>
+            [[nodiscard]] bool HasComponent(Entity entity) const;
+
+            // Safe to call from systems running side by side.
+            template<typename... Components_T>
+            [[nodiscard]] Query<Components_T...>& GetQuery();
+
+            void Execute(CommandBuffer& commandBuffer);
+            void Clear();
+
+            [[nodiscard]] bool IsAlive(Entity entity) const;
+            [[nodiscard]] std::size_t GetEntityCount() const;
+            [[nodiscard]] const std::vector<Archetype*>& GetArchetypes() const;
+        private:
+            [[nodiscard]] Archetype& mGetArchetype(Signature signature);
+            [[nodiscard]] Archetype& mGetAddTarget(Archetype& archetype, ComponentID id);
+            [[nodiscard]] Archetype& mGetRemoveTarget(Archetype& archetype, ComponentID id);
+            [[nodiscard]] EntityRecord& mGetRecord(Entity entity);
+
+            [[nodiscard]] Entity mCreate(Archetype& archetype);
+            [[nodiscard]] void* mAddComponent(Entity entity, ComponentID id);
+            void mRemoveComponent(Entity entity, ComponentID id);
+            void mMove(Entity entity, EntityRecord& record, Archetype& target);
+            void mRemoveRow(EntityRecord& record);
+
+            [[nodiscard]] static std::size_t mNextQueryIndex();
+            template<typename... Components_T>
+            [[nodiscard]] static std::size_t mGetQueryIndex();
+
+            HandlePool<EntityRecord> mEntities;
+            std::unordered_map<Signature, std::unique_ptr<Archetype>> mArchetypeMap;
+            std::vector<Archetype*> mArchetypes;
+            std::vector<std::unique_ptr<QueryBase>> mQueries;
+            std::mutex mQueryMutex;
+    };
+
+    template<typename... Components_T>
+    [[maybe_unused]] Entity World::CreateEntity(Components_T&&... components)
+    {
+        Signature signature = Component::GetSignature<Components_T...>();
+        if (std::popcount(signature) != sizeof...(Components_T)) {
+            throw ECSException("An entity cannot contain the same component twice.");
+        }
+
+        Archetype& archetype = mGetArchetype(signature);
+        Entity entity = mCreate(archetype);
+        const EntityRecord& record = mEntities.Get(entity);
+
+        Archetype::Location location{ record.mChunk, record.mRow };
+        (new (archetype.mGetComponent(location, Component::GetID<Components_T>()))
+            std::remove_cvref_t<Components_T>(std::forward<Components_T>(components)), ...);
+
+        return entity;
+    }
+
+    template<typename... Components_T>
+    void World::CreateEntities(std::size_t count, const Components_T&... components)
+    {
+        Signature signature = Component::GetSignature<Components_T...>();
+        if (std::popcount(signature) != sizeof...(Components_T)) {
+            throw ECSException("An entity cannot contain the same component twice.");
+        }
+
+        Archetype& archetype = mGetArchetype(signature);
+        mEntities.Reserve(mEntities.GetSize() + count);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            Entity entity = mCreate(archetype);
+            const EntityRecord& record = mEntities.Get(entity);
+
+            Archetype::Location location{ record.mChunk, record.mRow };
+            (new (archetype.mGetComponent(location, Component::GetID<Components_T>())) Components_T(components), ...);
+        }
+    }
+
+    template<typename Type_T, typename... Args_T>
+    [[maybe_unused]] Type_T& World::AddComponent(Entity entity, Args_T&&... args)
+    {
+        void* component = mAddComponent(entity, Component::GetID<Type_T>());
+        return *new (component) Type_T(std::forward<Args_T>(args)...);
+    }
+
+    template<typename Type_T>
+    void World::RemoveComponent(Entity entity) {
+        mRemoveComponent(entity, Component::GetID<Type_T>());
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] Type_T& World::GetComponent(Entity entity)
+    {
+        EntityRecord& record = mGetRecord(entity);
+        ComponentID id = Component::GetID<Type_T>();
+
+        if (!record.mArchetype->HasComponent(id)) {
+            throw ECSException("Entity does not have the requested component.");
+        }
+
+        return *static_cast<Type_T*>(record.mArchetype->mGetComponent({ record.mChunk, record.mRow }, id));
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] bool World::HasComponent(Entity entity) const
+    {
+        const EntityRecord* record = mEntities.TryGet(entity);
+        return record && record->mArchetype->HasComponent(Component::GetID<Type_T>());
+    }
+
+    template<typename... Components_T>
+    [[nodiscard]] Query<Components_T...>& World::GetQuery()
+    {
+        std::size_t index = mGetQueryIndex<Components_T...>();
+
+        std::lock_guard lock(mQueryMutex);
+        if (index >= mQueries.size()) {
+            mQueries.resize(index + 1);
+        }
+
+        if (!mQueries[index]) {
+            mQueries[index] = std::make_unique<Query<Components_T...>>(mArchetypes);
+        }
+
+        return static_cast<Query<Components_T...>&>(*mQueries[index]);
+    }
+
+    template<typename... Components_T>
+    [[nodiscard]] std::size_t World::mGetQueryIndex()
+    {
+        static const std::size_t index = mNextQueryIndex();
+        return index;
+    }
+}
+
+#endif // ECS_WORLD_HPP
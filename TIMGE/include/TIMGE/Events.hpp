@@ -0,0 +1,138 @@
+#ifndef EVENTS_HPP
+#define EVENTS_HPP
+
+#include "Keyboard.hpp"
+#include "Mouse.hpp"
+#include "Utils/Vector.hpp"
+
+#include <span>
+#include <string_view>
+
+namespace TIMGE
+{
+    struct ErrorEvent
+    {
+        int mErrorCode;
+        std::string_view mDescription;
+    };
+
+    struct WindowPosEvent
+    {
+        Window* mWindow;
+        V2i32 mPosition;
+    };
+
+    struct WindowSizeEvent
+    {
+        Window* mWindow;
+        V2ui32 mSize;
+    };
+
+    struct WindowCloseEvent
+    {
+        Window* mWindow;
+    };
+
+    struct WindowRefreshEvent
+    {
+        Window* mWindow;
+    };
+
+    struct WindowFocusEvent
+    {
+        Window* mWindow;
+        bool mFocused;
+    };
+
+    struct WindowIconifyEvent
+    {
+        Window* mWindow;
+        bool mIconified;
+    };
+
+    struct WindowMaximizeEvent
+    {
+        Window* mWindow;
+        bool mMaximized;
+    };
+
+    struct FramebufferSizeEvent
+    {
+        Window* mWindow;
+        V2ui32 mFramebufferSize;
+    };
+
+    struct WindowContentScaleEvent
+    {
+        Window* mWindow;
+        V2f mContentScale;
+    };
+
+    struct MouseButtonEvent
+    {
+        Window* mWindow;
+        Button mButton;
+        Mouse::Action mAction;
+        Modifier mMods;
+    };
+
+    struct CursorPosEvent
+    {
+        Window* mWindow;
+        V2d mPosition;
+    };
+
+    struct CursorEnterEvent
+    {
+        Window* mWindow;
+        bool mEntered;
+    };
+
+    struct ScrollEvent
+    {
+        Window* mWindow;
+        V2d mOffset;
+    };
+
+    struct KeyEvent
+    {
+        Window* mWindow;
+        Key mKey;
+        int mScancode;
+        Keyboard::Action mAction;
+        Modifier mMods;
+    };
+
+    struct CharEvent
+    {
+        Window* mWindow;
+        unsigned int mCodepoint;
+    };
+
+    struct CharModsEvent
+    {
+        Window* mWindow;
+        unsigned int mCodepoint;
+        Modifier mMods;
+    };
+
+    struct DropEvent
+    {
+        Window* mWindow;
+        std::span<const char*> mPaths;
+    };
+
+    struct MonitorEvent
+    {
+        GLFWmonitor* mMonitor;
+        int mEvent;
+    };
+
+    struct JoystickEvent
+    {
+        int mJid;
+        int mEvent;
+    };
+}
+
+#endif // EVENTS_HPP
@@ -0,0 +1,135 @@
+#ifndef INPUT_ACTION_MAP_HPP
+#define INPUT_ACTION_MAP_HPP
+
+#include "Event.hpp"
+#include "TIMGE/Keyboard.hpp"
+#include "TIMGE/Mouse.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace TIMGE::Input
+{
+    using Action = uint16_t;
+    using Axis = uint16_t;
+
+    constexpr Action NULL_ACTION = UINT16_MAX;
+    constexpr Axis NULL_AXIS = UINT16_MAX;
+
+    enum class Device : uint8_t
+    {
+        KEYBOARD,
+        MOUSE,
+        GAMEPAD
+    };
+
+    struct Binding
+    {
+        Device mDevice;
+        int32_t mCode;
+        Modifier mModifiers;
+    };
+
+    class ActionMap
+    {
+        public:
+            static constexpr std::size_t MAX_ACTIONS = 128;
+            static constexpr std::size_t MAX_AXES = 32;
+            static constexpr std::size_t MAX_BINDINGS = 4;
+            static constexpr std::size_t KEY_COUNT = GLFW_KEY_LAST + 1;
+            static constexpr std::size_t BUTTON_COUNT = GLFW_MOUSE_BUTTON_LAST + 1;
+            static constexpr std::size_t GAMEPAD_BUTTON_COUNT = GLFW_GAMEPAD_BUTTON_LAST + 1;
+            static constexpr std::size_t GAMEPAD_AXIS_COUNT = GLFW_GAMEPAD_AXIS_LAST + 1;
+
+            ActionMap();
+
+            [[maybe_unused]] Action AddAction(std::string_view name);
+            [[maybe_unused]] Axis AddAxis(std::string_view name, Action negative, Action positive, int32_t gamepadAxis = -1);
+
+            // A binding belongs to one action at a time, binding it again moves
+            // it over. The string form takes "|" separated bindings and adds
+            // either all of them or none.
+            void Bind(Action action, const Binding& binding);
+            void Bind(Action action, std::string_view bindings);
+            void Rebind(Action action, std::size_t index, const Binding& binding);
+            void Unbind(Action action);
+            void Clear();
+
+            void NewFrame();
+            void OnKey(Key key, Keyboard::Action action, Modifier mods);
+            void OnMouseButton(Button button, Mouse::Action action, Modifier mods);
+            void OnGamepadButton(int32_t button, bool pressed);
+            void OnGamepadAxis(int32_t axis, float value);
+
+            [[nodiscard]] Action Resolve(Key key, Modifier mods) const;
+            [[nodiscard]] Action Resolve(Button button, Modifier mods) const;
+            [[nodiscard]] Action Resolve(const Binding& binding) const;
+
+            [[nodiscard]] bool IsDown(Action action) const;
+            [[nodiscard]] bool WasPressed(Action action) const;
+            [[nodiscard]] bool WasReleased(Action action) const;
+            [[nodiscard]] float GetAxis(Axis axis) const;
+
+            [[nodiscard]] Action GetAction(std::string_view name) const;
+            [[nodiscard]] Axis GetAxis(std::string_view name) const;
+            [[nodiscard]] std::string_view GetName(Action action) const;
+            [[nodiscard]] std::span<const Binding> GetBindings(Action action) const;
+            [[nodiscard]] std::size_t GetActionCount() const;
+
+            [[nodiscard]] static Binding ParseBinding(std::string_view binding);
+            [[nodiscard]] static std::string FormatBinding(const Binding& binding);
+        private:
+            static constexpr std::size_t mTABLE_SIZE = KEY_COUNT + BUTTON_COUNT + GAMEPAD_BUTTON_COUNT;
+            static constexpr std::size_t mSLOTS = 4;
+            static constexpr uint8_t mCHORD_MASK = GLFW_MOD_SHIFT | GLFW_MOD_CONTROL | GLFW_MOD_ALT | GLFW_MOD_SUPER;
+
+            struct Entry
+            {
+                uint8_t mModifiers;
+                Action mAction;
+            };
+
+            struct ActionData
+            {
+                std::string mName;
+                std::array<Binding, MAX_BINDINGS> mBindings;
+                uint8_t mBindingCount;
+                uint8_t mHeld;
+                bool mPressed;
+                bool mReleased;
+            };
+
+            struct AxisData
+            {
+                std::string mName;
+                Action mNegative;
+                Action mPositive;
+                int32_t mGamepadAxis;
+            };
+
+            [[nodiscard]] static std::size_t mGetSlot(const Binding& binding);
+            [[nodiscard]] static bool mSameInput(const Binding& first, const Binding& second);
+            [[nodiscard]] Action mLookup(std::size_t slot, uint8_t modifiers) const;
+            void mCheckAction(Action action) const;
+            void mBind(Action action, std::span<const Binding> bindings);
+            void mTake(Action action, const Binding& binding);
+            void mInsert(Action action, const Binding& binding);
+            void mCompile();
+            void mPress(std::size_t slot, uint8_t modifiers);
+            void mRelease(std::size_t slot);
+
+            std::array<std::array<Entry, mSLOTS>, mTABLE_SIZE> mTable;
+            std::array<Action, mTABLE_SIZE> mActive;
+            std::array<ActionData, MAX_ACTIONS> mActions;
+            std::array<AxisData, MAX_AXES> mAxes;
+            std::array<float, GAMEPAD_AXIS_COUNT> mGamepadAxes;
+            std::size_t mActionCount;
+            std::size_t mAxisCount;
+    };
+}
+
+#endif // INPUT_ACTION_MAP_HPP
@@ -0,0 +1,62 @@
+#ifndef INPUT_REPLAYER_HPP
+#define INPUT_REPLAYER_HPP
+
+#include "Event.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+struct GLFWwindow;
+
+namespace TIMGE
+{
+    class Application;
+}
+
+namespace TIMGE::Input
+{
+    class Replayer
+    {
+        public:
+            Replayer();
+            ~Replayer();
+
+            Replayer(const Replayer&) = delete;
+            Replayer& operator=(const Replayer&) = delete;
+
+            void Load(const std::filesystem::path& path);
+            void SetData(std::vector<uint8_t> data);
+
+            void Start(Application& application, bool pinDeltaTime = true);
+            void Stop();
+
+            [[nodiscard]] bool IsReplaying() const;
+            [[nodiscard]] bool IsDispatching() const;
+            [[nodiscard]] uint64_t GetFrame() const;
+            [[nodiscard]] std::size_t GetEventCount() const;
+
+            [[nodiscard]] static Replayer* GetActive();
+        private:
+            using EventProcessor_T = void (*)();
+
+            static void mProcessEvents();
+            void mDispatch(GLFWwindow* window, const Event& event);
+
+            std::vector<uint8_t> mData;
+            EventReader mReader;
+            Event mPending;
+            bool mHasPending;
+            bool mDispatching;
+            bool mPinDeltaTime;
+            Application* mApplication;
+            EventProcessor_T mPreviousProcessor;
+            uint64_t mFrame;
+            std::size_t mEventCount;
+
+            static Replayer* mActive;
+    };
+}
+
+#endif // INPUT_REPLAYER_HPP
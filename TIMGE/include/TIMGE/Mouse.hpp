@@ -1,9 +1,11 @@
 #ifndef MOUSE_HPP
 #define MOUSE_HPP
 
+#include "Utils/HandlePool.hpp"
 #include "Utils/Vector.hpp"
 #include "Window.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <vector>
@@ -40,14 +42,7 @@ namespace TIMGE
         MIDDLE = GLFW_MOUSE_BUTTON_MIDDLE
     };
 
-    struct Cursor
-    {
-        friend class Mouse;
-
-        private:
-            Cursor(uint64_t id) : mID{id} {}
-            uint64_t mID;
-    };
+    using Cursor = HandlePool<GLFWcursor*>::Handle_T;
 
     class MouseException : public Exception
     {
@@ -76,6 +71,13 @@ namespace TIMGE
                 std::vector<std::filesystem::path> mCursorPaths;
             };
 
+            struct Sample
+            {
+                V2d mPosition;
+                V2d mDelta;
+                double mTime;
+            };
+
             Mouse(const Info& info, Window& window);
             ~Mouse();
 
@@ -88,26 +90,50 @@ namespace TIMGE
             void Restore();
             void RawMotion();
 
-            [[maybe_unused]] Cursor& AddCursor(const std::filesystem::path& image);
-            [[maybe_unused]] Cursor& AddCursor(StandardCursor shape);
+            [[maybe_unused]] Cursor AddCursor(const std::filesystem::path& image);
+            [[maybe_unused]] Cursor AddCursor(StandardCursor shape);
             void DeleteCursor(const Cursor& cursor);
             void SetCursor(const Cursor& cursor);
             void ResetCursor();
 
+            void SetHistoryCapacity(std::size_t capacity);
+
             [[nodiscard]] const V2d& GetPosition() const;
             [[nodiscard]] const V2d& GetOffset() const;
+            [[nodiscard]] const V2d& GetDelta() const;
+            [[nodiscard]] const V2d& GetScroll() const;
+            [[nodiscard]] std::size_t GetHistoryCapacity() const;
+            [[nodiscard]] std::size_t GetHistorySize() const;
+            [[nodiscard]] std::size_t GetFrameSampleCount() const;
+            [[nodiscard]] const Sample& GetSample(std::size_t index) const;
             [[nodiscard]] bool GetState(FLAGS flags) const;
-            [[nodiscard]] std::vector<Cursor*> GetCursors();
+            [[nodiscard]] std::vector<Cursor> GetCursors() const;
 
             static RawMouseMotionSupported_t IsRawMouseMotionSupported;
         private:
+            void mNewFrame();
+            void mMove(const V2d& position);
+            void mEnter(bool entered);
+            void mAddScroll(const V2d& offset);
+            void mSetCursorMode(int mode);
+
             Window& mWindow;
 
             V2d mPosition;
             V2d mOffset;
+            V2d mDelta;
+            V2d mScroll;
             FLAGS mFlags;
+            // The last position is unknown right after a cursor mode change and
+            // when the cursor re-enters the window, so the next move has no delta.
+            bool mSkipDelta;
+
+            std::vector<Sample> mHistory;
+            std::size_t mHistoryStart;
+            std::size_t mHistorySize;
+            std::size_t mFrameSamples;
 
-            std::vector<std::pair<GLFWcursor*, Cursor>> mCursors;
+            HandlePool<GLFWcursor*> mCursors;
 
             friend class Application;
     };
@@ -0,0 +1,69 @@
+#ifndef PHYSICS_COLLIDE_HPP
+#define PHYSICS_COLLIDE_HPP
+
+#include "Shape.hpp"
+#include "TIMGE/Collision/AABB.hpp"
+
+#include <cstdint>
+
+namespace TIMGE::Physics
+{
+    struct Transform
+    {
+        V2f mPosition;
+        float mCos;
+        float mSin;
+
+        [[nodiscard]] V2f Apply(const V2f& point) const;
+        [[nodiscard]] V2f Rotate(const V2f& vector) const;
+        [[nodiscard]] V2f InverseApply(const V2f& point) const;
+        [[nodiscard]] V2f InverseRotate(const V2f& vector) const;
+    };
+
+    struct ManifoldPoint
+    {
+        V2f mPosition;
+        float mSeparation;
+        uint32_t mFeature;
+    };
+
+    struct Manifold
+    {
+        V2f mNormal;
+        ManifoldPoint mPoints[2];
+        uint32_t mPointCount;
+    };
+
+    [[nodiscard]] Manifold Collide(const Shape& shapeA, const Transform& transformA, const Shape& shapeB, const Transform& transformB);
+    [[nodiscard]] Collision::AABB ComputeAABB(const Shape& shape, const Transform& transform);
+
+    [[nodiscard]] inline float Dot(const V2f& first, const V2f& second) {
+        return first[V2f::X] * second[V2f::X] + first[V2f::Y] * second[V2f::Y];
+    }
+
+    [[nodiscard]] inline float Cross(const V2f& first, const V2f& second) {
+        return first[V2f::X] * second[V2f::Y] - first[V2f::Y] * second[V2f::X];
+    }
+
+    [[nodiscard]] inline V2f Transform::Apply(const V2f& point) const
+    {
+        return {
+            mCos * point[V2f::X] - mSin * point[V2f::Y] + mPosition[V2f::X],
+            mSin * point[V2f::X] + mCos * point[V2f::Y] + mPosition[V2f::Y]
+        };
+    }
+
+    [[nodiscard]] inline V2f Transform::Rotate(const V2f& vector) const {
+        return { mCos * vector[V2f::X] - mSin * vector[V2f::Y], mSin * vector[V2f::X] + mCos * vector[V2f::Y] };
+    }
+
+    [[nodiscard]] inline V2f Transform::InverseApply(const V2f& point) const {
+        return InverseRotate(point - mPosition);
+    }
+
+    [[nodiscard]] inline V2f Transform::InverseRotate(const V2f& vector) const {
+        return { mCos * vector[V2f::X] + mSin * vector[V2f::Y], -mSin * vector[V2f::X] + mCos * vector[V2f::Y] };
+    }
+}
+
+#endif // PHYSICS_COLLIDE_HPP
@@ -0,0 +1,59 @@
+#ifndef PHYSICS_SHAPE_HPP
+#define PHYSICS_SHAPE_HPP
+
+#include "TIMGE/Exception.hpp"
+#include "TIMGE/Utils/Vector.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace TIMGE::Physics
+{
+    class PhysicsException : public Exception
+    {
+        public:
+            PhysicsException(std::string message);
+    };
+
+    static constexpr uint32_t MAX_POLYGON_VERTICES = 8;
+
+    struct MassData
+    {
+        float mMass;
+        float mInertia;
+        V2f mCenter;
+    };
+
+    class Shape
+    {
+        public:
+            enum class Type : uint8_t
+            {
+                CIRCLE,
+                POLYGON
+            };
+
+            [[nodiscard]] static Shape Circle(float radius);
+            [[nodiscard]] static Shape Box(float halfWidth, float halfHeight);
+            [[nodiscard]] static Shape Polygon(std::span<const V2f> vertices);
+
+            [[nodiscard]] Type GetType() const;
+            [[nodiscard]] float GetRadius() const;
+            [[nodiscard]] uint32_t GetVertexCount() const;
+            [[nodiscard]] const V2f& GetVertex(uint32_t index) const;
+            [[nodiscard]] const V2f& GetNormal(uint32_t index) const;
+
+            [[nodiscard]] MassData ComputeMass(float density) const;
+        private:
+            Shape(Type type);
+
+            Type mType;
+            float mRadius;
+            uint32_t mVertexCount;
+            std::array<V2f, MAX_POLYGON_VERTICES> mVertices;
+            std::array<V2f, MAX_POLYGON_VERTICES> mNormals;
+    };
+}
+
+#endif // PHYSICS_SHAPE_HPP
@@ -0,0 +1,195 @@
+#ifndef PHYSICS_WORLD_HPP
+#define PHYSICS_WORLD_HPP
+
+#include "Collide.hpp"
+#include "Shape.hpp"
+#include "TIMGE/Collision/AABBTree.hpp"
+#include "TIMGE/JobSystem.hpp"
+#include "TIMGE/Utils/HandlePool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace TIMGE::Physics
+{
+    enum class BodyType : uint8_t
+    {
+        STATIC,
+        KINEMATIC,
+        DYNAMIC
+    };
+
+    struct BodyInfo
+    {
+        BodyType mType;
+        Shape mShape;
+        V2f mPosition;
+        float mAngle;
+        V2f mVelocity;
+        float mAngularVelocity;
+        float mDensity;
+        float mFriction;
+        float mRestitution;
+    };
+
+    struct BodyRecord
+    {
+        Collision::Proxy mProxy;
+    };
+
+    using Body = HandlePool<BodyRecord>::Handle_T;
+
+    class World
+    {
+        public:
+            World(const V2f& gravity = { 0.0f, -9.81f });
+
+            World(const World&) = delete;
+            World& operator=(const World&) = delete;
+
+            [[maybe_unused]] Body CreateBody(const BodyInfo& info);
+            void DestroyBody(Body body);
+            void Clear();
+
+            void Step(float timestep, JobSystem& jobSystem);
+
+            void SetGravity(const V2f& gravity);
+            void SetIterations(uint32_t iterations);
+            void SetTransform(Body body, const V2f& position, float angle);
+            void SetVelocity(Body body, const V2f& velocity);
+            void SetAngularVelocity(Body body, float angularVelocity);
+            void ApplyForce(Body body, const V2f& force);
+            void ApplyTorque(Body body, float torque);
+            void ApplyImpulse(Body body, const V2f& impulse);
+
+            [[nodiscard]] bool IsAlive(Body body) const;
+            [[nodiscard]] BodyType GetType(Body body) const;
+            [[nodiscard]] const Shape& GetShape(Body body) const;
+            [[nodiscard]] V2f GetPosition(Body body) const;
+            [[nodiscard]] float GetAngle(Body body) const;
+            [[nodiscard]] V2f GetVelocity(Body body) const;
+            [[nodiscard]] float GetAngularVelocity(Body body) const;
+            [[nodiscard]] const V2f& GetGravity() const;
+            [[nodiscard]] uint32_t GetIterations() const;
+            [[nodiscard]] std::size_t GetBodyCount() const;
+            [[nodiscard]] std::size_t GetContactCount() const;
+            [[nodiscard]] std::size_t GetIslandCount() const;
+        private:
+            struct Bodies
+            {
+                std::vector<BodyType> mType;
+                std::vector<Shape> mShape;
+                std::vector<float> mCenterX;
+                std::vector<float> mCenterY;
+                std::vector<float> mAngle;
+                std::vector<float> mLocalCenterX;
+                std::vector<float> mLocalCenterY;
+                std::vector<float> mVelocityX;
+                std::vector<float> mVelocityY;
+                std::vector<float> mAngularVelocity;
+                std::vector<float> mForceX;
+                std::vector<float> mForceY;
+                std::vector<float> mTorque;
+                std::vector<float> mInverseMass;
+                std::vector<float> mInverseInertia;
+                std::vector<float> mFriction;
+                std::vector<float> mRestitution;
+            };
+
+            struct Contact
+            {
+                uint64_t mKey;
+                uint32_t mBodyA;
+                uint32_t mBodyB;
+                Manifold mManifold;
+                float mNormalImpulse[2];
+                float mTangentImpulse[2];
+            };
+
+            struct CachedContact
+            {
+                uint64_t mKey;
+                uint32_t mPointCount;
+                uint32_t mFeatures[2];
+                float mNormalImpulse[2];
+                float mTangentImpulse[2];
+            };
+
+            struct Island
+            {
+                uint32_t mContactBegin;
+                uint32_t mContactEnd;
+            };
+
+            static constexpr uint32_t mLANES = 4;
+
+            struct ContactBatch
+            {
+                struct Point
+                {
+                    float mAnchorAX[mLANES];
+                    float mAnchorAY[mLANES];
+                    float mAnchorBX[mLANES];
+                    float mAnchorBY[mLANES];
+                    float mNormalMass[mLANES];
+                    float mTangentMass[mLANES];
+                    float mBias[mLANES];
+                    float mNormalImpulse[mLANES];
+                    float mTangentImpulse[mLANES];
+                };
+
+                uint32_t mCount;
+                uint32_t mContact[mLANES];
+                uint32_t mBodyA[mLANES];
+                uint32_t mBodyB[mLANES];
+                float mNormalX[mLANES];
+                float mNormalY[mLANES];
+                float mFriction[mLANES];
+                float mInverseMassA[mLANES];
+                float mInverseInertiaA[mLANES];
+                float mInverseMassB[mLANES];
+                float mInverseInertiaB[mLANES];
+                Point mPoints[2];
+            };
+
+            struct Scratch
+            {
+                std::vector<uint32_t> mLocalIndex;
+                std::vector<uint32_t> mGlobalIndex;
+                std::vector<float> mVelocityX;
+                std::vector<float> mVelocityY;
+                std::vector<float> mAngularVelocity;
+                std::vector<ContactBatch> mBatches;
+            };
+
+            [[nodiscard]] uint32_t mGetIndex(Body body) const;
+            [[nodiscard]] Transform mGetTransform(uint32_t index) const;
+            [[nodiscard]] uint64_t mGetPairKey(uint32_t first, uint32_t second) const;
+
+            void mIntegrateVelocities(float timestep);
+            void mUpdateBroadphase();
+            void mFindContacts(JobSystem& jobSystem);
+            void mBuildIslands();
+            void mSolveIsland(const Island& island, Scratch& scratch, float timestep);
+            void mBatchIsland(const Island& island, Scratch& scratch, float timestep);
+            void mIntegratePositions(float timestep);
+            void mStoreImpulses();
+
+            HandlePool<BodyRecord> mBodyRecords;
+            Bodies mBodies;
+            Collision::AABBTree mBroadphase;
+
+            std::vector<Collision::Pair> mPairs;
+            std::vector<Contact> mContacts;
+            std::vector<CachedContact> mCache;
+            std::vector<Island> mIslands;
+            std::vector<uint32_t> mIslandParents;
+            std::vector<Scratch> mScratch;
+
+            V2f mGravity;
+            uint32_t mIterations;
+    };
+}
+
+#endif // PHYSICS_WORLD_HPP
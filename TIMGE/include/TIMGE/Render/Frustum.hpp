@@ -0,0 +1,34 @@
+#ifndef RENDER_FRUSTUM_HPP
+#define RENDER_FRUSTUM_HPP
+
+#include <array>
+
+namespace TIMGE::Render
+{
+    using Mat4 = std::array<float, 16>;
+
+    class Frustum
+    {
+        public:
+            enum Plane
+            {
+                LEFT_PLANE,
+                RIGHT_PLANE,
+                BOTTOM_PLANE,
+                TOP_PLANE,
+                NEAR_PLANE,
+                FAR_PLANE,
+                PLANE_COUNT
+            };
+
+            Frustum() = default;
+            Frustum(const Mat4& viewProjection);
+
+            [[nodiscard]] bool Intersects(const std::array<float, 3>& center, float radius) const;
+            [[nodiscard]] const std::array<float, 4>& GetPlane(Plane plane) const;
+        private:
+            std::array<std::array<float, 4>, PLANE_COUNT> mPlanes;
+    };
+}
+
+#endif // RENDER_FRUSTUM_HPP
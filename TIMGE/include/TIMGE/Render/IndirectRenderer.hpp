@@ -0,0 +1,134 @@
+#ifndef RENDER_INDIRECT_RENDERER_HPP
+#define RENDER_INDIRECT_RENDERER_HPP
+
+#include "Frustum.hpp"
+#include "Shader.hpp"
+#include "TIMGE/Exception.hpp"
+#include "TIMGE/Utils/Vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace TIMGE::Render
+{
+    class IndirectRendererException : public Exception
+    {
+        public:
+            IndirectRendererException(std::string message);
+    };
+
+    class IndirectRenderer
+    {
+        public:
+            enum class Path
+            {
+                GPU,
+                CPU
+            };
+
+            struct Vertex
+            {
+                std::array<float, 3> mPosition;
+                std::array<float, 3> mNormal;
+            };
+
+            // On the GPU path mVisible is read back from the cull results without
+            // waiting on the GPU, so it trails the drawn frame by a few frames.
+            struct Statistics
+            {
+                uint32_t mObjects;
+                uint32_t mVisible;
+                uint32_t mDrawCalls;
+            };
+
+            IndirectRenderer();
+            ~IndirectRenderer();
+
+            IndirectRenderer(const IndirectRenderer&) = delete;
+            IndirectRenderer& operator=(const IndirectRenderer&) = delete;
+
+            [[nodiscard]] uint32_t AddMesh(std::span<const Vertex> vertices, std::span<const uint32_t> indices);
+            void Submit(uint32_t mesh, const Mat4& transform, const V4f& color);
+            void Render(const Mat4& viewProjection);
+
+            void SetPath(Path path);
+
+            [[nodiscard]] Path GetPath() const;
+            [[nodiscard]] bool IsGpuSupported() const;
+            [[nodiscard]] std::size_t GetMeshCount() const;
+            [[nodiscard]] const Statistics& GetStatistics() const;
+        private:
+            struct Mesh
+            {
+                uint32_t mFirstIndex;
+                uint32_t mIndexCount;
+                std::array<float, 3> mCenter;
+                float mRadius;
+            };
+
+            struct Object
+            {
+                Mat4 mTransform;
+                std::array<float, 4> mColor;
+                std::array<float, 4> mSphere;
+                std::array<uint32_t, 4> mMesh;
+            };
+
+            struct DrawCommand
+            {
+                GLuint mCount;
+                GLuint mInstanceCount;
+                GLuint mFirstIndex;
+                GLint mBaseVertex;
+                GLuint mBaseInstance;
+            };
+
+            static constexpr GLuint mCULL_GROUP_SIZE = 64;
+
+            void mRenderGpu(const Mat4& viewProjection);
+            void mRenderCpu(const Mat4& viewProjection);
+            void mCollectVisible();
+            void mUploadGeometry();
+            void mReserve(GLenum target, GLuint buffer, std::size_t& capacity, std::size_t size);
+
+            bool mGpuSupported;
+            Path mPath;
+            Statistics mStatistics;
+
+            std::vector<Vertex> mVertices;
+            std::vector<uint32_t> mIndices;
+            std::vector<Mesh> mMeshes;
+            std::vector<Object> mObjects;
+            std::vector<uint32_t> mMeshObjects;
+            std::vector<DrawCommand> mCommands;
+            std::vector<DrawCommand> mReadbackCommands;
+            bool mGeometryDirty;
+
+            GLuint mVertexBuffer;
+            GLuint mIndexBuffer;
+            GLuint mVertexArray;
+            GLuint mIndirectVertexArray;
+            GLuint mObjectBuffer;
+            GLuint mCommandBuffer;
+            GLuint mVisibleBuffer;
+            GLuint mReadbackBuffer;
+            std::size_t mObjectCapacity;
+            std::size_t mCommandCapacity;
+            std::size_t mVisibleCapacity;
+            std::size_t mReadbackCapacity;
+            GLsync mReadbackFence;
+            uint32_t mGpuVisible;
+
+            Shader mForwardShader;
+            std::optional<Shader> mIndirectShader;
+            std::optional<Shader> mCullShader;
+    };
+}
+
+#endif // RENDER_INDIRECT_RENDERER_HPP
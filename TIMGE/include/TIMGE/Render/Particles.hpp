@@ -0,0 +1,159 @@
+#ifndef RENDER_PARTICLES_HPP
+#define RENDER_PARTICLES_HPP
+
+#include "Frustum.hpp"
+#include "Shader.hpp"
+#include "TIMGE/Exception.hpp"
+#include "TIMGE/JobSystem.hpp"
+#include "TIMGE/Utils/Vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace TIMGE::Render
+{
+    class ParticlesException : public Exception
+    {
+        public:
+            ParticlesException(std::string message);
+    };
+
+    struct EmitterInfo
+    {
+        std::array<float, 3> mPosition;
+        std::array<float, 3> mVelocity;
+        // Each velocity component is jittered uniformly by up to this much.
+        std::array<float, 3> mVelocitySpread;
+        std::array<float, 3> mAcceleration;
+        float mDrag;
+        float mRate;
+        float mMinLifetime;
+        float mMaxLifetime;
+        float mStartSize;
+        float mEndSize;
+        V4f mStartColor;
+        V4f mEndColor;
+        uint32_t mCapacity;
+    };
+
+    struct ParticleInstance
+    {
+        std::array<float, 3> mPosition;
+        float mSize;
+        std::array<uint8_t, 4> mColor;
+    };
+
+    class ParticleSystem
+    {
+        public:
+            struct Statistics
+            {
+                uint32_t mAlive;
+                uint32_t mSpawned;
+                uint32_t mDied;
+            };
+
+            // Slots per chunk, the unit of work handed to the job system.
+            static constexpr uint32_t CHUNK_SIZE = 4096;
+
+            ParticleSystem();
+
+            [[maybe_unused]] uint32_t CreateEmitter(const EmitterInfo& info);
+            void SetEmitter(uint32_t emitter, const EmitterInfo& info);
+            void Emit(uint32_t emitter, uint32_t count);
+            void Clear();
+
+            void Update(float timestep, JobSystem& jobSystem);
+            void Update(float timestep);
+
+            [[nodiscard]] const EmitterInfo& GetEmitter(uint32_t emitter) const;
+            [[nodiscard]] std::size_t GetEmitterCount() const;
+            [[nodiscard]] std::size_t GetParticleCount() const;
+            [[nodiscard]] std::span<const ParticleInstance> GetInstances() const;
+            [[nodiscard]] const Statistics& GetStatistics() const;
+        private:
+            enum Field
+            {
+                POSITION_X,
+                POSITION_Y,
+                POSITION_Z,
+                VELOCITY_X,
+                VELOCITY_Y,
+                VELOCITY_Z,
+                AGE,
+                INVERSE_LIFETIME,
+                SIZE,
+                RED,
+                GREEN,
+                BLUE,
+                ALPHA,
+                FIELD_COUNT
+            };
+
+            // Slots are split into fixed chunks and particles only ever move
+            // within their chunk, so dead ones can be compacted in parallel
+            // without a global pass; free slots sit at the end of each chunk.
+            struct Emitter
+            {
+                EmitterInfo mInfo;
+                std::array<std::vector<float>, FIELD_COUNT> mFields;
+                std::vector<uint32_t> mChunkCounts;
+                uint32_t mCount;
+                float mAccumulator;
+                std::mt19937 mRandom;
+            };
+
+            struct Chunk
+            {
+                uint32_t mEmitter;
+                uint32_t mIndex;
+                uint32_t mCount;
+                uint32_t mAlive;
+                uint32_t mInstance;
+            };
+
+            [[nodiscard]] Emitter& mGetEmitter(uint32_t emitter);
+            [[nodiscard]] uint32_t mGetChunkCapacity(const Emitter& emitter, std::size_t chunk) const;
+            void mResize(Emitter& emitter);
+            uint32_t mSpawn(Emitter& emitter, uint32_t count);
+            void mBeginUpdate(float timestep);
+            void mSimulate(Chunk& chunk, float timestep);
+            void mEndSimulate();
+            void mPack(const Chunk& chunk);
+
+            std::vector<Emitter> mEmitters;
+            std::vector<Chunk> mChunks;
+            std::vector<ParticleInstance> mInstances;
+            Statistics mStatistics;
+            uint32_t mEmitted;
+    };
+
+    class ParticleRenderer
+    {
+        public:
+            ParticleRenderer();
+            ~ParticleRenderer();
+
+            ParticleRenderer(const ParticleRenderer&) = delete;
+            ParticleRenderer& operator=(const ParticleRenderer&) = delete;
+
+            // Particles are drawn as camera facing quads, so the view has to be
+            // passed separately from the projection.
+            void Render(const ParticleSystem& system, const Mat4& view, const Mat4& projection);
+        private:
+            GLuint mQuadBuffer;
+            GLuint mInstanceBuffer;
+            GLuint mVertexArray;
+            Shader mShader;
+            GLint mViewLocation;
+            GLint mProjectionLocation;
+    };
+}
+
+#endif // RENDER_PARTICLES_HPP
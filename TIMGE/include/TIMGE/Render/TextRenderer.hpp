@@ -0,0 +1,139 @@
+#ifndef RENDER_TEXT_RENDERER_HPP
+#define RENDER_TEXT_RENDERER_HPP
+
+#include "Shader.hpp"
+#include "TIMGE/Exception.hpp"
+#include "TIMGE/Utils/Vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace TIMGE::Render
+{
+    class TextRendererException : public Exception
+    {
+        public:
+            TextRendererException(std::string message);
+    };
+
+    class TextRenderer
+    {
+        public:
+            struct Statistics
+            {
+                uint32_t mGlyphs;
+                uint32_t mDrawCalls;
+                uint32_t mRasterized;
+                uint32_t mEvictions;
+                uint32_t mShapedRuns;
+                uint32_t mCachedRuns;
+            };
+
+            // Glyphs are rasterized once at this pixel height and scaled from
+            // the distance field at any draw size.
+            static constexpr uint32_t SDF_SIZE = 32;
+            static constexpr uint32_t SDF_PADDING = 4;
+            static constexpr uint32_t CELL_SIZE = 48;
+
+            TextRenderer(uint32_t atlasSize = 1024);
+            ~TextRenderer();
+
+            TextRenderer(const TextRenderer&) = delete;
+            TextRenderer& operator=(const TextRenderer&) = delete;
+
+            [[maybe_unused]] uint32_t LoadFont(const std::filesystem::path& path);
+            [[maybe_unused]] uint32_t LoadFont(std::vector<uint8_t> data);
+
+            void Draw(uint32_t font, std::string_view text, const V2f& position, float size, const V4f& color);
+            void DrawStatic(uint32_t font, std::string_view text, const V2f& position, float size, const V4f& color);
+            void Render();
+
+            [[nodiscard]] V2f Measure(uint32_t font, std::string_view text, float size);
+            [[nodiscard]] std::size_t GetFontCount() const;
+            [[nodiscard]] uint32_t GetCellCount() const;
+            [[nodiscard]] uint32_t GetUsedCellCount() const;
+            [[nodiscard]] GLuint GetAtlasTexture() const;
+            [[nodiscard]] const Statistics& GetStatistics() const;
+        private:
+            struct Font;
+
+            struct ShapedGlyph
+            {
+                uint32_t mGlyph;
+                float mX;
+                float mY;
+            };
+
+            struct Run
+            {
+                std::vector<ShapedGlyph> mGlyphs;
+                std::vector<uint32_t> mCells;
+                uint64_t mGeneration;
+                uint64_t mLastFrame;
+                V2f mSize;
+            };
+
+            struct Cell
+            {
+                uint64_t mKey;
+                uint64_t mLastFrame;
+                uint32_t mPrevious;
+                uint32_t mNext;
+                std::array<float, 4> mPlane;
+                std::array<float, 4> mUV;
+            };
+
+            struct TextVertex
+            {
+                float mX;
+                float mY;
+                float mU;
+                float mV;
+                std::array<uint8_t, 4> mColor;
+            };
+
+            static constexpr uint32_t mNONE = UINT32_MAX;
+            static constexpr uint64_t mRUN_LIFETIME = 300;
+
+            [[nodiscard]] Font& mGetFont(uint32_t font);
+            void mShape(Font& font, std::string_view text, Run& run);
+            void mEmit(uint32_t font, Run& run, const V2f& position, float size, const V4f& color);
+            [[nodiscard]] uint32_t mAcquireCell(uint32_t font, uint32_t glyph);
+            [[nodiscard]] uint32_t mRasterize(uint32_t font, uint32_t glyph, uint64_t key);
+            void mTouch(uint32_t cell);
+            void mUnlink(uint32_t cell);
+            void mPushFront(uint32_t cell);
+            void mFlush();
+
+            uint32_t mAtlasSize;
+            uint32_t mCellsPerRow;
+            std::vector<Cell> mCells;
+            std::unordered_map<uint64_t, uint32_t> mGlyphCells;
+            uint32_t mHead;
+            uint32_t mTail;
+            uint32_t mUsedCells;
+            uint64_t mGeneration;
+            uint64_t mFrame;
+
+            std::vector<std::unique_ptr<Font>> mFonts;
+            std::vector<TextVertex> mVertices;
+            Run mScratch;
+            Statistics mStatistics;
+            Statistics mFrameStatistics;
+
+            GLuint mAtlas;
+            GLuint mVertexBuffer;
+            GLuint mVertexArray;
+            Shader mShader;
+    };
+}
+
+#endif // RENDER_TEXT_RENDERER_HPP
@@ -0,0 +1,88 @@
+#ifndef RESOLUTION_SCALER_HPP
+#define RESOLUTION_SCALER_HPP
+
+#include "Exception.hpp"
+#include "Utils/Vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <glad/glad.h>
+
+namespace TIMGE
+{
+    class ResolutionScalerException : public Exception
+    {
+        public:
+            ResolutionScalerException(std::string message);
+    };
+
+    class ResolutionScaler
+    {
+        public:
+            static constexpr float MIN_SCALE = 0.25f;
+            static constexpr float MAX_SCALE = 2.0f;
+
+            ResolutionScaler();
+            ~ResolutionScaler();
+
+            ResolutionScaler(const ResolutionScaler&) = delete;
+            ResolutionScaler& operator=(const ResolutionScaler&) = delete;
+
+            void SetEnabled(bool enabled);
+            void SetDynamic(bool dynamic);
+            void SetScale(float scale);
+            void SetScaleLimits(float minScale, float maxScale);
+            void SetTargetFrameTime(double frameTime);
+
+            void BeginScene(const V2ui32& framebufferSize, const V4f& background);
+            void EndScene();
+            void Present(const V2ui32& framebufferSize);
+
+            [[nodiscard]] bool IsEnabled() const;
+            [[nodiscard]] bool IsDynamic() const;
+            [[nodiscard]] float GetScale() const;
+            [[nodiscard]] float GetMinScale() const;
+            [[nodiscard]] float GetMaxScale() const;
+            [[nodiscard]] double GetTargetFrameTime() const;
+            [[nodiscard]] double GetGpuTime() const;
+            [[nodiscard]] const V2ui32& GetRenderSize() const;
+            [[nodiscard]] GLuint GetColorTexture() const;
+        private:
+            static constexpr std::size_t mQUERY_COUNT = 4;
+            static constexpr uint32_t mSIZE_ALIGNMENT = 8;
+            static constexpr uint32_t mRESIZE_COOLDOWN = 15;
+            static constexpr double mSMOOTHING = 0.15;
+            static constexpr double mHEADROOM = 0.85;
+            static constexpr float mSCALE_STEP = 0.02f;
+
+            void mCreate();
+            void mRelease();
+            void mResize(const V2ui32& renderSize);
+            void mCollectTimings();
+            void mAdjust();
+
+            bool mEnabled;
+            bool mDynamic;
+            float mScale;
+            float mMinScale;
+            float mMaxScale;
+            double mTargetFrameTime;
+            double mGpuTime;
+            uint32_t mCooldown;
+
+            V2ui32 mRenderSize;
+
+            GLuint mFramebuffer;
+            GLuint mColorTexture;
+            GLuint mDepthBuffer;
+
+            std::array<GLuint, mQUERY_COUNT> mQueries;
+            std::array<bool, mQUERY_COUNT> mQueryPending;
+            std::size_t mNextQuery;
+            bool mTiming;
+    };
+}
+
+#endif // RESOLUTION_SCALER_HPP
@@ -0,0 +1,310 @@
+#ifndef UTILS_HANDLEPOOL_HPP
+#define UTILS_HANDLEPOOL_HPP
+
+#include "TIMGE/Exception.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace TIMGE
+{
+    class HandlePoolException : public Exception
+    {
+        public:
+            HandlePoolException(std::string message);
+    };
+
+    template<typename Type_T> class HandlePool;
+
+    template<typename Tag_T> class Handle
+    {
+        public:
+            Handle();
+
+            [[nodiscard]] bool operator==(const Handle<Tag_T>& handle) const;
+            [[nodiscard]] bool operator!=(const Handle<Tag_T>& handle) const;
+
+            [[nodiscard]] bool IsNull() const;
+            [[nodiscard]] uint32_t GetIndex() const;
+            [[nodiscard]] uint32_t GetGeneration() const;
+        private:
+            Handle(uint32_t index, uint32_t generation);
+
+            uint32_t mIndex;
+            uint32_t mGeneration;
+
+            friend class HandlePool<Tag_T>;
+    };
+
+    template<typename Type_T> class HandlePool
+    {
+        public:
+            using Handle_T = Handle<Type_T>;
+
+            HandlePool() = default;
+            HandlePool(std::size_t capacity);
+
+            template<typename... Args_T>
+            [[maybe_unused]] Handle_T Add(Args_T&&... args);
+            void Remove(Handle_T handle);
+            void Clear();
+            void Reserve(std::size_t capacity);
+
+            [[nodiscard]] bool Contains(Handle_T handle) const;
+            [[nodiscard]] Type_T& Get(Handle_T handle);
+            [[nodiscard]] const Type_T& Get(Handle_T handle) const;
+            [[nodiscard]] Type_T* TryGet(Handle_T handle);
+            [[nodiscard]] const Type_T* TryGet(Handle_T handle) const;
+            [[nodiscard]] Handle_T GetHandle(std::size_t denseIndex) const;
+            [[nodiscard]] std::size_t GetDenseIndex(Handle_T handle) const;
+            [[nodiscard]] std::size_t GetSize() const;
+            [[nodiscard]] bool IsEmpty() const;
+
+            [[nodiscard]] Type_T* begin();
+            [[nodiscard]] Type_T* end();
+            [[nodiscard]] const Type_T* begin() const;
+            [[nodiscard]] const Type_T* end() const;
+        private:
+            static constexpr uint32_t mNULL_INDEX = std::numeric_limits<uint32_t>::max();
+
+            struct Slot
+            {
+                uint32_t mDenseIndex;
+                uint32_t mGeneration;
+            };
+
+            [[nodiscard]] const Slot* mFindSlot(Handle_T handle) const;
+
+            std::vector<Slot> mSlots;
+            std::vector<Type_T> mDense;
+            std::vector<uint32_t> mDenseToSlot;
+            uint32_t mFreeHead = mNULL_INDEX;
+    };
+
+    template<typename Tag_T>
+    Handle<Tag_T>::Handle()
+     : mIndex{0},
+       mGeneration{0}
+    {}
+
+    template<typename Tag_T>
+    Handle<Tag_T>::Handle(uint32_t index, uint32_t generation)
+     : mIndex{index},
+       mGeneration{generation}
+    {}
+
+    template<typename Tag_T>
+    [[nodiscard]] bool Handle<Tag_T>::operator==(const Handle<Tag_T>& handle) const {
+        return mIndex == handle.mIndex && mGeneration == handle.mGeneration;
+    }
+
+    template<typename Tag_T>
+    [[nodiscard]] bool Handle<Tag_T>::operator!=(const Handle<Tag_T>& handle) const {
+        return !(*this == handle);
+    }
+
+    template<typename Tag_T>
+    [[nodiscard]] bool Handle<Tag_T>::IsNull() const {
+        return mGeneration == 0;
+    }
+
+    template<typename Tag_T>
+    [[nodiscard]] uint32_t Handle<Tag_T>::GetIndex() const {
+        return mIndex;
+    }
+
+    template<typename Tag_T>
+    [[nodiscard]] uint32_t Handle<Tag_T>::GetGeneration() const {
+        return mGeneration;
+    }
+
+    template<typename Type_T>
+    HandlePool<Type_T>::HandlePool(std::size_t capacity) {
+        Reserve(capacity);
+    }
+
+    template<typename Type_T>
+    template<typename... Args_T>
+    [[maybe_unused]] typename HandlePool<Type_T>::Handle_T HandlePool<Type_T>::Add(Args_T&&... args)
+    {
+        if (mDense.size() >= mNULL_INDEX) {
+            throw HandlePoolException("Pool is full.");
+        }
+
+        uint32_t slotIndex = mFreeHead;
+        if (slotIndex != mNULL_INDEX) {
+            mFreeHead = mSlots[slotIndex].mDenseIndex;
+        } else {
+            slotIndex = static_cast<uint32_t>(mSlots.size());
+            mSlots.push_back({ mNULL_INDEX, 1 });
+        }
+
+        mDense.emplace_back(std::forward<Args_T>(args)...);
+        mDenseToSlot.push_back(slotIndex);
+
+        Slot& slot = mSlots[slotIndex];
+        slot.mDenseIndex = static_cast<uint32_t>(mDense.size() - 1);
+
+        return Handle_T{ slotIndex, slot.mGeneration };
+    }
+
+    template<typename Type_T>
+    void HandlePool<Type_T>::Remove(Handle_T handle)
+    {
+        if (!Contains(handle)) {
+            throw HandlePoolException("Cannot remove an invalid handle.");
+        }
+
+        Slot& slot = mSlots[handle.mIndex];
+        uint32_t denseIndex = slot.mDenseIndex;
+        uint32_t lastIndex = static_cast<uint32_t>(mDense.size() - 1);
+
+        if (denseIndex != lastIndex)
+        {
+            mDense[denseIndex] = std::move(mDense[lastIndex]);
+            mDenseToSlot[denseIndex] = mDenseToSlot[lastIndex];
+            mSlots[mDenseToSlot[denseIndex]].mDenseIndex = denseIndex;
+        }
+        mDense.pop_back();
+        mDenseToSlot.pop_back();
+
+        if (++slot.mGeneration == 0) {
+            slot.mGeneration = 1;
+        }
+        slot.mDenseIndex = mFreeHead;
+        mFreeHead = handle.mIndex;
+    }
+
+    template<typename Type_T>
+    void HandlePool<Type_T>::Clear()
+    {
+        for (uint32_t slotIndex : mDenseToSlot)
+        {
+            Slot& slot = mSlots[slotIndex];
+            if (++slot.mGeneration == 0) {
+                slot.mGeneration = 1;
+            }
+            slot.mDenseIndex = mFreeHead;
+            mFreeHead = slotIndex;
+        }
+        mDense.clear();
+        mDenseToSlot.clear();
+    }
+
+    template<typename Type_T>
+    void HandlePool<Type_T>::Reserve(std::size_t capacity)
+    {
+        mSlots.reserve(capacity);
+        mDense.reserve(capacity);
+        mDenseToSlot.reserve(capacity);
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] bool HandlePool<Type_T>::Contains(Handle_T handle) const {
+        return mFindSlot(handle) != nullptr;
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] Type_T& HandlePool<Type_T>::Get(Handle_T handle)
+    {
+        const Slot* slot = mFindSlot(handle);
+        if (!slot) {
+            throw HandlePoolException("Handle is invalid or has expired.");
+        }
+        return mDense[slot->mDenseIndex];
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] const Type_T& HandlePool<Type_T>::Get(Handle_T handle) const
+    {
+        const Slot* slot = mFindSlot(handle);
+        if (!slot) {
+            throw HandlePoolException("Handle is invalid or has expired.");
+        }
+        return mDense[slot->mDenseIndex];
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] Type_T* HandlePool<Type_T>::TryGet(Handle_T handle)
+    {
+        const Slot* slot = mFindSlot(handle);
+        return slot ? &mDense[slot->mDenseIndex] : nullptr;
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] const Type_T* HandlePool<Type_T>::TryGet(Handle_T handle) const
+    {
+        const Slot* slot = mFindSlot(handle);
+        return slot ? &mDense[slot->mDenseIndex] : nullptr;
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] typename HandlePool<Type_T>::Handle_T HandlePool<Type_T>::GetHandle(std::size_t denseIndex) const
+    {
+        uint32_t slotIndex = mDenseToSlot[denseIndex];
+        return Handle_T{ slotIndex, mSlots[slotIndex].mGeneration };
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] std::size_t HandlePool<Type_T>::GetDenseIndex(Handle_T handle) const
+    {
+        const Slot* slot = mFindSlot(handle);
+        if (!slot) {
+            throw HandlePoolException("Handle is invalid or has expired.");
+        }
+        return slot->mDenseIndex;
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] std::size_t HandlePool<Type_T>::GetSize() const {
+        return mDense.size();
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] bool HandlePool<Type_T>::IsEmpty() const {
+        return mDense.empty();
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] Type_T* HandlePool<Type_T>::begin() {
+        return mDense.data();
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] Type_T* HandlePool<Type_T>::end() {
+        return mDense.data() + mDense.size();
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] const Type_T* HandlePool<Type_T>::begin() const {
+        return mDense.data();
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] const Type_T* HandlePool<Type_T>::end() const {
+        return mDense.data() + mDense.size();
+    }
+
+    template<typename Type_T>
+    [[nodiscard]] const typename HandlePool<Type_T>::Slot* HandlePool<Type_T>::mFindSlot(Handle_T handle) const
+    {
+        if (handle.mIndex >= mSlots.size()) {
+            return nullptr;
+        }
+
+        const Slot& slot = mSlots[handle.mIndex];
+        if (handle.mGeneration == 0 || slot.mGeneration != handle.mGeneration) {
+            return nullptr;
+        }
+        if (slot.mDenseIndex >= mDense.size() || mDenseToSlot[slot.mDenseIndex] != handle.mIndex) {
+            return nullptr;
+        }
+
+        return &slot;
+    }
+}
+
+#endif // UTILS_HANDLEPOOL_HPP
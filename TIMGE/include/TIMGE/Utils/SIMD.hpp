@@ -0,0 +1,307 @@
+#ifndef UTILS_SIMD_HPP
+#define UTILS_SIMD_HPP
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TIMGE_SIMD_SSE2
+#include <emmintrin.h>
+#endif // SSE2
+
+#if defined(__AVX__)
+#define TIMGE_SIMD_AVX
+#include <immintrin.h>
+#endif // AVX
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace TIMGE
+{
+    class Float4
+    {
+        public:
+            static constexpr std::size_t WIDTH = 4;
+
+            Float4() = default;
+            Float4(float value);
+            Float4(float x, float y, float z, float w);
+
+            [[nodiscard]] static Float4 Load(const float* data);
+            void Store(float* data) const;
+
+            [[nodiscard]] Float4 operator+(const Float4& value) const;
+            [[nodiscard]] Float4 operator-(const Float4& value) const;
+            [[nodiscard]] Float4 operator*(const Float4& value) const;
+            [[nodiscard]] Float4 operator-() const;
+
+            [[nodiscard]] static Float4 Min(const Float4& first, const Float4& second);
+            [[nodiscard]] static Float4 Max(const Float4& first, const Float4& second);
+            [[nodiscard]] static Float4 Abs(const Float4& value);
+            // Bit i is set when lane i of first is less than lane i of second.
+            [[nodiscard]] static uint32_t LessMask(const Float4& first, const Float4& second);
+        private:
+#ifdef TIMGE_SIMD_SSE2
+            Float4(__m128 value);
+
+            __m128 mValue;
+#else
+            float mValue[WIDTH];
+#endif // TIMGE_SIMD_SSE2
+    };
+
+#ifdef TIMGE_SIMD_SSE2
+    inline Float4::Float4(float value)
+     : mValue{_mm_set1_ps(value)}
+    {}
+
+    inline Float4::Float4(float x, float y, float z, float w)
+     : mValue{_mm_setr_ps(x, y, z, w)}
+    {}
+
+    inline Float4::Float4(__m128 value)
+     : mValue{value}
+    {}
+
+    [[nodiscard]] inline Float4 Float4::Load(const float* data) {
+        return _mm_loadu_ps(data);
+    }
+
+    inline void Float4::Store(float* data) const {
+        _mm_storeu_ps(data, mValue);
+    }
+
+    [[nodiscard]] inline Float4 Float4::operator+(const Float4& value) const {
+        return _mm_add_ps(mValue, value.mValue);
+    }
+
+    [[nodiscard]] inline Float4 Float4::operator-(const Float4& value) const {
+        return _mm_sub_ps(mValue, value.mValue);
+    }
+
+    [[nodiscard]] inline Float4 Float4::operator*(const Float4& value) const {
+        return _mm_mul_ps(mValue, value.mValue);
+    }
+
+    [[nodiscard]] inline Float4 Float4::operator-() const {
+        return _mm_sub_ps(_mm_setzero_ps(), mValue);
+    }
+
+    [[nodiscard]] inline Float4 Float4::Min(const Float4& first, const Float4& second) {
+        return _mm_min_ps(first.mValue, second.mValue);
+    }
+
+    [[nodiscard]] inline Float4 Float4::Max(const Float4& first, const Float4& second) {
+        return _mm_max_ps(first.mValue, second.mValue);
+    }
+
+    [[nodiscard]] inline Float4 Float4::Abs(const Float4& value) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), value.mValue);
+    }
+
+    [[nodiscard]] inline uint32_t Float4::LessMask(const Float4& first, const Float4& second) {
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(first.mValue, second.mValue)));
+    }
+#else
+    inline Float4::Float4(float value)
+     : mValue{value, value, value, value}
+    {}
+
+    inline Float4::Float4(float x, float y, float z, float w)
+     : mValue{x, y, z, w}
+    {}
+
+    [[nodiscard]] inline Float4 Float4::Load(const float* data) {
+        return { data[0], data[1], data[2], data[3] };
+    }
+
+    inline void Float4::Store(float* data) const {
+        std::copy(mValue, mValue + WIDTH, data);
+    }
+
+    [[nodiscard]] inline Float4 Float4::operator+(const Float4& value) const {
+        return { mValue[0] + value.mValue[0], mValue[1] + value.mValue[1], mValue[2] + value.mValue[2], mValue[3] + value.mValue[3] };
+    }
+
+    [[nodiscard]] inline Float4 Float4::operator-(const Float4& value) const {
+        return { mValue[0] - value.mValue[0], mValue[1] - value.mValue[1], mValue[2] - value.mValue[2], mValue[3] - value.mValue[3] };
+    }
+
+    [[nodiscard]] inline Float4 Float4::operator*(const Float4& value) const {
+        return { mValue[0] * value.mValue[0], mValue[1] * value.mValue[1], mValue[2] * value.mValue[2], mValue[3] * value.mValue[3] };
+    }
+
+    [[nodiscard]] inline Float4 Float4::operator-() const {
+        return { 0.0f - mValue[0], 0.0f - mValue[1], 0.0f - mValue[2], 0.0f - mValue[3] };
+    }
+
+    [[nodiscard]] inline Float4 Float4::Min(const Float4& first, const Float4& second)
+    {
+        return {
+            first.mValue[0] < second.mValue[0] ? first.mValue[0] : second.mValue[0],
+            first.mValue[1] < second.mValue[1] ? first.mValue[1] : second.mValue[1],
+            first.mValue[2] < second.mValue[2] ? first.mValue[2] : second.mValue[2],
+            first.mValue[3] < second.mValue[3] ? first.mValue[3] : second.mValue[3]
+        };
+    }
+
+    [[nodiscard]] inline Float4 Float4::Max(const Float4& first, const Float4& second)
+    {
+        return {
+            first.mValue[0] > second.mValue[0] ? first.mValue[0] : second.mValue[0],
+            first.mValue[1] > second.mValue[1] ? first.mValue[1] : second.mValue[1],
+            first.mValue[2] > second.mValue[2] ? first.mValue[2] : second.mValue[2],
+            first.mValue[3] > second.mValue[3] ? first.mValue[3] : second.mValue[3]
+        };
+    }
+
+    [[nodiscard]] inline Float4 Float4::Abs(const Float4& value) {
+        return Max(value, -value);
+    }
+
+    [[nodiscard]] inline uint32_t Float4::LessMask(const Float4& first, const Float4& second)
+    {
+        uint32_t mask = 0;
+        for (std::size_t lane = 0; lane < WIDTH; lane++) {
+            mask |= static_cast<uint32_t>(first.mValue[lane] < second.mValue[lane]) << lane;
+        }
+        return mask;
+    }
+#endif // TIMGE_SIMD_SSE2
+
+    class Float8
+    {
+        public:
+            static constexpr std::size_t WIDTH = 8;
+
+            Float8() = default;
+            Float8(float value);
+
+            [[nodiscard]] static Float8 Load(const float* data);
+            void Store(float* data) const;
+
+            [[nodiscard]] Float8 operator+(const Float8& value) const;
+            [[nodiscard]] Float8 operator-(const Float8& value) const;
+            [[nodiscard]] Float8 operator*(const Float8& value) const;
+            [[nodiscard]] Float8 operator-() const;
+
+            [[nodiscard]] static Float8 Min(const Float8& first, const Float8& second);
+            [[nodiscard]] static Float8 Max(const Float8& first, const Float8& second);
+            [[nodiscard]] static Float8 Abs(const Float8& value);
+            [[nodiscard]] static uint32_t LessMask(const Float8& first, const Float8& second);
+        private:
+#ifdef TIMGE_SIMD_AVX
+            Float8(__m256 value);
+
+            __m256 mValue;
+#else
+            Float8(const Float4& low, const Float4& high);
+
+            Float4 mLow;
+            Float4 mHigh;
+#endif // TIMGE_SIMD_AVX
+    };
+
+#ifdef TIMGE_SIMD_AVX
+    inline Float8::Float8(float value)
+     : mValue{_mm256_set1_ps(value)}
+    {}
+
+    inline Float8::Float8(__m256 value)
+     : mValue{value}
+    {}
+
+    [[nodiscard]] inline Float8 Float8::Load(const float* data) {
+        return _mm256_loadu_ps(data);
+    }
+
+    inline void Float8::Store(float* data) const {
+        _mm256_storeu_ps(data, mValue);
+    }
+
+    [[nodiscard]] inline Float8 Float8::operator+(const Float8& value) const {
+        return _mm256_add_ps(mValue, value.mValue);
+    }
+
+    [[nodiscard]] inline Float8 Float8::operator-(const Float8& value) const {
+        return _mm256_sub_ps(mValue, value.mValue);
+    }
+
+    [[nodiscard]] inline Float8 Float8::operator*(const Float8& value) const {
+        return _mm256_mul_ps(mValue, value.mValue);
+    }
+
+    [[nodiscard]] inline Float8 Float8::operator-() const {
+        return _mm256_sub_ps(_mm256_setzero_ps(), mValue);
+    }
+
+    [[nodiscard]] inline Float8 Float8::Min(const Float8& first, const Float8& second) {
+        return _mm256_min_ps(first.mValue, second.mValue);
+    }
+
+    [[nodiscard]] inline Float8 Float8::Max(const Float8& first, const Float8& second) {
+        return _mm256_max_ps(first.mValue, second.mValue);
+    }
+
+    [[nodiscard]] inline Float8 Float8::Abs(const Float8& value) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value.mValue);
+    }
+
+    [[nodiscard]] inline uint32_t Float8::LessMask(const Float8& first, const Float8& second) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(first.mValue, second.mValue, _CMP_LT_OQ)));
+    }
+#else
+    inline Float8::Float8(float value)
+     : mLow{value},
+       mHigh{value}
+    {}
+
+    inline Float8::Float8(const Float4& low, const Float4& high)
+     : mLow{low},
+       mHigh{high}
+    {}
+
+    [[nodiscard]] inline Float8 Float8::Load(const float* data) {
+        return { Float4::Load(data), Float4::Load(data + Float4::WIDTH) };
+    }
+
+    inline void Float8::Store(float* data) const
+    {
+        mLow.Store(data);
+        mHigh.Store(data + Float4::WIDTH);
+    }
+
+    [[nodiscard]] inline Float8 Float8::operator+(const Float8& value) const {
+        return { mLow + value.mLow, mHigh + value.mHigh };
+    }
+
+    [[nodiscard]] inline Float8 Float8::operator-(const Float8& value) const {
+        return { mLow - value.mLow, mHigh - value.mHigh };
+    }
+
+    [[nodiscard]] inline Float8 Float8::operator*(const Float8& value) const {
+        return { mLow * value.mLow, mHigh * value.mHigh };
+    }
+
+    [[nodiscard]] inline Float8 Float8::operator-() const {
+        return { -mLow, -mHigh };
+    }
+
+    [[nodiscard]] inline Float8 Float8::Min(const Float8& first, const Float8& second) {
+        return { Float4::Min(first.mLow, second.mLow), Float4::Min(first.mHigh, second.mHigh) };
+    }
+
+    [[nodiscard]] inline Float8 Float8::Max(const Float8& first, const Float8& second) {
+        return { Float4::Max(first.mLow, second.mLow), Float4::Max(first.mHigh, second.mHigh) };
+    }
+
+    [[nodiscard]] inline Float8 Float8::Abs(const Float8& value) {
+        return { Float4::Abs(value.mLow), Float4::Abs(value.mHigh) };
+    }
+
+    [[nodiscard]] inline uint32_t Float8::LessMask(const Float8& first, const Float8& second) {
+        return Float4::LessMask(first.mLow, second.mLow) | Float4::LessMask(first.mHigh, second.mHigh) << Float4::WIDTH;
+    }
+#endif // TIMGE_SIMD_AVX
+}
+
+#endif // UTILS_SIMD_HPP
@@ -26,6 +26,12 @@ namespace TIMGE
 
             [[maybe_unused]] Vector<Type_T, DIMENSIONS>& operator=(const Vector<Type_T, DIMENSIONS>& vector);
             [[maybe_unused]] Vector<Type_T, DIMENSIONS>& operator=(Vector<Type_T, DIMENSIONS>&& vector);
+            [[nodiscard]] Vector<Type_T, DIMENSIONS> operator+(const Vector<Type_T, DIMENSIONS>& vector) const;
+            [[nodiscard]] Vector<Type_T, DIMENSIONS> operator-(const Vector<Type_T, DIMENSIONS>& vector) const;
+            [[nodiscard]] Vector<Type_T, DIMENSIONS> operator*(Type_T scalar) const;
+            [[maybe_unused]] Vector<Type_T, DIMENSIONS>& operator+=(const Vector<Type_T, DIMENSIONS>& vector);
+            [[maybe_unused]] Vector<Type_T, DIMENSIONS>& operator-=(const Vector<Type_T, DIMENSIONS>& vector);
+            [[maybe_unused]] Vector<Type_T, DIMENSIONS>& operator*=(Type_T scalar);
             [[nodiscard]] bool operator<(const Vector<Type_T, DIMENSIONS>& vector) const;
             [[nodiscard]] bool operator>(const Vector<Type_T, DIMENSIONS>& vector) const;
             [[nodiscard]] bool operator<=(const Vector<Type_T, DIMENSIONS>& vector) const;
@@ -65,17 +71,16 @@ namespace TIMGE
             static constexpr std::size_t MAX_HEIGHT = 3;
             static constexpr std::size_t BOTTOM = 3;
         private:
-            Type_T* mData;
+            Type_T mData[DIMENSIONS];
     };
 
     template<typename Type_T, std::size_t DIMENSIONS>
     Vector<Type_T, DIMENSIONS>::Vector()
-     : mData{new Type_T[DIMENSIONS]{}}
+     : mData{}
     {}
 
     template<typename Type_T, std::size_t DIMENSIONS>
     Vector<Type_T, DIMENSIONS>::Vector(const Vector<Type_T, DIMENSIONS>& vector)
-     : mData{new Type_T[DIMENSIONS]}
     {
         for (int i = 0; i < DIMENSIONS; i++) {
             mData[i] = vector.mData[i];
@@ -84,31 +89,28 @@ namespace TIMGE
 
     template<typename Type_T, std::size_t DIMENSIONS>
     Vector<Type_T, DIMENSIONS>::Vector(Vector<Type_T, DIMENSIONS>&& vector)
-     : mData{vector.mData} {
-        vector.mData = nullptr;
+    {
+        for (int i = 0; i < DIMENSIONS; i++) {
+            mData[i] = vector.mData[i];
+        }
     }
 
     template<typename Type_T, std::size_t DIMENSIONS>
     Vector<Type_T, DIMENSIONS>::Vector(const std::initializer_list<Type_T>& list)
-     : mData{new Type_T[DIMENSIONS]{}}
+     : mData{}
     {
         if (list.size() > DIMENSIONS) {
             throw VectorException("Vector initializer list is too big.");
         }
 
-        int i = 0;
-        for (i = 0; i < list.size(); i++) {
+        for (int i = 0; i < list.size(); i++) {
             mData[i] = *(list.begin() + i);
         }
-        for (; i < DIMENSIONS; i++) {
-            mData[i] = {};
-        }
     }
 
     template<typename Type_T, std::size_t DIMENSIONS>
-    Vector<Type_T, DIMENSIONS>::~Vector() {
-        delete[] mData;
-    }
+    Vector<Type_T, DIMENSIONS>::~Vector()
+    {}
 
     template<typename Type_T, std::size_t DIMENSIONS>
     [[maybe_unused]] Vector<Type_T, DIMENSIONS>& Vector<Type_T, DIMENSIONS>::operator=(const Vector<Type_T, DIMENSIONS>& vector)
@@ -123,11 +125,72 @@ namespace TIMGE
     template<typename Type_T, std::size_t DIMENSIONS>
     [[maybe_unused]] Vector<Type_T, DIMENSIONS>& Vector<Type_T, DIMENSIONS>::operator=(Vector<Type_T, DIMENSIONS>&& vector)
     {
-        Type_T* tmp = mData;
-        mData = vector.mData;
+        for (int i = 0; i < DIMENSIONS; i++) {
+            mData[i] = vector.mData[i];
+        }
+
+        return *this;
+    }
+
+    template<typename Type_T, std::size_t DIMENSIONS>
+    [[nodiscard]] Vector<Type_T, DIMENSIONS> Vector<Type_T, DIMENSIONS>::operator+(const Vector<Type_T, DIMENSIONS>& vector) const
+    {
+        Vector<Type_T, DIMENSIONS> result;
+        for (int i = 0; i < DIMENSIONS; i++) {
+            result.mData[i] = mData[i] + vector.mData[i];
+        }
+
+        return result;
+    }
+
+    template<typename Type_T, std::size_t DIMENSIONS>
+    [[nodiscard]] Vector<Type_T, DIMENSIONS> Vector<Type_T, DIMENSIONS>::operator-(const Vector<Type_T, DIMENSIONS>& vector) const
+    {
+        Vector<Type_T, DIMENSIONS> result;
+        for (int i = 0; i < DIMENSIONS; i++) {
+            result.mData[i] = mData[i] - vector.mData[i];
+        }
+
+        return result;
+    }
+
+    template<typename Type_T, std::size_t DIMENSIONS>
+    [[nodiscard]] Vector<Type_T, DIMENSIONS> Vector<Type_T, DIMENSIONS>::operator*(Type_T scalar) const
+    {
+        Vector<Type_T, DIMENSIONS> result;
+        for (int i = 0; i < DIMENSIONS; i++) {
+            result.mData[i] = mData[i] * scalar;
+        }
+
+        return result;
+    }
+
+    template<typename Type_T, std::size_t DIMENSIONS>
+    [[maybe_unused]] Vector<Type_T, DIMENSIONS>& Vector<Type_T, DIMENSIONS>::operator+=(const Vector<Type_T, DIMENSIONS>& vector)
+    {
+        for (int i = 0; i < DIMENSIONS; i++) {
+            mData[i] += vector.mData[i];
+        }
 
-        delete[] tmp; 
-        vector.mData = nullptr;
+        return *this;
+    }
+
+    template<typename Type_T, std::size_t DIMENSIONS>
+    [[maybe_unused]] Vector<Type_T, DIMENSIONS>& Vector<Type_T, DIMENSIONS>::operator-=(const Vector<Type_T, DIMENSIONS>& vector)
+    {
+        for (int i = 0; i < DIMENSIONS; i++) {
+            mData[i] -= vector.mData[i];
+        }
+
+        return *this;
+    }
+
+    template<typename Type_T, std::size_t DIMENSIONS>
+    [[maybe_unused]] Vector<Type_T, DIMENSIONS>& Vector<Type_T, DIMENSIONS>::operator*=(Type_T scalar)
+    {
+        for (int i = 0; i < DIMENSIONS; i++) {
+            mData[i] *= scalar;
+        }
 
         return *this;
     }
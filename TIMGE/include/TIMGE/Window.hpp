@@ -4,7 +4,10 @@
 #include "Exception.hpp"
 #include "Utils/Vector.hpp"
 #include "Monitor.hpp"
+#include "Utils/Delegate.hpp"
 
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <string>
@@ -26,6 +29,7 @@ namespace TIMGE
     {
         public:
             using FLAGS = uint32_t;
+            using Renderer_T = Delegate<void(Window& window)>;
 
             struct Info
             {
@@ -39,9 +43,12 @@ namespace TIMGE
                 FLAGS mFlags;
             };
 
-            Window(Info& info, Monitor& monitor);
+            Window(Info& info, Monitor& monitor, Window* share = nullptr);
             ~Window();
 
+            Window(const Window&) = delete;
+            Window& operator=(const Window&) = delete;
+
             [[nodiscard]] const std::string_view& GetTitle() const;
             [[nodiscard]] const V2i32& GetPosition() const;
             [[nodiscard]] const V2ui32& GetSize() const;
@@ -53,6 +60,10 @@ namespace TIMGE
             [[nodiscard]] float GetOpacity() const;
             [[nodiscard]] bool GetState(FLAGS flags) const;
             [[nodiscard]] bool ShouldClose();
+            [[nodiscard]] bool IsShared() const;
+            [[nodiscard]] double GetPresentRate() const;
+            [[nodiscard]] int GetSwapInterval() const;
+            [[nodiscard]] bool SupportsAdaptiveVSync() const;
 
             void SetTitle(const std::string_view& title);
             void SetIcon(const std::filesystem::path& iconPath);
@@ -62,6 +73,9 @@ namespace TIMGE
             void SetSizeLimits(const V4ui32& sizeLimits);
             void SetOpacity(float opacity);
             void SetShouldClose(bool shouldClose);
+            void SetPresentRate(double rate);
+            void SetSwapInterval(int interval);
+            void SetRenderer(Renderer_T renderer);
 
             void ToggleResizable();
             void ToggleDecorated();
@@ -84,6 +98,10 @@ namespace TIMGE
             void RequestAttention();
             void BorderlessFullscreen();
             void Fullscreen();
+            void SetFullscreenMode(const Monitor::VideoMode& videoMode);
+
+            void MakeCurrent();
+            void SwapBuffers();
 
             static constexpr FLAGS RESIZABLE = (1 << 0);
             static constexpr FLAGS VISIBLE = (1 << 1);
@@ -100,6 +118,29 @@ namespace TIMGE
             static constexpr FLAGS FULLSCREEN = (1 << 12);
             static constexpr FLAGS VSYNC = (1 << 13);
             static constexpr FLAGS MINIMIZED = (1 << 14);
+
+            // A conflict applies when every flag in mSet is set and every flag in
+            // mCleared is not. Shared by the runtime checks and WindowFlags.
+            struct FlagConflict
+            {
+                FLAGS mSet;
+                FLAGS mCleared;
+                std::string_view mMessage;
+            };
+
+            static constexpr std::array<FlagConflict, 8> FLAG_CONFLICTS
+            {{
+                { FULLSCREEN | BORDERLESS_FULLSCREEN, 0, "Window cannot be both Fullscreen and Borderless Fullscreen." },
+                { FULLSCREEN, VISIBLE, "Window cannot be both Hidden and Fullscreen." },
+                { DECORATED | FULLSCREEN, 0, "Window cannot be both Decorated and Fullscreen." },
+                { DECORATED | BORDERLESS_FULLSCREEN, 0, "Window cannot be both Decorated and Borderless Fullscreen." },
+                { FOCUSED | MINIMIZED, 0, "Window cannot be both Focused and Minimized." },
+                { CENTER_CURSOR, FOCUSED, "Cursor cannot be centered on unfocused window." },
+                { CENTER_CURSOR | MINIMIZED, 0, "Cursor cannot be centered on minimized window." },
+                { MINIMIZED | MAXIMIZED, 0, "Window cannot be both Minimized and Maximized." }
+            }};
+
+            [[nodiscard]] static constexpr const FlagConflict* FindFlagConflict(FLAGS flags);
         private:
             GLFWwindow* mGetWindow();
             void mUpdateMonitor();
@@ -111,15 +152,6 @@ namespace TIMGE
             void mValidateOpacity(float opacity);
             void mValidateOpenGLVersion(const V2ui32& version);
             void mValidateFlags(FLAGS flags);
-
-            void mValidateFullscreen_BorderlessFullscreen(FLAGS flags);
-            void mValidateVisible_Fullscreen(FLAGS flags);
-            void mValidateDecorated_Fullscreen(FLAGS flags);
-            void mValidateDecorated_BorderlessFullscreen(FLAGS flags);
-            void mValidateFocused_Minimized(FLAGS flags);
-            void mValidateFocused_CenterCursor(FLAGS flags);
-            void mValidateCenterCursor_Minimized(FLAGS flags);
-            void mValidateMinimized_Maximized(FLAGS flags);
  
             [[nodiscard]] bool mInvalidSizeMinBound(const V2ui32& size) const;
             [[nodiscard]] bool mInvalidSizeMaxBound(const V2ui32& size) const;
@@ -128,16 +160,8 @@ namespace TIMGE
             [[nodiscard]] bool mInvalidOpacity(float opacity) const;
             [[nodiscard]] bool mInvalidOpenGLVersion(const V2ui32& version) const;
 
-            [[nodiscard]] bool mConflictFullscreen_BorderlessFullscreen(FLAGS flags) const;
-            [[nodiscard]] bool mConflictVisible_Fullscreen(FLAGS flags) const;
-            [[nodiscard]] bool mConflictDecorated_Fullscreen(FLAGS flags) const;
-            [[nodiscard]] bool mConflictDecorated_BorderlessFullscreen(FLAGS flags) const;
-            [[nodiscard]] bool mConflictFocused_Minimized(FLAGS flags) const;
-            [[nodiscard]] bool mConflictFocused_CenterCursor(FLAGS flags) const;
-            [[nodiscard]] bool mConflictCenterCursor_Minimized(FLAGS flags) const;
-            [[nodiscard]] bool mConflictMinimized_Maximized(FLAGS flags) const;
-
-            void mCreateWindow();
+            void mCreateWindow(Window* share);
+            [[nodiscard]] bool mPresentDue(std::chrono::steady_clock::time_point now);
 
             void mLoadGL();
 
@@ -183,13 +207,54 @@ namespace TIMGE
             V2ui32 mSizeBeforeFullscreen;
             V2i32 mPositionBeforeFullscreen;
             GLFWmonitor* mFullscreenMonitor;
-            const GLFWvidmode* mVidMode;
+            Monitor::VideoMode mVideoMode;
+            Monitor::VideoMode mFullscreenMode;
 
-            static Window* mInstance;
+            bool mShared;
+            bool mAdaptiveVSync;
+            int mSwapInterval;
+            double mPresentRate;
+            std::chrono::steady_clock::time_point mNextPresent;
+            Renderer_T mRenderer;
 
             friend class Application;
             friend class Mouse;
             friend class Keyboard;
     };
+
+    // Window flags checked while compiling, for Info set up in code:
+    //   Window::Info{ ..., WindowFlags{ Window::FULLSCREEN | Window::DECORATED } }
+    // fails to compile instead of throwing when the window is created.
+    class WindowFlags
+    {
+        public:
+            consteval WindowFlags(Window::FLAGS flags);
+
+            [[nodiscard]] constexpr operator Window::FLAGS() const;
+        private:
+            Window::FLAGS mFlags;
+    };
+
+    [[nodiscard]] constexpr const Window::FlagConflict* Window::FindFlagConflict(FLAGS flags)
+    {
+        for (const FlagConflict& conflict : FLAG_CONFLICTS) {
+            if ((flags & conflict.mSet) == conflict.mSet && (flags & conflict.mCleared) == 0) {
+                return &conflict;
+            }
+        }
+        return nullptr;
+    }
+
+    consteval WindowFlags::WindowFlags(Window::FLAGS flags)
+     : mFlags{flags}
+    {
+        if (Window::FindFlagConflict(flags) != nullptr) {
+            throw "Conflicting window flags, see Window::FLAG_CONFLICTS.";
+        }
+    }
+
+    [[nodiscard]] constexpr WindowFlags::operator Window::FLAGS() const {
+        return mFlags;
+    }
 }
 #endif // WINDOW_HPP
@@ -1,9 +1,13 @@
 #include "TIMGE/Application.hpp"
 #include "TIMGE/Callback.hpp"
+#include "TIMGE/Input/Recorder.hpp"
+#include "TIMGE/Input/Replayer.hpp"
 #include "TIMGE/Utils/Vector.hpp"
 #include "TIMGE/Window.hpp"
 
+#include <algorithm>
 #include <format>
+#include <thread>
 
 #ifdef TIMGE_ENABLE_IMGUI
 #include <imgui.h>
@@ -35,6 +39,7 @@ namespace TIMGE
 
     Application::EventProcessor_T Application::PollEvents = &glfwPollEvents;
     Application::EventProcessor_T Application::WaitEvents = &glfwWaitEvents;
+    Application::WaitEventsTimeout_T Application::WaitEventsTimeout = &glfwWaitEventsTimeout;
 
     Application::GetTime_T Application::GetTime = &glfwGetTime;
     Application::SetTime_T Application::SetTime = &glfwSetTime;
@@ -48,8 +53,32 @@ namespace TIMGE
        mWindow{mInfo.mWindowInfo, mMonitor},
        mMouse{info.mMouseInfo, mWindow},
        mKeyboard{mWindow},
+       mGamepad{},
+       mJobSystem{},
+       mWorld{},
+       mScheduler{},
+       mPhysicsWorld{},
+       mActionMap{},
+       mLatencyTracker{},
+       mEventBus{},
+       mSwapController{mWindow, mMonitor},
+       mResolutionScaler{},
+       mHotReloader{[]{ glfwPostEmptyEvent(); }},
+       mRoute{this, &mWindow, &mInfo.mCallbacks, true},
+       mSharedWindows{},
        mDeltaTime{},
+       mFixedTimestep{1.0 / 60.0},
+       mFixedAccumulator{},
+       mDeltaTimeOverride{},
        mStartTime{std::chrono::steady_clock::now()},
+       mWorkStart{mStartTime},
+       mRenderMode{RenderMode::CONTINUOUS},
+       mIdleTimeout{0.25},
+       mRedrawFrames{mINPUT_REDRAW_FRAMES},
+       mRendering{false},
+       mIdle{false},
+       mSkippedFrames{},
+       mRedrawTimers{},
        mEventProcessor{PollEvents}
     {
         if (Application::mInstance) {
@@ -70,25 +99,11 @@ namespace TIMGE
         #endif // TIMGE_ENABLE_IMGUI
 
         glfwSetErrorCallback(Callback::ErrorCallback);
-        glfwSetWindowPosCallback(mWindow.mGetWindow(), Callback::WindowPosCallback);
-        glfwSetWindowSizeCallback(mWindow.mGetWindow(), Callback::WindowSizeCallback);
-        glfwSetWindowCloseCallback(mWindow.mGetWindow(), Callback::WindowCloseCallback);
-        glfwSetWindowRefreshCallback(mWindow.mGetWindow(), Callback::WindowRefreshCallback);
-        glfwSetWindowFocusCallback(mWindow.mGetWindow(), Callback::WindowFocusCallback);
-        glfwSetWindowIconifyCallback(mWindow.mGetWindow(), Callback::WindowIconifyCallback);
-        glfwSetWindowMaximizeCallback(mWindow.mGetWindow(), Callback::WindowMaximizeCallback);
-        glfwSetFramebufferSizeCallback(mWindow.mGetWindow(), Callback::FramebufferSizeCallback);
-        glfwSetWindowContentScaleCallback(mWindow.mGetWindow(), Callback::WindowContentScaleCallback);
-        glfwSetMouseButtonCallback(mWindow.mGetWindow(), Callback::MouseButtonCallback);
-        glfwSetCursorPosCallback(mWindow.mGetWindow(), Callback::CursorPosCallback);
-        glfwSetCursorEnterCallback(mWindow.mGetWindow(), Callback::CursorEnterCallback);
-        glfwSetScrollCallback(mWindow.mGetWindow(), Callback::ScrollCallback);
-        glfwSetKeyCallback(mWindow.mGetWindow(), Callback::KeyCallback);
-        glfwSetCharCallback(mWindow.mGetWindow(), Callback::CharCallback);
-        glfwSetCharModsCallback(mWindow.mGetWindow(), Callback::CharModsCallback);
-        glfwSetDropCallback(mWindow.mGetWindow(), Callback::DropCallback);
+        mInstallCallbacks(mWindow, mRoute);
         glfwSetMonitorCallback(Callback::MonitorCallback);
         glfwSetJoystickCallback(Callback::JoystickCallback);
+
+        mResolutionScaler.SetTargetFrameTime(mSwapController.GetRefreshPeriod());
 }
 
     Application::Application(std::string_view title, uint32_t width, uint32_t height)
@@ -122,38 +137,131 @@ namespace TIMGE
         #endif // TIMGE_ENABLE_IMGUI
     }
 
+    void Application::FixedUpdate(double)
+    {}
+
     void Application::BeginFrame()
     {
         mStartTime = mSteadyClock.now();
+        mDelayFrameStart();
+        mWorkStart = mSteadyClock.now();
+        mLatencyTracker.OnFrameBegin();
+        if (mHotReloader.Apply() != 0) {
+            RequestRedraw();
+        }
+
+        // Decided up front so idle ON_DEMAND frames skip the clear as well as
+        // the present. Redraws requested later in the frame render the next one.
+        mRendering = mShouldRender();
+        if (mRendering)
+        {
+            mResolutionScaler.BeginScene(mWindow.GetFramebufferSize(), mInfo.mBackground);
+            if (!mResolutionScaler.IsEnabled())
+            {
+                glClearColor(
+                    mInfo.mBackground[V4f::R], 
+                    mInfo.mBackground[V4f::G], 
+                    mInfo.mBackground[V4f::B], 
+                    mInfo.mBackground[V4f::A] 
+                );
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            }
+        }
         #ifdef TIMGE_ENABLE_IMGUI
             ImGui_ImplGlfw_NewFrame();
             ImGui_ImplOpenGL3_NewFrame();
             ImGui::NewFrame();
         #endif // TIMGE_ENABLE_IMGUI
+
+        mRunFixedSteps();
+
+        mScheduler.Run(ECS::Stage::PRE_UPDATE, mWorld, mJobSystem, mDeltaTime);
+        mScheduler.Run(ECS::Stage::UPDATE, mWorld, mJobSystem, mDeltaTime);
     }
 
     void Application::EndFrame()
     {
-        #ifdef TIMGE_ENABLE_IMGUI
-            ImGui::Render();
-        #endif // TIMGE_ENABLE_IMGUI
+        mScheduler.Run(ECS::Stage::POST_UPDATE, mWorld, mJobSystem, mDeltaTime);
 
-        glClearColor(
-            mInfo.mBackground[V4f::R], 
-            mInfo.mBackground[V4f::G], 
-            mInfo.mBackground[V4f::B], 
-            mInfo.mBackground[V4f::A] 
-        );
-        glClear(GL_COLOR_BUFFER_BIT);
+        bool render = mRendering;
+        if (render)
+        {
+            mResolutionScaler.EndScene();
 
-        #ifdef TIMGE_ENABLE_IMGUI
-            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-        #endif // TIMGE_ENABLE_IMGUI
+            #ifdef TIMGE_ENABLE_IMGUI
+                ImGui::Render();
+            #endif // TIMGE_ENABLE_IMGUI
+
+            mResolutionScaler.Present(mWindow.GetFramebufferSize());
+
+            #ifdef TIMGE_ENABLE_IMGUI
+                ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            #endif // TIMGE_ENABLE_IMGUI
+        }
+        else
+        {
+            #ifdef TIMGE_ENABLE_IMGUI
+                ImGui::EndFrame();
+            #endif // TIMGE_ENABLE_IMGUI
+            mSkippedFrames++;
+        }
+        mIdle = !render;
+
+        mActionMap.NewFrame();
+        mMouse.mNewFrame();
+
+        double waited = 0.0;
+        if (mRenderMode == RenderMode::ON_DEMAND && mRedrawFrames == 0) {
+            waited = mWaitForEvents();
+        }
 
         mEventProcessor();
-        glfwSwapBuffers(mWindow.mGetWindow());
+        mPollGamepads();
 
-        mDeltaTime = std::chrono::nanoseconds(mSteadyClock.now() - mStartTime).count() * 1.0E-9;
+        if (render)
+        {
+            mSwapController.OnFrameEnd(std::chrono::duration<double>(mSteadyClock.now() - mWorkStart).count() - waited);
+
+            mPresentWindows();
+            glfwSwapBuffers(mWindow.mGetWindow());
+            mLatencyTracker.OnFramePresented();
+        }
+
+        mDeltaTime = std::chrono::nanoseconds(mSteadyClock.now() - mStartTime).count() * 1.0E-9 - waited;
+        if (mDeltaTimeOverride > 0.0)
+        {
+            mDeltaTime = mDeltaTimeOverride;
+            mDeltaTimeOverride = 0.0;
+        }
+    }
+
+    [[maybe_unused]] Window& Application::AddWindow(const Window::Info& info, const Callback::Callbacks& callbacks)
+    {
+        auto shared = std::make_unique<SharedWindow>();
+        shared->mInfo = info;
+        shared->mCallbacks = callbacks;
+        shared->mWindow = std::make_unique<Window>(shared->mInfo, mMonitor, &mWindow);
+        shared->mRoute = { this, shared->mWindow.get(), &shared->mCallbacks, false };
+
+        mInstallCallbacks(*shared->mWindow, shared->mRoute);
+        mWindow.MakeCurrent();
+
+        mSharedWindows.push_back(std::move(shared));
+        return *mSharedWindows.back()->mWindow;
+    }
+
+    void Application::RemoveWindow(Window& window)
+    {
+        auto it = std::find_if(mSharedWindows.begin(), mSharedWindows.end(), [&window](const std::unique_ptr<SharedWindow>& shared) {
+            return shared->mWindow.get() == &window;
+        });
+
+        if (it == mSharedWindows.end()) {
+            throw ApplicationException("Only windows created with AddWindow can be removed.");
+        }
+
+        mSharedWindows.erase(it);
+        mWindow.MakeCurrent();
     }
 
     void Application::SetMonitor(const Monitor& monitor) {
@@ -169,6 +277,40 @@ namespace TIMGE
         mEventProcessor = eventProcessor;
     }
 
+    void Application::SetFixedTimestep(double timestep)
+    {
+        if (!(timestep > 0.0)) {
+            throw ApplicationException("Fixed timestep must be positive!");
+        }
+        mFixedTimestep = timestep;
+    }
+
+    void Application::SetRenderMode(RenderMode mode)
+    {
+        mRenderMode = mode;
+        mRedrawFrames = mINPUT_REDRAW_FRAMES;
+    }
+
+    void Application::SetIdleTimeout(double timeout)
+    {
+        if (!(timeout > 0.0)) {
+            throw ApplicationException("Idle timeout must be positive!");
+        }
+        mIdleTimeout = timeout;
+    }
+
+    void Application::RequestRedraw(uint32_t frames) {
+        mRedrawFrames = std::max(mRedrawFrames, frames);
+    }
+
+    void Application::ScheduleRedraw(double delay)
+    {
+        if (!(delay >= 0.0)) {
+            throw ApplicationException("Redraw delay must not be negative!");
+        }
+        mRedrawTimers.push(mSteadyClock.now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(delay)));
+    }
+
     [[nodiscard]] Monitor& Application::GetMonitor() {
         return mMonitor;
     }
@@ -177,6 +319,10 @@ namespace TIMGE
         return mWindow;
     }
 
+    [[nodiscard]] std::size_t Application::GetWindowCount() const {
+        return mSharedWindows.size() + 1;
+    }
+
     [[nodiscard]] Mouse& Application::GetMouse() {
         return mMouse;
     }
@@ -185,6 +331,58 @@ namespace TIMGE
         return mKeyboard;
     }
 
+    [[nodiscard]] Gamepad& Application::GetGamepad() {
+        return mGamepad;
+    }
+
+    [[nodiscard]] JobSystem& Application::GetJobSystem() {
+        return mJobSystem;
+    }
+
+    [[nodiscard]] ECS::World& Application::GetWorld() {
+        return mWorld;
+    }
+
+    [[nodiscard]] ECS::Scheduler& Application::GetScheduler() {
+        return mScheduler;
+    }
+
+    [[nodiscard]] Physics::World& Application::GetPhysicsWorld() {
+        return mPhysicsWorld;
+    }
+
+    [[nodiscard]] Input::ActionMap& Application::GetActionMap() {
+        return mActionMap;
+    }
+
+    [[nodiscard]] Input::LatencyTracker& Application::GetLatencyTracker() {
+        return mLatencyTracker;
+    }
+
+    [[nodiscard]] EventBus& Application::GetEventBus() {
+        return mEventBus;
+    }
+
+    [[nodiscard]] SwapController& Application::GetSwapController() {
+        return mSwapController;
+    }
+
+    [[nodiscard]] ResolutionScaler& Application::GetResolutionScaler() {
+        return mResolutionScaler;
+    }
+
+    [[nodiscard]] HotReloader& Application::GetHotReloader() {
+        return mHotReloader;
+    }
+
+    [[nodiscard]] double Application::GetFixedTimestep() const {
+        return mFixedTimestep;
+    }
+
+    [[nodiscard]] double Application::GetFixedAlpha() const {
+        return mFixedAccumulator / mFixedTimestep;
+    }
+
     [[nodiscard]] const double& Application::GetDeltaTime() {
         return mDeltaTime;
     }
@@ -193,6 +391,18 @@ namespace TIMGE
         return mInfo.mBackground;
     }
 
+    [[nodiscard]] Application::RenderMode Application::GetRenderMode() const {
+        return mRenderMode;
+    }
+
+    [[nodiscard]] bool Application::IsIdle() const {
+        return mIdle;
+    }
+
+    [[nodiscard]] uint64_t Application::GetSkippedFrames() const {
+        return mSkippedFrames;
+    }
+
     [[nodiscard]] Application::EventProcessor_T Application::GetEventProcessor() {
         return mEventProcessor;
     }
@@ -207,39 +417,216 @@ namespace TIMGE
         return Application::mInstance;
     }
 
-    void Application::mConnectMonitor(GLFWmonitor* monitor) {
-        Monitor::mConnect(monitor);
+    void Application::mDelayFrameStart()
+    {
+        // Only worth it when input can be polled right after the sleep, so the
+        // Recorder, the Replayer and blocking processors opt out.
+        double delay = mSwapController.GetFrameDelay();
+        if (delay <= 0.0 || mIdle || mEventProcessor != PollEvents) {
+            return;
+        }
+
+        // Sleep off the slack the previous frames left before vertical blank,
+        // then pick up whatever input arrived in the meantime.
+        std::this_thread::sleep_for(std::chrono::duration<double>(delay));
+        mEventProcessor();
+    }
+
+    void Application::mRunFixedSteps()
+    {
+        mFixedAccumulator += mDeltaTime;
+
+        uint32_t steps = 0;
+        while (mFixedAccumulator >= mFixedTimestep && steps < mMAX_FIXED_STEPS)
+        {
+            FixedUpdate(mFixedTimestep);
+            mPhysicsWorld.Step(static_cast<float>(mFixedTimestep), mJobSystem);
+
+            mFixedAccumulator -= mFixedTimestep;
+            steps++;
+        }
+
+        if (steps == mMAX_FIXED_STEPS) {
+            mFixedAccumulator = std::min(mFixedAccumulator, mFixedTimestep);
+        }
+    }
+
+    void Application::mPollGamepads()
+    {
+        mGamepad.Poll();
+
+        for (uint32_t pad = 0; pad < Gamepad::MAX_GAMEPADS; pad++)
+        {
+            const Gamepad::Snapshot& current = mGamepad.GetSnapshot(pad);
+            const Gamepad::Snapshot& previous = mGamepad.GetPreviousSnapshot(pad);
+            if (current.mConnected != previous.mConnected || current.mButtons != previous.mButtons || current.mAxes != previous.mAxes)
+            {
+                mInvalidate();
+                break;
+            }
+        }
+
+        uint32_t pad = mGamepad.GetPrimary();
+        const Gamepad::Snapshot* snapshot = pad != Gamepad::NONE ? &mGamepad.GetSnapshot(pad) : nullptr;
+
+        for (uint32_t button = 0; button < Gamepad::BUTTON_COUNT; button++) {
+            mActionMap.OnGamepadButton(button, snapshot != nullptr && ((snapshot->mButtons >> button) & 1));
+        }
+        for (uint32_t axis = 0; axis < Gamepad::AXIS_COUNT; axis++) {
+            mActionMap.OnGamepadAxis(axis, snapshot != nullptr ? snapshot->mAxes[axis] : 0.0f);
+        }
+    }
+
+    void Application::mPresentWindows()
+    {
+        std::chrono::steady_clock::time_point now = mSteadyClock.now();
+        bool switched = false;
+
+        for (const std::unique_ptr<SharedWindow>& shared : mSharedWindows)
+        {
+            Window& window = *shared->mWindow;
+            if (!window.mPresentDue(now)) {
+                continue;
+            }
+
+            window.MakeCurrent();
+            switched = true;
+
+            window.mRenderer(window);
+            window.SwapBuffers();
+        }
+
+        if (switched) {
+            mWindow.MakeCurrent();
+        }
+    }
+
+    void Application::mInvalidate() {
+        mRedrawFrames = std::max(mRedrawFrames, mINPUT_REDRAW_FRAMES);
     }
 
-	void Application::mDisconnectMonitor(GLFWmonitor* monitor) {
-        Monitor::mDisconnect(monitor);
+    [[nodiscard]] bool Application::mShouldRender()
+    {
+        if (mRenderMode == RenderMode::CONTINUOUS) {
+            return true;
+        }
+
+        std::chrono::steady_clock::time_point now = mSteadyClock.now();
+        while (!mRedrawTimers.empty() && mRedrawTimers.top() <= now)
+        {
+            mRedrawTimers.pop();
+            RequestRedraw();
+        }
+
+        #ifdef TIMGE_ENABLE_IMGUI
+            if (ImGui::IsAnyItemActive()) {
+                RequestRedraw();
+            }
+        #endif // TIMGE_ENABLE_IMGUI
+
+        if (mRedrawFrames == 0) {
+            return false;
+        }
+
+        mRedrawFrames--;
+        return true;
+    }
+
+    [[nodiscard]] double Application::mWaitForEvents()
+    {
+        // A recording or replay has to see one event pass per frame with the
+        // frame it belongs to, so idle waiting is suspended while either runs.
+        if (Input::Recorder::GetActive() != nullptr || Input::Replayer::GetActive() != nullptr) {
+            return 0.0;
+        }
+
+        std::chrono::steady_clock::time_point start = mSteadyClock.now();
+
+        double timeout = mIdleTimeout;
+        if (!mRedrawTimers.empty()) {
+            timeout = std::clamp(std::chrono::duration<double>(mRedrawTimers.top() - start).count(), 0.0, timeout);
+        }
+
+        WaitEventsTimeout(timeout);
+
+        return std::chrono::duration<double>(mSteadyClock.now() - start).count();
+    }
+
+    void Application::mInstallCallbacks(Window& window, Callback::Route& route)
+    {
+        GLFWwindow* handle = window.mGetWindow();
+
+        glfwSetWindowUserPointer(handle, &route);
+        glfwSetWindowPosCallback(handle, Callback::WindowPosCallback);
+        glfwSetWindowSizeCallback(handle, Callback::WindowSizeCallback);
+        glfwSetWindowCloseCallback(handle, Callback::WindowCloseCallback);
+        glfwSetWindowRefreshCallback(handle, Callback::WindowRefreshCallback);
+        glfwSetWindowFocusCallback(handle, Callback::WindowFocusCallback);
+        glfwSetWindowIconifyCallback(handle, Callback::WindowIconifyCallback);
+        glfwSetWindowMaximizeCallback(handle, Callback::WindowMaximizeCallback);
+        glfwSetFramebufferSizeCallback(handle, Callback::FramebufferSizeCallback);
+        glfwSetWindowContentScaleCallback(handle, Callback::WindowContentScaleCallback);
+        glfwSetMouseButtonCallback(handle, Callback::MouseButtonCallback);
+        glfwSetCursorPosCallback(handle, Callback::CursorPosCallback);
+        glfwSetCursorEnterCallback(handle, Callback::CursorEnterCallback);
+        glfwSetScrollCallback(handle, Callback::ScrollCallback);
+        glfwSetKeyCallback(handle, Callback::KeyCallback);
+        glfwSetCharCallback(handle, Callback::CharCallback);
+        glfwSetCharModsCallback(handle, Callback::CharModsCallback);
+        glfwSetDropCallback(handle, Callback::DropCallback);
+    }
+
+    void Application::mRefreshMonitors()
+    {
+        Monitor::mInvalidate();
+
+        if (const Monitor* monitor = Monitor::mFind(mMonitor.mMonitor); monitor != nullptr)
+        {
+            mMonitor = *monitor;
+        }
+        else if (!Monitor::GetMonitors().empty())
+        {
+            // The old copy points at a monitor that is gone, so the primary one
+            // takes its place along with the window's fullscreen target.
+            mMonitor = Monitor::GetPrimaryMonitor();
+            mWindow.mRetrieveMonitor();
+            mWindow.mRetrieveVideoMode();
+        }
     }
 
     void Application::mSetCursorPosition(const V2d& cursorPosition) {
-        mMouse.mPosition = cursorPosition;
+        mMouse.mMove(cursorPosition);
+    }
+
+    void Application::mSetCursorEntered(bool entered) {
+        mMouse.mEnter(entered);
     }
 
     void Application::mSetScrollOffset(const V2d& cursorScrollOffset) {
-        mMouse.mOffset = cursorScrollOffset;
+        mMouse.mAddScroll(cursorScrollOffset);
+    }
+
+    void Application::mSetPosition(Window& window, const V2i32& position) {
+        window.mInfo.mPosition = position;
     }
 
-    void Application::mSetPosition(const V2i32& position) {
-        mWindow.mInfo.mPosition = position;
+	void Application::mSetSize(Window& window, const V2ui32& size) {
+        window.mInfo.mSize = size;
     }
 
-	void Application::mSetSize(const V2ui32& size) {
-        mWindow.mInfo.mSize = size;
+	void Application::mSetFramebufferSize(Window& window, const V2ui32& framebufferSize) {
+       window.mFramebufferSize = framebufferSize; 
     }
 
-	void Application::mSetFramebufferSize(const V2ui32& framebufferSize) {
-       mWindow.mFramebufferSize = framebufferSize; 
+    void Application::mSetFrameSize(Window& window, const V4ui32& frameSize) {
+        window.mFrameSize = frameSize;
     }
 
-    void Application::mSetFrameSize(const V4ui32& frameSize) {
-        mWindow.mFrameSize = frameSize;
+	void Application::mSetContentScale(Window& window, const V2f& contentScale) {
+        window.mContentScale = contentScale;
     }
 
-	void Application::mSetContentScale(const V2f& contentScale) {
-        mWindow.mContentScale = contentScale;
+    void Application::mToggleFlags(Window& window, Window::FLAGS flags) {
+        window.mInfo.mFlags ^= flags;
     }
 }
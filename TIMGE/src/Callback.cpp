@@ -1,5 +1,7 @@
 #include "TIMGE/Callback.hpp"
 #include "TIMGE/Application.hpp"
+#include "TIMGE/Input/Recorder.hpp"
+#include "TIMGE/Input/Replayer.hpp"
 #include "TIMGE/Utils/Vector.hpp"
 #ifdef TIMGE_ENABLE_IMGUI
 #include <imgui_impl_glfw.h>
@@ -7,177 +9,323 @@
 
 #include <GLFW/glfw3.h>
 
+#include <array>
 #include <cstdint>
 
 namespace TIMGE::Callback
 {
+    namespace
+    {
+        [[nodiscard]] Route& GetRoute(GLFWwindow* window) {
+            return *static_cast<Route*>(glfwGetWindowUserPointer(window));
+        }
+
+        [[nodiscard]] bool Muted()
+        {
+            Input::Replayer* replayer = Input::Replayer::GetActive();
+            return replayer != nullptr && !replayer->IsDispatching();
+        }
+
+        void Record(Input::EventType type, const std::array<int32_t, 4>& integers = {}, const std::array<double, 2>& reals = {})
+        {
+            if (Input::Recorder* recorder = Input::Recorder::GetActive(); recorder != nullptr) {
+                recorder->Record(type, integers, reals);
+            }
+        }
+    }
+
     void ErrorCallback(int errorCode, const char* description)
     {
         Application* app = Application::mGetInstance();
         if (auto func = app->mInfo.mCallbacks.mError; func != nullptr) {
             func(errorCode, description);
         }
+        app->mEventBus.Publish(ErrorEvent{ errorCode, description });
     }
     void WindowPosCallback(GLFWwindow* window, int xPos, int yPos)
     {
-        Application* app = Application::mGetInstance();
-        app->mSetPosition({ xPos, yPos });
-        if (auto func = app->mInfo.mCallbacks.mWindowPos; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        app->mSetPosition(*route.mWindow, { xPos, yPos });
+        if (auto func = route.mCallbacks->mWindowPos; func != nullptr) {
             func({xPos, yPos});
         }
+        app->mEventBus.Publish(WindowPosEvent{ route.mWindow, { xPos, yPos } });
     }
     void WindowSizeCallback(GLFWwindow* window, int width, int height)
     {
-        Application* app = Application::mGetInstance();
-        app->mSetSize({
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        app->mSetSize(*route.mWindow, {
             static_cast<uint32_t>(width),
             static_cast<uint32_t>(height)
         });
-        if (auto func = app->mInfo.mCallbacks.mWindowSize; func != nullptr) {
+        if (auto func = route.mCallbacks->mWindowSize; func != nullptr) {
             func({
                 static_cast<uint32_t>(width),
                 static_cast<uint32_t>(height)
             });
         }
+        app->mEventBus.Publish(WindowSizeEvent{ route.mWindow, { static_cast<uint32_t>(width), static_cast<uint32_t>(height) } });
     }
     void WindowCloseCallback(GLFWwindow* window)
     {
-        Application* app = Application::mGetInstance();
-        if (auto func = app->mInfo.mCallbacks.mWindowClose; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (auto func = route.mCallbacks->mWindowClose; func != nullptr) {
             func();
         }
+        app->mEventBus.Publish(WindowCloseEvent{ route.mWindow });
     }
     void WindowRefreshCallback(GLFWwindow* window)
     {
-        Application* app = Application::mGetInstance();
-        if (auto func = app->mInfo.mCallbacks.mWindowRefresh; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (auto func = route.mCallbacks->mWindowRefresh; func != nullptr) {
             func();
         }
+        app->mEventBus.Publish(WindowRefreshEvent{ route.mWindow });
     }
     void WindowFocusCallback(GLFWwindow* window, int focused)
     {
+        Route& route = GetRoute(window);
         #ifdef TIMGE_ENABLE_IMGUI
-        ImGui_ImplGlfw_WindowFocusCallback(window, focused);
+        if (route.mPrimary) {
+            ImGui_ImplGlfw_WindowFocusCallback(window, focused);
+        }
         #endif // TIMGE_ENABLE_IMGUI
-        Application* app = Application::mGetInstance();
-        app->mInfo.mWindowInfo.mFlags ^= Window::FOCUSED;
-        if (auto func = app->mInfo.mCallbacks.mWindowFocus; func != nullptr) {
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        app->mToggleFlags(*route.mWindow, Window::FOCUSED);
+        if (auto func = route.mCallbacks->mWindowFocus; func != nullptr) {
             func(focused);
         }
+        app->mEventBus.Publish(WindowFocusEvent{ route.mWindow, focused == GLFW_TRUE });
     }
     void WindowIconifyCallback(GLFWwindow* window, int iconified)
     {
-        Application* app = Application::mGetInstance();
-        app->mInfo.mWindowInfo.mFlags ^= Window::MINIMIZED;
-        if (auto func = app->mInfo.mCallbacks.mWindowIconify; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        app->mToggleFlags(*route.mWindow, Window::MINIMIZED);
+        if (auto func = route.mCallbacks->mWindowIconify; func != nullptr) {
             func(iconified);
         }
+        app->mEventBus.Publish(WindowIconifyEvent{ route.mWindow, iconified == GLFW_TRUE });
     }
     void WindowMaximizeCallback(GLFWwindow* window, int maximized)
     {
-        Application* app = Application::mGetInstance();
-        app->mInfo.mWindowInfo.mFlags ^= Window::MAXIMIZED;
-        if (auto func = app->mInfo.mCallbacks.mWindowMaximize; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        app->mToggleFlags(*route.mWindow, Window::MAXIMIZED);
+        if (auto func = route.mCallbacks->mWindowMaximize; func != nullptr) {
             func(maximized);
         }
+        app->mEventBus.Publish(WindowMaximizeEvent{ route.mWindow, maximized == GLFW_TRUE });
     }
     void FramebufferSizeCallback(GLFWwindow* window, int width, int height)
     {
-        Application* app = Application::mGetInstance();
-        app->mSetFramebufferSize({
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        app->mSetFramebufferSize(*route.mWindow, {
             static_cast<uint32_t>(width),
             static_cast<uint32_t>(height)
         });
-        if (auto func = app->mInfo.mCallbacks.mFramebufferSize; func != nullptr) {
+        if (auto func = route.mCallbacks->mFramebufferSize; func != nullptr) {
             func({
                 static_cast<uint32_t>(width),
                 static_cast<uint32_t>(height)
             });
         }
+        app->mEventBus.Publish(FramebufferSizeEvent{ route.mWindow, { static_cast<uint32_t>(width), static_cast<uint32_t>(height) } });
     }
     void WindowContentScaleCallback(GLFWwindow* window, float xScale, float yScale)
     {
-        Application* app = Application::mGetInstance();
-        app->mSetContentScale({ xScale, yScale });
-        if (auto func = app->mInfo.mCallbacks.mWindowContentScale; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        app->mSetContentScale(*route.mWindow, { xScale, yScale });
+        if (auto func = route.mCallbacks->mWindowContentScale; func != nullptr) {
             func({xScale, yScale});
         }
+        app->mEventBus.Publish(WindowContentScaleEvent{ route.mWindow, { xScale, yScale } });
     }
     void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
     {
-        #ifdef TIMGE_ENABLE_IMGUI
-        ImGui_ImplGlfw_MouseButtonCallback(window, button, action, mods);
-        #endif // TIMGE_ENABLE_IMGUI
-        Application* app = Application::mGetInstance();
-        if (auto func = app->mInfo.mCallbacks.mMouseButton; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (route.mPrimary)
+        {
+            if (Muted()) {
+                return;
+            }
+            Record(Input::EventType::MOUSE_BUTTON, { button, action, mods });
+
+            #ifdef TIMGE_ENABLE_IMGUI
+            ImGui_ImplGlfw_MouseButtonCallback(window, button, action, mods);
+            #endif // TIMGE_ENABLE_IMGUI
+            app->mLatencyTracker.OnInput(Input::LatencyTracker::Source::MOUSE_BUTTON);
+            app->mActionMap.OnMouseButton(static_cast<Button>(button), static_cast<Mouse::Action>(action), static_cast<Modifier>(mods));
+        }
+        if (auto func = route.mCallbacks->mMouseButton; func != nullptr) {
             func(static_cast<Button>(button), static_cast<Mouse::Action>(action), static_cast<Modifier>(mods));
         }
+        app->mEventBus.Publish(MouseButtonEvent{ route.mWindow, static_cast<Button>(button), static_cast<Mouse::Action>(action), static_cast<Modifier>(mods) });
     }
     void CursorPosCallback(GLFWwindow* window, double xPos, double yPos)
     {
-        #ifdef TIMGE_ENABLE_IMGUI
-        ImGui_ImplGlfw_CursorPosCallback(window, xPos, yPos);
-        #endif // TIMGE_ENABLE_IMGUI
-        Application* app = Application::mGetInstance();
-        app->mSetCursorPosition({ xPos, yPos });
-        if (auto func = app->mInfo.mCallbacks.mCursorPos; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (route.mPrimary)
+        {
+            if (Muted()) {
+                return;
+            }
+            Record(Input::EventType::CURSOR_POS, {}, { xPos, yPos });
+
+            #ifdef TIMGE_ENABLE_IMGUI
+            ImGui_ImplGlfw_CursorPosCallback(window, xPos, yPos);
+            #endif // TIMGE_ENABLE_IMGUI
+            app->mLatencyTracker.OnInput(Input::LatencyTracker::Source::CURSOR_POS);
+            app->mSetCursorPosition({ xPos, yPos });
+        }
+        if (auto func = route.mCallbacks->mCursorPos; func != nullptr) {
             func({xPos, yPos});
         }
+        app->mEventBus.Publish(CursorPosEvent{ route.mWindow, { xPos, yPos } });
     }
     void CursorEnterCallback(GLFWwindow* window, int entered)
     {
-        #ifdef TIMGE_ENABLE_IMGUI
-        ImGui_ImplGlfw_CursorEnterCallback(window, entered);
-        #endif // TIMGE_ENABLE_IMGUI
-        Application* app = Application::mGetInstance();
-        if (auto func = app->mInfo.mCallbacks.mCursorEnter; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (route.mPrimary)
+        {
+            if (Muted()) {
+                return;
+            }
+            Record(Input::EventType::CURSOR_ENTER, { entered });
+
+            #ifdef TIMGE_ENABLE_IMGUI
+            ImGui_ImplGlfw_CursorEnterCallback(window, entered);
+            #endif // TIMGE_ENABLE_IMGUI
+            app->mSetCursorEntered(entered == GLFW_TRUE);
+        }
+        if (auto func = route.mCallbacks->mCursorEnter; func != nullptr) {
             func(entered);
         }
+        app->mEventBus.Publish(CursorEnterEvent{ route.mWindow, entered == GLFW_TRUE });
     }
     void ScrollCallback(GLFWwindow* window, double xOffset, double yOffset)
     {
-        #ifdef TIMGE_ENABLE_IMGUI
-        ImGui_ImplGlfw_ScrollCallback(window, xOffset, yOffset);
-        #endif // TIMGE_ENABLE_IMGUI
-        Application* app = Application::mGetInstance();
-        app->mSetScrollOffset({ xOffset, yOffset });
-        if (auto func = app->mInfo.mCallbacks.mScroll; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (route.mPrimary)
+        {
+            if (Muted()) {
+                return;
+            }
+            Record(Input::EventType::SCROLL, {}, { xOffset, yOffset });
+
+            #ifdef TIMGE_ENABLE_IMGUI
+            ImGui_ImplGlfw_ScrollCallback(window, xOffset, yOffset);
+            #endif // TIMGE_ENABLE_IMGUI
+            app->mLatencyTracker.OnInput(Input::LatencyTracker::Source::SCROLL);
+            app->mSetScrollOffset({ xOffset, yOffset });
+        }
+        if (auto func = route.mCallbacks->mScroll; func != nullptr) {
             func({xOffset, yOffset});
         }
+        app->mEventBus.Publish(ScrollEvent{ route.mWindow, { xOffset, yOffset } });
     }
     void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
     {
-        #ifdef TIMGE_ENABLE_IMGUI
-        ImGui_ImplGlfw_KeyCallback(window, key, scancode, action, mods);
-        #endif // TIMGE_ENABLE_IMGUI
-        Application* app = Application::mGetInstance();
-        if (auto func = app->mInfo.mCallbacks.mKey; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (route.mPrimary)
+        {
+            if (Muted()) {
+                return;
+            }
+            Record(Input::EventType::KEY, { key, scancode, action, mods });
+
+            #ifdef TIMGE_ENABLE_IMGUI
+            ImGui_ImplGlfw_KeyCallback(window, key, scancode, action, mods);
+            #endif // TIMGE_ENABLE_IMGUI
+            app->mLatencyTracker.OnInput(Input::LatencyTracker::Source::KEY);
+            app->mActionMap.OnKey(static_cast<Key>(key), static_cast<Keyboard::Action>(action), static_cast<Modifier>(mods));
+        }
+        if (auto func = route.mCallbacks->mKey; func != nullptr) {
             func(static_cast<Key>(key), scancode, static_cast<Keyboard::Action>(action), static_cast<Modifier>(mods));
         }
+        app->mEventBus.Publish(KeyEvent{ route.mWindow, static_cast<Key>(key), scancode, static_cast<Keyboard::Action>(action), static_cast<Modifier>(mods) });
     }
     void CharCallback(GLFWwindow* window, unsigned int codepoint)
     {
-        #ifdef TIMGE_ENABLE_IMGUI
-        ImGui_ImplGlfw_CharCallback(window, codepoint);
-        #endif // TIMGE_ENABLE_IMGUI
-        Application* app = Application::mGetInstance();
-        if (auto func = app->mInfo.mCallbacks.mChar; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (route.mPrimary)
+        {
+            if (Muted()) {
+                return;
+            }
+            Record(Input::EventType::CHAR, { static_cast<int32_t>(codepoint) });
+
+            #ifdef TIMGE_ENABLE_IMGUI
+            ImGui_ImplGlfw_CharCallback(window, codepoint);
+            #endif // TIMGE_ENABLE_IMGUI
+        }
+        if (auto func = route.mCallbacks->mChar; func != nullptr) {
             func(codepoint);
         }
+        app->mEventBus.Publish(CharEvent{ route.mWindow, codepoint });
     }
     void CharModsCallback(GLFWwindow* window, unsigned int codepoint, int mods)
     {
-        Application* app = Application::mGetInstance();
-        if (auto func = app->mInfo.mCallbacks.mCharmods; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (route.mPrimary)
+        {
+            if (Muted()) {
+                return;
+            }
+            Record(Input::EventType::CHAR_MODS, { static_cast<int32_t>(codepoint), mods });
+        }
+        if (auto func = route.mCallbacks->mCharmods; func != nullptr) {
             func(codepoint, mods);
         }
+        app->mEventBus.Publish(CharModsEvent{ route.mWindow, codepoint, static_cast<Modifier>(mods) });
     }
     void DropCallback(GLFWwindow* window, int pathCount, const char* path[])
     {
-        Application* app = Application::mGetInstance();
-        if (auto func = app->mInfo.mCallbacks.mDrop; func != nullptr) {
+        Route& route = GetRoute(window);
+        Application* app = route.mApplication;
+        app->mInvalidate();
+        if (route.mPrimary)
+        {
+            if (Muted()) {
+                return;
+            }
+            if (Input::Recorder* recorder = Input::Recorder::GetActive(); recorder != nullptr) {
+                recorder->RecordDrop(pathCount, path);
+            }
+        }
+        if (auto func = route.mCallbacks->mDrop; func != nullptr) {
             func(pathCount, path);
         }
+        app->mEventBus.Publish(DropEvent{ route.mWindow, { path, static_cast<std::size_t>(pathCount) } });
     }
     void MonitorCallback(GLFWmonitor* monitor, int event)
     {
@@ -185,22 +333,26 @@ namespace TIMGE::Callback
         ImGui_ImplGlfw_MonitorCallback(monitor, event);
         #endif // TIMGE_ENABLE_IMGUI
         Application* app = Application::mGetInstance();
+        app->mInvalidate();
+        app->mRefreshMonitors();
 
-        if (event == GLFW_CONNECTED) {
-            Application::mConnectMonitor(monitor);
-        }
-        else if (event == GLFW_DISCONNECTED) {
-            Application::mDisconnectMonitor(monitor);
-        }
         if (auto func = app->mInfo.mCallbacks.mMonitor; func != nullptr) {
             func(event);
         }
+        app->mEventBus.Publish(MonitorEvent{ monitor, event });
     }
     void JoystickCallback(int jid, int event)
     {
+        if (Muted()) {
+            return;
+        }
+        Record(Input::EventType::JOYSTICK, { jid, event });
+
         Application* app = Application::mGetInstance();
+        app->mInvalidate();
         if (auto func = app->mInfo.mCallbacks.mJoystick; func != nullptr) {
             func(jid, event);
         }
+        app->mEventBus.Publish(JoystickEvent{ jid, event });
     }
 }
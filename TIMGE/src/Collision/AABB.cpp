@@ -0,0 +1,10 @@
+#include "TIMGE/Collision/AABB.hpp"
+
+#include <format>
+
+namespace TIMGE::Collision
+{
+    CollisionException::CollisionException(std::string message)
+     : Exception(std::format("Collision: {}", message))
+    {}
+}
@@ -0,0 +1,410 @@
+#include "TIMGE/Collision/AABBTree.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace TIMGE::Collision
+{
+    AABBTree::AABBTree(float margin)
+     : mMargin{margin},
+       mRoot{NULL_PROXY},
+       mFreeList{NULL_PROXY},
+       mProxyCount{0}
+    {
+        if (margin < 0.0f) {
+            throw CollisionException("AABB tree margin cannot be negative.");
+        }
+    }
+
+    [[maybe_unused]] Proxy AABBTree::CreateProxy(const AABB& bounds, uint32_t userData)
+    {
+        uint32_t leaf = mAllocateNode();
+        Node& node = mNodes[leaf];
+
+        node.mBounds = bounds;
+        node.mFatBounds = bounds.Fatten(mMargin);
+        node.mUserData = userData;
+        node.mHeight = 0;
+
+        mInsertLeaf(leaf);
+        mProxyCount++;
+
+        return leaf;
+    }
+
+    [[maybe_unused]] bool AABBTree::MoveProxy(Proxy proxy, const AABB& bounds)
+    {
+        (void)mGetLeaf(proxy);
+
+        Node& node = mNodes[proxy];
+        node.mBounds = bounds;
+
+        if (node.mFatBounds.Contains(bounds)) {
+            return false;
+        }
+
+        mRemoveLeaf(proxy);
+        mNodes[proxy].mFatBounds = bounds.Fatten(mMargin);
+        mInsertLeaf(proxy);
+
+        return true;
+    }
+
+    void AABBTree::DestroyProxy(Proxy proxy)
+    {
+        (void)mGetLeaf(proxy);
+
+        mRemoveLeaf(proxy);
+        mFreeNode(proxy);
+        mProxyCount--;
+    }
+
+    void AABBTree::SetUserData(Proxy proxy, uint32_t userData)
+    {
+        (void)mGetLeaf(proxy);
+        mNodes[proxy].mUserData = userData;
+    }
+
+    void AABBTree::Clear()
+    {
+        mNodes.clear();
+        mRoot = NULL_PROXY;
+        mFreeList = NULL_PROXY;
+        mProxyCount = 0;
+    }
+
+    void AABBTree::FindPairs(std::vector<Pair>& pairs)
+    {
+        if (mRoot == NULL_PROXY) {
+            return;
+        }
+
+        mPairStack.clear();
+        mPairStack.push_back({ mRoot, mRoot });
+
+        while (!mPairStack.empty())
+        {
+            auto [first, second] = mPairStack.back();
+            mPairStack.pop_back();
+
+            const Node& a = mNodes[first];
+            const Node& b = mNodes[second];
+
+            if (first == second)
+            {
+                if (!a.IsLeaf())
+                {
+                    mPairStack.push_back({ a.mChildren[0], a.mChildren[0] });
+                    mPairStack.push_back({ a.mChildren[1], a.mChildren[1] });
+                    mPairStack.push_back({ a.mChildren[0], a.mChildren[1] });
+                }
+                continue;
+            }
+
+            if (!a.mFatBounds.Overlaps(b.mFatBounds)) {
+                continue;
+            }
+
+            if (a.IsLeaf() && b.IsLeaf())
+            {
+                if (a.mBounds.Overlaps(b.mBounds)) {
+                    pairs.push_back({ a.mUserData, b.mUserData });
+                }
+                continue;
+            }
+
+            if (b.IsLeaf() || (!a.IsLeaf() && a.mFatBounds.GetPerimeter() > b.mFatBounds.GetPerimeter()))
+            {
+                mPairStack.push_back({ a.mChildren[0], second });
+                mPairStack.push_back({ a.mChildren[1], second });
+            }
+            else
+            {
+                mPairStack.push_back({ first, b.mChildren[0] });
+                mPairStack.push_back({ first, b.mChildren[1] });
+            }
+        }
+    }
+
+    void AABBTree::QueryRegion(const AABB& region, std::vector<uint32_t>& results)
+    {
+        if (mRoot == NULL_PROXY) {
+            return;
+        }
+
+        mStack.clear();
+        mStack.push_back(mRoot);
+
+        while (!mStack.empty())
+        {
+            const Node& node = mNodes[mStack.back()];
+            mStack.pop_back();
+
+            if (!node.mFatBounds.Overlaps(region)) {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                if (node.mBounds.Overlaps(region)) {
+                    results.push_back(node.mUserData);
+                }
+                continue;
+            }
+
+            mStack.push_back(node.mChildren[0]);
+            mStack.push_back(node.mChildren[1]);
+        }
+    }
+
+    void AABBTree::Raycast(const Ray& ray, std::vector<RaycastHit>& hits)
+    {
+        if (mRoot == NULL_PROXY) {
+            return;
+        }
+
+        std::size_t firstHit = hits.size();
+        mStack.clear();
+        mStack.push_back(mRoot);
+
+        while (!mStack.empty())
+        {
+            const Node& node = mNodes[mStack.back()];
+            mStack.pop_back();
+
+            float distance;
+            if (!node.mFatBounds.Raycast(ray, distance)) {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                if (node.mBounds.Raycast(ray, distance)) {
+                    hits.push_back({ node.mUserData, distance });
+                }
+                continue;
+            }
+
+            mStack.push_back(node.mChildren[0]);
+            mStack.push_back(node.mChildren[1]);
+        }
+
+        std::sort(hits.begin() + firstHit, hits.end(), [](const RaycastHit& first, const RaycastHit& second) {
+            return first.mDistance < second.mDistance;
+        });
+    }
+
+    [[nodiscard]] const AABB& AABBTree::GetBounds(Proxy proxy) const {
+        return mGetLeaf(proxy).mBounds;
+    }
+
+    [[nodiscard]] const AABB& AABBTree::GetFatBounds(Proxy proxy) const {
+        return mGetLeaf(proxy).mFatBounds;
+    }
+
+    [[nodiscard]] uint32_t AABBTree::GetHeight() const {
+        return mRoot == NULL_PROXY ? 0 : static_cast<uint32_t>(mNodes[mRoot].mHeight);
+    }
+
+    [[nodiscard]] float AABBTree::GetMargin() const {
+        return mMargin;
+    }
+
+    [[nodiscard]] std::size_t AABBTree::GetProxyCount() const {
+        return mProxyCount;
+    }
+
+    [[nodiscard]] uint32_t AABBTree::mAllocateNode()
+    {
+        uint32_t index;
+        if (mFreeList != NULL_PROXY)
+        {
+            index = mFreeList;
+            mFreeList = mNodes[index].mParent;
+        }
+        else
+        {
+            index = static_cast<uint32_t>(mNodes.size());
+            mNodes.emplace_back();
+        }
+
+        Node& node = mNodes[index];
+        node.mParent = NULL_PROXY;
+        node.mChildren[0] = NULL_PROXY;
+        node.mChildren[1] = NULL_PROXY;
+        node.mHeight = 0;
+
+        return index;
+    }
+
+    void AABBTree::mFreeNode(uint32_t node)
+    {
+        mNodes[node].mParent = mFreeList;
+        mNodes[node].mHeight = -1;
+        mFreeList = node;
+    }
+
+    void AABBTree::mInsertLeaf(uint32_t leaf)
+    {
+        if (mRoot == NULL_PROXY)
+        {
+            mRoot = leaf;
+            mNodes[leaf].mParent = NULL_PROXY;
+            return;
+        }
+
+        AABB leafBounds = mNodes[leaf].mFatBounds;
+        uint32_t sibling = mRoot;
+
+        while (!mNodes[sibling].IsLeaf())
+        {
+            const Node& node = mNodes[sibling];
+            float area = node.mFatBounds.GetPerimeter();
+            float combinedArea = node.mFatBounds.Merge(leafBounds).GetPerimeter();
+
+            float cost = 2.0f * combinedArea;
+            float inheritanceCost = 2.0f * (combinedArea - area);
+
+            float childCosts[2];
+            for (int i = 0; i < 2; i++)
+            {
+                const Node& child = mNodes[node.mChildren[i]];
+                float merged = child.mFatBounds.Merge(leafBounds).GetPerimeter();
+                childCosts[i] = child.IsLeaf()
+                    ? merged + inheritanceCost
+                    : merged - child.mFatBounds.GetPerimeter() + inheritanceCost;
+            }
+
+            if (cost < childCosts[0] && cost < childCosts[1]) {
+                break;
+            }
+
+            sibling = childCosts[0] < childCosts[1] ? node.mChildren[0] : node.mChildren[1];
+        }
+
+        uint32_t oldParent = mNodes[sibling].mParent;
+        uint32_t newParent = mAllocateNode();
+
+        mNodes[newParent].mParent = oldParent;
+        mNodes[newParent].mFatBounds = leafBounds.Merge(mNodes[sibling].mFatBounds);
+        mNodes[newParent].mHeight = mNodes[sibling].mHeight + 1;
+        mNodes[newParent].mChildren[0] = sibling;
+        mNodes[newParent].mChildren[1] = leaf;
+        mNodes[sibling].mParent = newParent;
+        mNodes[leaf].mParent = newParent;
+
+        if (oldParent == NULL_PROXY) {
+            mRoot = newParent;
+        }
+        else {
+            Node& parent = mNodes[oldParent];
+            parent.mChildren[parent.mChildren[0] == sibling ? 0 : 1] = newParent;
+        }
+
+        mRefit(mNodes[leaf].mParent);
+    }
+
+    void AABBTree::mRemoveLeaf(uint32_t leaf)
+    {
+        if (leaf == mRoot)
+        {
+            mRoot = NULL_PROXY;
+            return;
+        }
+
+        uint32_t parent = mNodes[leaf].mParent;
+        uint32_t grandParent = mNodes[parent].mParent;
+        uint32_t sibling = mNodes[parent].mChildren[mNodes[parent].mChildren[0] == leaf ? 1 : 0];
+
+        if (grandParent == NULL_PROXY)
+        {
+            mRoot = sibling;
+            mNodes[sibling].mParent = NULL_PROXY;
+            mFreeNode(parent);
+            return;
+        }
+
+        Node& grand = mNodes[grandParent];
+        grand.mChildren[grand.mChildren[0] == parent ? 0 : 1] = sibling;
+        mNodes[sibling].mParent = grandParent;
+        mFreeNode(parent);
+
+        mRefit(grandParent);
+    }
+
+    void AABBTree::mRefit(uint32_t index)
+    {
+        while (index != NULL_PROXY)
+        {
+            index = mBalance(index);
+
+            Node& node = mNodes[index];
+            const Node& first = mNodes[node.mChildren[0]];
+            const Node& second = mNodes[node.mChildren[1]];
+
+            node.mHeight = 1 + std::max(first.mHeight, second.mHeight);
+            node.mFatBounds = first.mFatBounds.Merge(second.mFatBounds);
+
+            index = node.mParent;
+        }
+    }
+
+    [[nodiscard]] uint32_t AABBTree::mBalance(uint32_t a)
+    {
+        Node& nodeA = mNodes[a];
+        if (nodeA.IsLeaf() || nodeA.mHeight < 2) {
+            return a;
+        }
+
+        uint32_t b = nodeA.mChildren[0];
+        uint32_t c = nodeA.mChildren[1];
+        int32_t balance = mNodes[c].mHeight - mNodes[b].mHeight;
+
+        if (balance >= -1 && balance <= 1) {
+            return a;
+        }
+
+        uint32_t up = balance > 1 ? c : b;
+        uint32_t down = balance > 1 ? b : c;
+        int upSlot = balance > 1 ? 1 : 0;
+
+        Node& nodeUp = mNodes[up];
+        uint32_t f = nodeUp.mChildren[0];
+        uint32_t g = nodeUp.mChildren[1];
+
+        nodeUp.mChildren[0] = a;
+        nodeUp.mParent = nodeA.mParent;
+        nodeA.mParent = up;
+
+        if (nodeUp.mParent == NULL_PROXY) {
+            mRoot = up;
+        }
+        else {
+            Node& parent = mNodes[nodeUp.mParent];
+            parent.mChildren[parent.mChildren[0] == a ? 0 : 1] = up;
+        }
+
+        uint32_t keep = mNodes[f].mHeight > mNodes[g].mHeight ? f : g;
+        uint32_t give = keep == f ? g : f;
+
+        nodeUp.mChildren[1] = keep;
+        nodeA.mChildren[upSlot] = give;
+        mNodes[give].mParent = a;
+
+        nodeA.mFatBounds = mNodes[down].mFatBounds.Merge(mNodes[give].mFatBounds);
+        nodeA.mHeight = 1 + std::max(mNodes[down].mHeight, mNodes[give].mHeight);
+        nodeUp.mFatBounds = nodeA.mFatBounds.Merge(mNodes[keep].mFatBounds);
+        nodeUp.mHeight = 1 + std::max(nodeA.mHeight, mNodes[keep].mHeight);
+
+        return up;
+    }
+
+    [[nodiscard]] const AABBTree::Node& AABBTree::mGetLeaf(Proxy proxy) const
+    {
+        if (proxy >= mNodes.size() || mNodes[proxy].mHeight != 0) {
+            throw CollisionException("Invalid AABB tree proxy.");
+        }
+
+        return mNodes[proxy];
+    }
+}
@@ -0,0 +1,299 @@
+#include "TIMGE/Collision/SpatialHash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace TIMGE::Collision
+{
+    SpatialHash::SpatialHash(float cellSize)
+     : mCellSize{cellSize},
+       mInverseCellSize{1.0f / cellSize},
+       mProxyCount{0},
+       mBucketMask{0},
+       mWorldBounds{},
+       mStamp{0},
+       mDirty{true}
+    {
+        if (!(cellSize > 0.0f)) {
+            throw CollisionException("Spatial hash cell size must be positive.");
+        }
+    }
+
+    [[maybe_unused]] Proxy SpatialHash::CreateProxy(const AABB& bounds, uint32_t userData)
+    {
+        Proxy proxy;
+        if (!mFreeProxies.empty())
+        {
+            proxy = mFreeProxies.back();
+            mFreeProxies.pop_back();
+        }
+        else
+        {
+            proxy = static_cast<Proxy>(mObjects.size());
+            mObjects.emplace_back();
+        }
+
+        mObjects[proxy] = { bounds, userData, 0, true };
+        mProxyCount++;
+        mDirty = true;
+
+        return proxy;
+    }
+
+    void SpatialHash::MoveProxy(Proxy proxy, const AABB& bounds)
+    {
+        mGetObject(proxy).mBounds = bounds;
+        mDirty = true;
+    }
+
+    void SpatialHash::DestroyProxy(Proxy proxy)
+    {
+        mGetObject(proxy).mAlive = false;
+        mFreeProxies.push_back(proxy);
+        mProxyCount--;
+        mDirty = true;
+    }
+
+    void SpatialHash::Clear()
+    {
+        mObjects.clear();
+        mFreeProxies.clear();
+        mProxyCount = 0;
+        mDirty = true;
+    }
+
+    void SpatialHash::FindPairs(std::vector<Pair>& pairs)
+    {
+        mRebuild();
+
+        for (uint32_t bucket = 0; bucket + 1 < mBucketStarts.size(); bucket++)
+        {
+            uint32_t begin = mBucketStarts[bucket];
+            uint32_t end = mBucketStarts[bucket + 1];
+
+            for (uint32_t i = begin; i < end; i++)
+            {
+                const Entry& first = mEntries[i];
+                const AABB& firstBounds = mObjects[first.mProxy].mBounds;
+
+                for (uint32_t j = i + 1; j < end; j++)
+                {
+                    const Entry& second = mEntries[j];
+                    if (first.mX != second.mX || first.mY != second.mY) {
+                        continue;
+                    }
+
+                    const AABB& secondBounds = mObjects[second.mProxy].mBounds;
+                    if (!firstBounds.Overlaps(secondBounds)) {
+                        continue;
+                    }
+
+                    int32_t ownerX = mToCell(std::max(firstBounds.mMin[V2f::X], secondBounds.mMin[V2f::X]));
+                    int32_t ownerY = mToCell(std::max(firstBounds.mMin[V2f::Y], secondBounds.mMin[V2f::Y]));
+                    if (ownerX == first.mX && ownerY == first.mY) {
+                        pairs.push_back({ mObjects[first.mProxy].mUserData, mObjects[second.mProxy].mUserData });
+                    }
+                }
+            }
+        }
+    }
+
+    void SpatialHash::QueryRegion(const AABB& region, std::vector<uint32_t>& results)
+    {
+        mRebuild();
+        if (mEntries.empty() || !region.Overlaps(mWorldBounds)) {
+            return;
+        }
+
+        mStamp++;
+
+        int32_t minX = mToCell(std::max(region.mMin[V2f::X], mWorldBounds.mMin[V2f::X]));
+        int32_t minY = mToCell(std::max(region.mMin[V2f::Y], mWorldBounds.mMin[V2f::Y]));
+        int32_t maxX = mToCell(std::min(region.mMax[V2f::X], mWorldBounds.mMax[V2f::X]));
+        int32_t maxY = mToCell(std::min(region.mMax[V2f::Y], mWorldBounds.mMax[V2f::Y]));
+
+        for (int32_t y = minY; y <= maxY; y++) {
+            for (int32_t x = minX; x <= maxX; x++) {
+                mVisitCell(x, y, region, results);
+            }
+        }
+    }
+
+    void SpatialHash::Raycast(const Ray& ray, std::vector<RaycastHit>& hits)
+    {
+        mRebuild();
+
+        float enter;
+        if (mEntries.empty() || !mWorldBounds.Raycast(ray, enter)) {
+            return;
+        }
+
+        mStamp++;
+        std::size_t firstHit = hits.size();
+
+        float dx = ray.mDirection[V2f::X];
+        float dy = ray.mDirection[V2f::Y];
+        float startX = ray.mOrigin[V2f::X] + dx * enter;
+        float startY = ray.mOrigin[V2f::Y] + dy * enter;
+
+        int32_t x = mToCell(startX);
+        int32_t y = mToCell(startY);
+        int32_t endX = mToCell(mWorldBounds.mMax[V2f::X]);
+        int32_t endY = mToCell(mWorldBounds.mMax[V2f::Y]);
+        int32_t beginX = mToCell(mWorldBounds.mMin[V2f::X]);
+        int32_t beginY = mToCell(mWorldBounds.mMin[V2f::Y]);
+
+        int32_t stepX = dx > 0.0f ? 1 : (dx < 0.0f ? -1 : 0);
+        int32_t stepY = dy > 0.0f ? 1 : (dy < 0.0f ? -1 : 0);
+
+        float infinity = std::numeric_limits<float>::infinity();
+        float deltaX = stepX ? mCellSize / std::abs(dx) : infinity;
+        float deltaY = stepY ? mCellSize / std::abs(dy) : infinity;
+        float nextX = stepX ? enter + ((x + (stepX > 0 ? 1 : 0)) * mCellSize - startX) / dx : infinity;
+        float nextY = stepY ? enter + ((y + (stepY > 0 ? 1 : 0)) * mCellSize - startY) / dy : infinity;
+
+        while (x >= beginX && x <= endX && y >= beginY && y <= endY)
+        {
+            uint32_t bucket = mGetBucket(x, y);
+            for (uint32_t i = mBucketStarts[bucket]; i < mBucketStarts[bucket + 1]; i++)
+            {
+                const Entry& entry = mEntries[i];
+                Object& object = mObjects[entry.mProxy];
+                if (entry.mX != x || entry.mY != y || object.mStamp == mStamp) {
+                    continue;
+                }
+                object.mStamp = mStamp;
+
+                float distance;
+                if (object.mBounds.Raycast(ray, distance)) {
+                    hits.push_back({ object.mUserData, distance });
+                }
+            }
+
+            float t = std::min(nextX, nextY);
+            if (t > ray.mMaxDistance) {
+                break;
+            }
+
+            if (nextX < nextY)
+            {
+                x += stepX;
+                nextX += deltaX;
+            }
+            else
+            {
+                y += stepY;
+                nextY += deltaY;
+            }
+        }
+
+        std::sort(hits.begin() + firstHit, hits.end(), [](const RaycastHit& first, const RaycastHit& second) {
+            return first.mDistance < second.mDistance;
+        });
+    }
+
+    [[nodiscard]] const AABB& SpatialHash::GetBounds(Proxy proxy) const
+    {
+        if (proxy >= mObjects.size() || !mObjects[proxy].mAlive) {
+            throw CollisionException("Invalid spatial hash proxy.");
+        }
+
+        return mObjects[proxy].mBounds;
+    }
+
+    [[nodiscard]] float SpatialHash::GetCellSize() const {
+        return mCellSize;
+    }
+
+    [[nodiscard]] std::size_t SpatialHash::GetProxyCount() const {
+        return mProxyCount;
+    }
+
+    void SpatialHash::mRebuild()
+    {
+        if (!mDirty) {
+            return;
+        }
+
+        mScratch.clear();
+        bool first = true;
+
+        for (Proxy proxy = 0; proxy < mObjects.size(); proxy++)
+        {
+            const Object& object = mObjects[proxy];
+            if (!object.mAlive) {
+                continue;
+            }
+
+            mWorldBounds = first ? object.mBounds : mWorldBounds.Merge(object.mBounds);
+            first = false;
+
+            int32_t minX = mToCell(object.mBounds.mMin[V2f::X]);
+            int32_t minY = mToCell(object.mBounds.mMin[V2f::Y]);
+            int32_t maxX = mToCell(object.mBounds.mMax[V2f::X]);
+            int32_t maxY = mToCell(object.mBounds.mMax[V2f::Y]);
+
+            for (int32_t y = minY; y <= maxY; y++) {
+                for (int32_t x = minX; x <= maxX; x++) {
+                    mScratch.push_back({ x, y, proxy });
+                }
+            }
+        }
+
+        uint32_t bucketCount = std::bit_ceil(std::max<uint32_t>(static_cast<uint32_t>(mScratch.size()), 64));
+        mBucketMask = bucketCount - 1;
+        mBucketStarts.assign(bucketCount + 1, 0);
+
+        for (const Entry& entry : mScratch) {
+            mBucketStarts[mGetBucket(entry.mX, entry.mY) + 1]++;
+        }
+        for (uint32_t i = 1; i <= bucketCount; i++) {
+            mBucketStarts[i] += mBucketStarts[i - 1];
+        }
+
+        mEntries.resize(mScratch.size());
+        mBucketCursors.assign(mBucketStarts.begin(), mBucketStarts.end() - 1);
+        for (const Entry& entry : mScratch) {
+            mEntries[mBucketCursors[mGetBucket(entry.mX, entry.mY)]++] = entry;
+        }
+
+        mDirty = false;
+    }
+
+    void SpatialHash::mVisitCell(int32_t x, int32_t y, const AABB& region, std::vector<uint32_t>& results)
+    {
+        uint32_t bucket = mGetBucket(x, y);
+        for (uint32_t i = mBucketStarts[bucket]; i < mBucketStarts[bucket + 1]; i++)
+        {
+            const Entry& entry = mEntries[i];
+            Object& object = mObjects[entry.mProxy];
+            if (entry.mX != x || entry.mY != y || object.mStamp == mStamp) {
+                continue;
+            }
+            object.mStamp = mStamp;
+
+            if (object.mBounds.Overlaps(region)) {
+                results.push_back(object.mUserData);
+            }
+        }
+    }
+
+    [[nodiscard]] SpatialHash::Object& SpatialHash::mGetObject(Proxy proxy)
+    {
+        if (proxy >= mObjects.size() || !mObjects[proxy].mAlive) {
+            throw CollisionException("Invalid spatial hash proxy.");
+        }
+
+        return mObjects[proxy];
+    }
+
+    [[nodiscard]] int32_t SpatialHash::mToCell(float coordinate) const {
+        return static_cast<int32_t>(std::floor(coordinate * mInverseCellSize));
+    }
+
+    [[nodiscard]] uint32_t SpatialHash::mGetBucket(int32_t x, int32_t y) const {
+        return ((static_cast<uint32_t>(x) * 73856093u) ^ (static_cast<uint32_t>(y) * 19349663u)) & mBucketMask;
+    }
+}
@@ -0,0 +1,538 @@
+#include "TIMGE/Config.hpp"
+#include "TIMGE/Monitor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <vector>
+
+namespace TIMGE
+{
+    namespace
+    {
+        using Parser_T = bool (*)(Config& config, std::string_view value);
+        using Printer_T = void (*)(const Config& config, std::string& text);
+
+        struct Field
+        {
+            std::string_view mSection;
+            std::string_view mName;
+            Window::FLAGS mFlag;
+            Parser_T mParse;
+            Printer_T mPrint;
+        };
+
+        constexpr std::string_view DONT_CARE = "dont_care";
+        constexpr std::string_view AUTOMATIC_SWAP = "AUTO";
+        constexpr std::array<std::string_view, 2> RENDER_MODE_NAMES = { "CONTINUOUS", "ON_DEMAND" };
+
+        [[nodiscard]] constexpr std::string_view Trim(std::string_view text)
+        {
+            std::size_t begin = text.find_first_not_of(" \t\r");
+            if (begin == std::string_view::npos) {
+                return {};
+            }
+            return text.substr(begin, text.find_last_not_of(" \t\r") - begin + 1);
+        }
+
+        [[nodiscard]] bool EqualsIgnoreCase(std::string_view first, std::string_view second)
+        {
+            return std::equal(first.begin(), first.end(), second.begin(), second.end(), [](char a, char b) {
+                return (a | 0x20) == (b | 0x20);
+            });
+        }
+
+        [[nodiscard]] bool ParseBool(std::string_view value, bool& result)
+        {
+            for (std::string_view name : { "on", "true", "yes", "1" })
+            {
+                if (EqualsIgnoreCase(value, name))
+                {
+                    result = true;
+                    return true;
+                }
+            }
+            for (std::string_view name : { "off", "false", "no", "0" })
+            {
+                if (EqualsIgnoreCase(value, name))
+                {
+                    result = false;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Whitespace separated numbers; dontCare stands in for "dont_care"
+        // where the window accepts it.
+        template<typename Type_T, std::size_t COUNT_T>
+        [[nodiscard]] bool ParseNumbers(std::string_view value, std::array<Type_T, COUNT_T>& numbers, const Type_T* dontCare = nullptr)
+        {
+            const char* current = value.data();
+            const char* end = value.data() + value.size();
+
+            for (Type_T& number : numbers)
+            {
+                while (current != end && (*current == ' ' || *current == '\t')) {
+                    current++;
+                }
+
+                const char* tokenEnd = std::find_if(current, end, [](char c) { return c == ' ' || c == '\t'; });
+                if (dontCare != nullptr && std::string_view(current, tokenEnd - current) == DONT_CARE)
+                {
+                    number = *dontCare;
+                    current = tokenEnd;
+                    continue;
+                }
+
+                auto [last, error] = std::from_chars(current, tokenEnd, number);
+                if (error != std::errc{} || last != tokenEnd || current == tokenEnd) {
+                    return false;
+                }
+                current = tokenEnd;
+            }
+
+            return Trim(std::string_view(current, end - current)).empty();
+        }
+
+        template<typename Type_T, std::size_t COUNT_T>
+        [[nodiscard]] bool ParseVector(std::string_view value, Vector<Type_T, COUNT_T>& vector, std::optional<Type_T> dontCare = std::nullopt)
+        {
+            std::array<Type_T, COUNT_T> numbers;
+            if (!ParseNumbers(value, numbers, dontCare ? &*dontCare : nullptr)) {
+                return false;
+            }
+            for (std::size_t i = 0; i < COUNT_T; i++) {
+                vector[i] = numbers[i];
+            }
+            return true;
+        }
+
+        template<typename Type_T>
+        [[nodiscard]] bool ParseNumber(std::string_view value, Type_T& number)
+        {
+            std::array<Type_T, 1> numbers;
+            if (!ParseNumbers(value, numbers)) {
+                return false;
+            }
+            number = numbers[0];
+            return true;
+        }
+
+        [[nodiscard]] bool ParseString(std::string_view value, std::string& result)
+        {
+            if (!value.empty() && value.front() == '"')
+            {
+                if (value.size() < 2 || value.back() != '"') {
+                    return false;
+                }
+                value = value.substr(1, value.size() - 2);
+            }
+            result = value;
+            return true;
+        }
+
+        template<typename Type_T, std::size_t COUNT_T>
+        void PrintVector(std::string& text, const Vector<Type_T, COUNT_T>& vector, std::optional<Type_T> dontCare = std::nullopt)
+        {
+            for (std::size_t i = 0; i < COUNT_T; i++)
+            {
+                text += i == 0 ? "" : " ";
+                if (dontCare && vector[i] == *dontCare) {
+                    text += DONT_CARE;
+                } else {
+                    text += std::format("{}", vector[i]);
+                }
+            }
+        }
+
+        template<Window::FLAGS FLAG_T>
+        [[nodiscard]] bool ParseFlag(Config& config, std::string_view value)
+        {
+            bool enabled;
+            if (!ParseBool(value, enabled)) {
+                return false;
+            }
+
+            Window::FLAGS& flags = config.GetWindowInfo().mFlags;
+            flags = enabled ? flags | FLAG_T : flags & ~FLAG_T;
+            return true;
+        }
+
+        template<Window::FLAGS FLAG_T>
+        void PrintFlag(const Config& config, std::string& text) {
+            text += config.GetWindowInfo().mFlags & FLAG_T ? "on" : "off";
+        }
+
+        constexpr auto FIELDS = std::to_array<Field>({
+            { "window", "title", 0,
+                [](Config& config, std::string_view value) {
+                    std::string title;
+                    if (!ParseString(value, title)) {
+                        return false;
+                    }
+                    config.SetTitle(std::move(title));
+                    return true;
+                },
+                [](const Config& config, std::string& text) { text += std::format("\"{}\"", config.GetWindowInfo().mTitle); } },
+            { "window", "size", 0,
+                [](Config& config, std::string_view value) { return ParseVector(value, config.GetWindowInfo().mSize); },
+                [](const Config& config, std::string& text) { PrintVector(text, config.GetWindowInfo().mSize); } },
+            { "window", "size_limits", 0,
+                [](Config& config, std::string_view value) { return ParseVector(value, config.GetWindowInfo().mSizeLimits, std::optional(SIZE_LIMITS_DONT_CARE)); },
+                [](const Config& config, std::string& text) { PrintVector(text, config.GetWindowInfo().mSizeLimits, std::optional(SIZE_LIMITS_DONT_CARE)); } },
+            { "window", "position", 0,
+                [](Config& config, std::string_view value) { return ParseVector(value, config.GetWindowInfo().mPosition, std::optional(POSITION_DONT_CARE)); },
+                [](const Config& config, std::string& text) { PrintVector(text, config.GetWindowInfo().mPosition, std::optional(POSITION_DONT_CARE)); } },
+            { "window", "aspect_ratio", 0,
+                [](Config& config, std::string_view value) { return ParseVector(value, config.GetWindowInfo().mAspectRatio, std::optional(ASPECT_RATIO_DONT_CARE)); },
+                [](const Config& config, std::string& text) { PrintVector(text, config.GetWindowInfo().mAspectRatio, std::optional(ASPECT_RATIO_DONT_CARE)); } },
+            { "window", "opacity", 0,
+                [](Config& config, std::string_view value) { return ParseNumber(value, config.GetWindowInfo().mOpacity); },
+                [](const Config& config, std::string& text) { text += std::format("{}", config.GetWindowInfo().mOpacity); } },
+            { "window", "opengl_version", 0,
+                [](Config& config, std::string_view value) { return ParseVector(value, config.GetWindowInfo().mOpenGLVersion); },
+                [](const Config& config, std::string& text) { PrintVector(text, config.GetWindowInfo().mOpenGLVersion); } },
+            { "window", "resizable", Window::RESIZABLE, ParseFlag<Window::RESIZABLE>, PrintFlag<Window::RESIZABLE> },
+            { "window", "visible", Window::VISIBLE, ParseFlag<Window::VISIBLE>, PrintFlag<Window::VISIBLE> },
+            { "window", "decorated", Window::DECORATED, ParseFlag<Window::DECORATED>, PrintFlag<Window::DECORATED> },
+            { "window", "focused", Window::FOCUSED, ParseFlag<Window::FOCUSED>, PrintFlag<Window::FOCUSED> },
+            { "window", "auto_iconify", Window::AUTO_ICONIFY, ParseFlag<Window::AUTO_ICONIFY>, PrintFlag<Window::AUTO_ICONIFY> },
+            { "window", "floating", Window::FLOATING, ParseFlag<Window::FLOATING>, PrintFlag<Window::FLOATING> },
+            { "window", "maximized", Window::MAXIMIZED, ParseFlag<Window::MAXIMIZED>, PrintFlag<Window::MAXIMIZED> },
+            { "window", "minimized", Window::MINIMIZED, ParseFlag<Window::MINIMIZED>, PrintFlag<Window::MINIMIZED> },
+            { "window", "center_cursor", Window::CENTER_CURSOR, ParseFlag<Window::CENTER_CURSOR>, PrintFlag<Window::CENTER_CURSOR> },
+            { "window", "transparent_framebuffer", Window::TRANSPARENT_FRAMEBUFFER, ParseFlag<Window::TRANSPARENT_FRAMEBUFFER>, PrintFlag<Window::TRANSPARENT_FRAMEBUFFER> },
+            { "window", "focus_on_show", Window::FOCUS_ON_SHOW, ParseFlag<Window::FOCUS_ON_SHOW>, PrintFlag<Window::FOCUS_ON_SHOW> },
+            { "window", "scale_to_monitor", Window::SCALE_TO_MONITOR, ParseFlag<Window::SCALE_TO_MONITOR>, PrintFlag<Window::SCALE_TO_MONITOR> },
+            { "window", "fullscreen", Window::FULLSCREEN, ParseFlag<Window::FULLSCREEN>, PrintFlag<Window::FULLSCREEN> },
+            { "window", "borderless_fullscreen", Window::BORDERLESS_FULLSCREEN, ParseFlag<Window::BORDERLESS_FULLSCREEN>, PrintFlag<Window::BORDERLESS_FULLSCREEN> },
+
+            { "monitor", "name", 0,
+                [](Config& config, std::string_view value) { return ParseString(value, config.GetMonitorSettings().mName); },
+                [](const Config& config, std::string& text) { text += std::format("\"{}\"", config.GetMonitorSettings().mName); } },
+            { "monitor", "video_mode", 0,
+                [](Config& config, std::string_view value) { return ParseVector(value, config.GetMonitorSettings().mVideoMode); },
+                [](const Config& config, std::string& text) { PrintVector(text, config.GetMonitorSettings().mVideoMode); } },
+            { "monitor", "refresh_rate", 0,
+                [](Config& config, std::string_view value) { return ParseNumber(value, config.GetMonitorSettings().mRefreshRate); },
+                [](const Config& config, std::string& text) { text += std::format("{}", config.GetMonitorSettings().mRefreshRate); } },
+            { "monitor", "gamma", 0,
+                [](Config& config, std::string_view value) { return ParseNumber(value, config.GetMonitorSettings().mGamma); },
+                [](const Config& config, std::string& text) { text += std::format("{}", config.GetMonitorSettings().mGamma); } },
+
+            { "renderer", "background", 0,
+                [](Config& config, std::string_view value) { return ParseVector(value, config.GetRendererSettings().mBackground); },
+                [](const Config& config, std::string& text) { PrintVector(text, config.GetRendererSettings().mBackground); } },
+            { "renderer", "swap", 0,
+                [](Config& config, std::string_view value) {
+                    Config::RendererSettings& renderer = config.GetRendererSettings();
+                    renderer.mAutomaticSwap = EqualsIgnoreCase(value, AUTOMATIC_SWAP);
+                    renderer.mSwapStrategy = SwapController::Strategy::COUNT;
+                    for (uint8_t i = 0; i < static_cast<uint8_t>(SwapController::Strategy::COUNT); i++) {
+                        if (EqualsIgnoreCase(value, SwapController::GetName(static_cast<SwapController::Strategy>(i)))) {
+                            renderer.mSwapStrategy = static_cast<SwapController::Strategy>(i);
+                        }
+                    }
+
+                    // Automatic switching starts out synchronized.
+                    if (renderer.mAutomaticSwap) {
+                        renderer.mSwapStrategy = SwapController::Strategy::VSYNC;
+                    } else if (renderer.mSwapStrategy == SwapController::Strategy::COUNT) {
+                        return false;
+                    }
+
+                    // The swap interval is first set when the window is created.
+                    bool vsync = renderer.mSwapStrategy != SwapController::Strategy::IMMEDIATE;
+                    Window::FLAGS& flags = config.GetWindowInfo().mFlags;
+                    flags = vsync ? flags | Window::VSYNC : flags & ~Window::VSYNC;
+                    return true;
+                },
+                [](const Config& config, std::string& text) {
+                    const Config::RendererSettings& renderer = config.GetRendererSettings();
+                    text += renderer.mAutomaticSwap ? AUTOMATIC_SWAP : SwapController::GetName(renderer.mSwapStrategy);
+                } },
+            { "renderer", "present_rate", 0,
+                [](Config& config, std::string_view value) { return ParseNumber(value, config.GetRendererSettings().mPresentRate); },
+                [](const Config& config, std::string& text) { text += std::format("{}", config.GetRendererSettings().mPresentRate); } },
+            { "renderer", "render_mode", 0,
+                [](Config& config, std::string_view value) {
+                    for (std::size_t i = 0; i < RENDER_MODE_NAMES.size(); i++) {
+                        if (EqualsIgnoreCase(value, RENDER_MODE_NAMES[i])) {
+                            config.GetRendererSettings().mRenderMode = static_cast<Application::RenderMode>(i);
+                            return true;
+                        }
+                    }
+                    return false;
+                },
+                [](const Config& config, std::string& text) { text += RENDER_MODE_NAMES[static_cast<std::size_t>(config.GetRendererSettings().mRenderMode)]; } },
+            { "renderer", "idle_timeout", 0,
+                [](Config& config, std::string_view value) { return ParseNumber(value, config.GetRendererSettings().mIdleTimeout); },
+                [](const Config& config, std::string& text) { text += std::format("{}", config.GetRendererSettings().mIdleTimeout); } },
+            { "renderer", "resolution_scaling", 0,
+                [](Config& config, std::string_view value) { return ParseBool(value, config.GetRendererSettings().mResolutionScaling); },
+                [](const Config& config, std::string& text) { text += config.GetRendererSettings().mResolutionScaling ? "on" : "off"; } },
+            { "renderer", "dynamic_resolution", 0,
+                [](Config& config, std::string_view value) { return ParseBool(value, config.GetRendererSettings().mDynamicResolution); },
+                [](const Config& config, std::string& text) { text += config.GetRendererSettings().mDynamicResolution ? "on" : "off"; } },
+            { "renderer", "resolution_scale", 0,
+                [](Config& config, std::string_view value) { return ParseNumber(value, config.GetRendererSettings().mResolutionScale); },
+                [](const Config& config, std::string& text) { text += std::format("{}", config.GetRendererSettings().mResolutionScale); } }
+        });
+
+        [[nodiscard]] consteval bool HasUniqueFields()
+        {
+            for (std::size_t i = 0; i < FIELDS.size(); i++) {
+                for (std::size_t j = i + 1; j < FIELDS.size(); j++) {
+                    if (FIELDS[i].mSection == FIELDS[j].mSection && FIELDS[i].mName == FIELDS[j].mName) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        // VSYNC is derived from the swap strategy rather than set directly.
+        [[nodiscard]] consteval bool CoversWindowFlags()
+        {
+            Window::FLAGS covered = Window::VSYNC;
+            for (const Field& field : FIELDS) {
+                covered |= field.mFlag;
+            }
+            return covered == (Window::MINIMIZED << 1) - 1;
+        }
+
+        static_assert(HasUniqueFields(), "Config fields must be unique.");
+        static_assert(CoversWindowFlags(), "Every window flag needs a config field.");
+    }
+
+    ConfigException::ConfigException(std::string message)
+     : Exception(std::format("Config: {}", message))
+    {}
+
+    Config::Config(const Application::Info& defaults)
+     : mInfo{defaults},
+       mTitle{defaults.mWindowInfo.mTitle},
+       mMonitor{ {}, V2ui32{ 0, 0 }, 0, 0.0f },
+       mRenderer{
+            defaults.mBackground,
+            defaults.mWindowInfo.mFlags & Window::VSYNC ? SwapController::Strategy::VSYNC : SwapController::Strategy::IMMEDIATE,
+            false,
+            0.0,
+            Application::RenderMode::CONTINUOUS,
+            0.25,
+            false,
+            true,
+            1.0f
+       }
+    {
+        mInfo.mWindowInfo.mTitle = mTitle;
+    }
+
+    Config::Config(const Config& config)
+     : mInfo{config.mInfo},
+       mTitle{config.mTitle},
+       mMonitor{config.mMonitor},
+       mRenderer{config.mRenderer}
+    {
+        mInfo.mWindowInfo.mTitle = mTitle;
+    }
+
+    Config& Config::operator=(const Config& config)
+    {
+        mInfo = config.mInfo;
+        mTitle = config.mTitle;
+        mMonitor = config.mMonitor;
+        mRenderer = config.mRenderer;
+        mInfo.mWindowInfo.mTitle = mTitle;
+        return *this;
+    }
+
+    void Config::Load(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if (!stream) {
+            throw ConfigException(std::format("Failed to open \"{}\"!", path.string()));
+        }
+
+        std::string text(static_cast<std::size_t>(stream.tellg()), '\0');
+        stream.seekg(0);
+        stream.read(text.data(), static_cast<std::streamsize>(text.size()));
+
+        Parse(text, path.string());
+    }
+
+    void Config::Parse(std::string_view text, std::string_view source)
+    {
+        // Parsed into a copy so a bad file leaves the current settings intact.
+        Config result(*this);
+        std::string_view section;
+        uint32_t lineNumber = 0;
+
+        while (!text.empty())
+        {
+            std::size_t lineEnd = text.find('\n');
+            std::string_view line = Trim(text.substr(0, lineEnd));
+            text = lineEnd == std::string_view::npos ? std::string_view{} : text.substr(lineEnd + 1);
+            lineNumber++;
+
+            if (line.empty() || line.front() == '#' || line.front() == ';') {
+                continue;
+            }
+
+            if (line.front() == '[')
+            {
+                if (line.back() != ']') {
+                    throw ConfigException(std::format("{}:{}: Unterminated section header.", source, lineNumber));
+                }
+                section = Trim(line.substr(1, line.size() - 2));
+                continue;
+            }
+
+            std::size_t equals = line.find('=');
+            if (equals == std::string_view::npos) {
+                throw ConfigException(std::format("{}:{}: Expected \"key = value\".", source, lineNumber));
+            }
+
+            std::string_view name = Trim(line.substr(0, equals));
+            std::string_view value = Trim(line.substr(equals + 1));
+
+            const Field* field = std::find_if(FIELDS.begin(), FIELDS.end(), [section, name](const Field& candidate) {
+                return candidate.mSection == section && candidate.mName == name;
+            });
+            if (field == FIELDS.end()) {
+                throw ConfigException(std::format("{}:{}: Unknown key \"{}\" in [{}].", source, lineNumber, name, section));
+            }
+            if (!field->mParse(result, value)) {
+                throw ConfigException(std::format("{}:{}: Invalid value \"{}\" for {}.", source, lineNumber, value, name));
+            }
+        }
+
+        result.mValidate(source);
+        *this = result;
+    }
+
+    void Config::Save(const std::filesystem::path& path) const
+    {
+        std::string text;
+        std::string_view section;
+        for (const Field& field : FIELDS)
+        {
+            if (field.mSection != section)
+            {
+                text += std::format("{}[{}]\n", section.empty() ? "" : "\n", field.mSection);
+                section = field.mSection;
+            }
+
+            text += std::format("{} = ", field.mName);
+            field.mPrint(*this, text);
+            text += '\n';
+        }
+
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+        if (!stream) {
+            throw ConfigException(std::format("Failed to write \"{}\"!", path.string()));
+        }
+    }
+
+    void Config::Apply(Application& application) const
+    {
+        if (!mMonitor.mName.empty() && application.GetMonitor().GetName() != mMonitor.mName)
+        {
+            // A monitor that is no longer connected leaves the window where it is.
+            const std::vector<Monitor>& monitors = Monitor::GetMonitors();
+            auto monitor = std::find_if(monitors.begin(), monitors.end(), [this](const Monitor& candidate) { return candidate.GetName() == mMonitor.mName; });
+            if (monitor != monitors.end()) {
+                application.SetMonitor(*monitor);
+            }
+        }
+
+        Window& window = application.GetWindow();
+        if (mMonitor.mVideoMode[V2ui32::WIDTH] != 0 && mMonitor.mVideoMode[V2ui32::HEIGHT] != 0) {
+            window.SetFullscreenMode(application.GetMonitor().GetBestVideoMode(mMonitor.mVideoMode, mMonitor.mRefreshRate));
+        }
+        if (mMonitor.mGamma > 0.0f) {
+            application.GetMonitor().SetGamma(mMonitor.mGamma);
+        }
+
+        SwapController::Strategy strategy = mRenderer.mSwapStrategy;
+        if (strategy == SwapController::Strategy::ADAPTIVE && !window.SupportsAdaptiveVSync()) {
+            strategy = SwapController::Strategy::VSYNC;
+        }
+
+        SwapController& swapController = application.GetSwapController();
+        swapController.SetStrategy(strategy);
+        swapController.SetAutomatic(mRenderer.mAutomaticSwap);
+        window.SetPresentRate(mRenderer.mPresentRate);
+
+        application.SetBackgroundColor(mRenderer.mBackground);
+        application.SetRenderMode(mRenderer.mRenderMode);
+        application.SetIdleTimeout(mRenderer.mIdleTimeout);
+
+        ResolutionScaler& resolutionScaler = application.GetResolutionScaler();
+        resolutionScaler.SetEnabled(mRenderer.mResolutionScaling);
+        resolutionScaler.SetDynamic(mRenderer.mDynamicResolution);
+        resolutionScaler.SetScale(mRenderer.mResolutionScale);
+    }
+
+    [[nodiscard]] const Application::Info& Config::GetInfo() const {
+        return mInfo;
+    }
+
+    [[nodiscard]] Window::Info& Config::GetWindowInfo() {
+        return mInfo.mWindowInfo;
+    }
+
+    [[nodiscard]] const Window::Info& Config::GetWindowInfo() const {
+        return mInfo.mWindowInfo;
+    }
+
+    [[nodiscard]] Config::MonitorSettings& Config::GetMonitorSettings() {
+        return mMonitor;
+    }
+
+    [[nodiscard]] const Config::MonitorSettings& Config::GetMonitorSettings() const {
+        return mMonitor;
+    }
+
+    [[nodiscard]] Config::RendererSettings& Config::GetRendererSettings() {
+        return mRenderer;
+    }
+
+    [[nodiscard]] const Config::RendererSettings& Config::GetRendererSettings() const {
+        return mRenderer;
+    }
+
+    void Config::SetTitle(std::string title)
+    {
+        mTitle = std::move(title);
+        mInfo.mWindowInfo.mTitle = mTitle;
+    }
+
+    // Only what the window cannot report better itself once it exists; sizes
+    // and the OpenGL version are still checked against the monitor and driver.
+    void Config::mValidate(std::string_view source) const
+    {
+        const Window::Info& window = mInfo.mWindowInfo;
+        if (const Window::FlagConflict* conflict = Window::FindFlagConflict(window.mFlags); conflict != nullptr) {
+            throw ConfigException(std::format("{}: {}", source, conflict->mMessage));
+        }
+        if (window.mSize[V2ui32::WIDTH] == 0 || window.mSize[V2ui32::HEIGHT] == 0) {
+            throw ConfigException(std::format("{}: Window size cannot be 0.", source));
+        }
+        if (!(window.mOpacity >= 0.0f && window.mOpacity <= 1.0f)) {
+            throw ConfigException(std::format("{}: Opacity must be in range [0;1].", source));
+        }
+        if (!(mRenderer.mIdleTimeout > 0.0) || mRenderer.mPresentRate < 0.0) {
+            throw ConfigException(std::format("{}: Idle timeout must be positive and present rate not negative.", source));
+        }
+        if (!(mRenderer.mResolutionScale >= ResolutionScaler::MIN_SCALE && mRenderer.mResolutionScale <= ResolutionScaler::MAX_SCALE)) {
+            throw ConfigException(std::format("{}: Resolution scale must be in range [{};{}].", source, ResolutionScaler::MIN_SCALE, ResolutionScaler::MAX_SCALE));
+        }
+    }
+}
@@ -0,0 +1,175 @@
+#include "TIMGE/ECS/Archetype.hpp"
+
+#include <format>
+
+namespace TIMGE::ECS
+{
+    Archetype::Archetype(Signature signature)
+     : mSignature{signature},
+       mCapacity{0},
+       mEntityCount{0}
+    {
+        mOffsets.fill(mNO_COLUMN);
+        mAddEdges.fill(nullptr);
+        mRemoveEdges.fill(nullptr);
+
+        for (ComponentID id = 0; id < MAX_COMPONENTS; id++) {
+            if (signature & (Signature{1} << id)) {
+                mComponents.push_back(id);
+            }
+        }
+
+        mComputeLayout();
+    }
+
+    Archetype::~Archetype()
+    {
+        for (auto& chunk : mChunks)
+        {
+            for (ComponentID id : mComponents)
+            {
+                const ComponentInfo& info = Component::GetInfo(id);
+                std::byte* column = chunk->mData + mOffsets[id];
+                for (uint32_t row = 0; row < chunk->mCount; row++) {
+                    info.mDestroy(column + row * info.mSize);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] Signature Archetype::GetSignature() const {
+        return mSignature;
+    }
+
+    [[nodiscard]] const std::vector<ComponentID>& Archetype::GetComponents() const {
+        return mComponents;
+    }
+
+    [[nodiscard]] bool Archetype::HasComponent(ComponentID id) const {
+        return id < MAX_COMPONENTS && (mSignature & (Signature{1} << id));
+    }
+
+    [[nodiscard]] uint32_t Archetype::GetChunkCapacity() const {
+        return mCapacity;
+    }
+
+    [[nodiscard]] std::size_t Archetype::GetChunkCount() const {
+        return mChunks.size();
+    }
+
+    [[nodiscard]] std::size_t Archetype::GetEntityCount() const {
+        return mEntityCount;
+    }
+
+    [[nodiscard]] Chunk& Archetype::GetChunk(std::size_t index) const {
+        return *mChunks[index];
+    }
+
+    [[nodiscard]] Entity* Archetype::GetEntities(Chunk& chunk) const {
+        return reinterpret_cast<Entity*>(chunk.mData);
+    }
+
+    [[nodiscard]] void* Archetype::GetColumn(Chunk& chunk, ComponentID id) const
+    {
+        if (!HasComponent(id)) {
+            throw ECSException(std::format("Archetype does not contain component {}.", id));
+        }
+
+        return chunk.mData + mOffsets[id];
+    }
+
+    [[nodiscard]] Archetype::Location Archetype::mAllocate(Entity entity)
+    {
+        if (mChunks.empty() || mChunks.back()->mCount == mCapacity)
+        {
+            if (mSpareChunk) {
+                mChunks.push_back(std::move(mSpareChunk));
+            } else {
+                mChunks.push_back(std::unique_ptr<Chunk>(new Chunk));
+            }
+            mChunks.back()->mCount = 0;
+        }
+
+        Chunk& chunk = *mChunks.back();
+        Location location{ static_cast<uint32_t>(mChunks.size() - 1), chunk.mCount++ };
+
+        new (GetEntities(chunk) + location.mRow) Entity(entity);
+        mEntityCount++;
+
+        return location;
+    }
+
+    [[nodiscard]] Entity Archetype::mRemove(Location location)
+    {
+        Chunk& chunk = *mChunks[location.mChunk];
+        Chunk& last = *mChunks.back();
+        uint32_t lastRow = last.mCount - 1;
+
+        for (ComponentID id : mComponents)
+        {
+            const ComponentInfo& info = Component::GetInfo(id);
+            info.mDestroy(chunk.mData + mOffsets[id] + location.mRow * info.mSize);
+        }
+
+        Entity moved{};
+        if (&chunk != &last || location.mRow != lastRow)
+        {
+            for (ComponentID id : mComponents)
+            {
+                const ComponentInfo& info = Component::GetInfo(id);
+                std::byte* source = last.mData + mOffsets[id] + lastRow * info.mSize;
+                info.mMoveConstruct(chunk.mData + mOffsets[id] + location.mRow * info.mSize, source);
+                info.mDestroy(source);
+            }
+
+            moved = GetEntities(last)[lastRow];
+            GetEntities(chunk)[location.mRow] = moved;
+        }
+
+        last.mCount--;
+        mEntityCount--;
+
+        if (last.mCount == 0)
+        {
+            mSpareChunk = std::move(mChunks.back());
+            mChunks.pop_back();
+        }
+
+        return moved;
+    }
+
+    [[nodiscard]] void* Archetype::mGetComponent(Location location, ComponentID id) const {
+        return mChunks[location.mChunk]->mData + mOffsets[id] + location.mRow * Component::GetInfo(id).mSize;
+    }
+
+    void Archetype::mComputeLayout()
+    {
+        std::size_t rowSize = sizeof(Entity);
+        for (ComponentID id : mComponents)
+        {
+            const ComponentInfo& info = Component::GetInfo(id);
+            if (info.mAlignment > alignof(Chunk)) {
+                throw ECSException(std::format("Component alignment cannot exceed {} bytes.", alignof(Chunk)));
+            }
+            rowSize += info.mSize;
+        }
+
+        for (mCapacity = static_cast<uint32_t>(CHUNK_SIZE / rowSize); mCapacity > 0; mCapacity--)
+        {
+            std::size_t offset = sizeof(Entity) * mCapacity;
+            for (ComponentID id : mComponents)
+            {
+                const ComponentInfo& info = Component::GetInfo(id);
+                offset = (offset + info.mAlignment - 1) / info.mAlignment * info.mAlignment;
+                mOffsets[id] = static_cast<uint32_t>(offset);
+                offset += info.mSize * mCapacity;
+            }
+
+            if (offset <= CHUNK_SIZE) {
+                return;
+            }
+        }
+
+        throw ECSException("Components of an archetype do not fit into a single chunk.");
+    }
+}
@@ -0,0 +1,110 @@
+#include "TIMGE/ECS/CommandBuffer.hpp"
+
+#include <algorithm>
+#include <memory>
+
+namespace TIMGE::ECS
+{
+    CommandBuffer::CommandBuffer()
+     : mBlockIndex{0},
+       mBlockOffset{0}
+    {}
+
+    CommandBuffer::CommandBuffer(CommandBuffer&& commandBuffer) noexcept
+     : mCommands{std::move(commandBuffer.mCommands)},
+       mBlocks{std::move(commandBuffer.mBlocks)},
+       mBlockSizes{std::move(commandBuffer.mBlockSizes)},
+       mBlockIndex{commandBuffer.mBlockIndex},
+       mBlockOffset{commandBuffer.mBlockOffset}
+    {
+        commandBuffer.mBlocks.clear();
+        commandBuffer.mBlockSizes.clear();
+        commandBuffer.mReset();
+    }
+
+    CommandBuffer::~CommandBuffer() {
+        Clear();
+    }
+
+    // Pending ADD payloads still own their components, so they are destroyed
+    // before this buffer takes over the other one's blocks.
+    CommandBuffer& CommandBuffer::operator=(CommandBuffer&& commandBuffer) noexcept
+    {
+        if (this == &commandBuffer) {
+            return *this;
+        }
+
+        Clear();
+
+        mCommands = std::move(commandBuffer.mCommands);
+        mBlocks = std::move(commandBuffer.mBlocks);
+        mBlockSizes = std::move(commandBuffer.mBlockSizes);
+        mBlockIndex = commandBuffer.mBlockIndex;
+        mBlockOffset = commandBuffer.mBlockOffset;
+
+        commandBuffer.mBlocks.clear();
+        commandBuffer.mBlockSizes.clear();
+        commandBuffer.mReset();
+
+        return *this;
+    }
+
+    void CommandBuffer::CreateEntity() {
+        mCommands.push_back({ Type::CREATE, 0, Entity{}, nullptr });
+    }
+
+    void CommandBuffer::DestroyEntity(Entity entity) {
+        mCommands.push_back({ Type::DESTROY, 0, entity, nullptr });
+    }
+
+    void CommandBuffer::Clear()
+    {
+        for (const Command& command : mCommands) {
+            if (command.mType == Type::ADD) {
+                Component::GetInfo(command.mComponent).mDestroy(command.mPayload);
+            }
+        }
+        mReset();
+    }
+
+    [[nodiscard]] bool CommandBuffer::IsEmpty() const {
+        return mCommands.empty();
+    }
+
+    [[nodiscard]] std::size_t CommandBuffer::GetSize() const {
+        return mCommands.size();
+    }
+
+    [[nodiscard]] void* CommandBuffer::mAllocate(std::size_t size, std::size_t alignment)
+    {
+        while (true)
+        {
+            if (mBlockIndex == mBlocks.size())
+            {
+                std::size_t blockSize = std::max(mBLOCK_SIZE, size + alignment);
+                mBlocks.push_back(std::make_unique<std::byte[]>(blockSize));
+                mBlockSizes.push_back(blockSize);
+                mBlockOffset = 0;
+            }
+
+            void* pointer = mBlocks[mBlockIndex].get() + mBlockOffset;
+            std::size_t space = mBlockSizes[mBlockIndex] - mBlockOffset;
+
+            if (std::align(alignment, size, pointer, space))
+            {
+                mBlockOffset = mBlockSizes[mBlockIndex] - space + size;
+                return pointer;
+            }
+
+            mBlockIndex++;
+            mBlockOffset = 0;
+        }
+    }
+
+    void CommandBuffer::mReset()
+    {
+        mCommands.clear();
+        mBlockIndex = 0;
+        mBlockOffset = 0;
+    }
+}
@@ -0,0 +1,40 @@
+#include "TIMGE/ECS/Component.hpp"
+
+#include <format>
+#include <mutex>
+
+namespace TIMGE::ECS
+{
+    ECSException::ECSException(std::string message)
+     : Exception(std::format("ECS: {}", message))
+    {}
+
+    std::array<ComponentInfo, MAX_COMPONENTS> Component::mInfos{};
+    uint32_t Component::mCount = 0;
+
+    [[nodiscard]] const ComponentInfo& Component::GetInfo(ComponentID id)
+    {
+        if (id >= MAX_COMPONENTS) {
+            throw ECSException(std::format("Component ID {} is out of range.", id));
+        }
+
+        return mInfos[id];
+    }
+
+    [[nodiscard]] uint32_t Component::GetCount() {
+        return mCount;
+    }
+
+    [[nodiscard]] ComponentID Component::mRegister(const ComponentInfo& info)
+    {
+        static std::mutex mutex;
+        std::lock_guard lock(mutex);
+
+        if (mCount >= MAX_COMPONENTS) {
+            throw ECSException(std::format("Cannot register more than {} component types.", MAX_COMPONENTS));
+        }
+
+        mInfos[mCount] = info;
+        return mCount++;
+    }
+}
@@ -0,0 +1,54 @@
+#include "TIMGE/ECS/Query.hpp"
+
+namespace TIMGE::ECS
+{
+    QueryBase::QueryBase(Signature signature, const std::vector<Archetype*>& archetypes)
+     : mSignature{signature},
+       mWorldArchetypes{archetypes},
+       mArchetypesSeen{0}
+    {}
+
+    [[nodiscard]] Signature QueryBase::GetSignature() const {
+        return mSignature;
+    }
+
+    [[nodiscard]] const std::vector<Archetype*>& QueryBase::GetArchetypes()
+    {
+        mRefresh();
+        return mArchetypes;
+    }
+
+    [[nodiscard]] std::size_t QueryBase::GetEntityCount()
+    {
+        mRefresh();
+
+        std::size_t count = 0;
+        for (Archetype* archetype : mArchetypes) {
+            count += archetype->GetEntityCount();
+        }
+        return count;
+    }
+
+    void QueryBase::mRefresh()
+    {
+        std::lock_guard lock(mMutex);
+        for (; mArchetypesSeen < mWorldArchetypes.size(); mArchetypesSeen++)
+        {
+            Archetype* archetype = mWorldArchetypes[mArchetypesSeen];
+            if ((archetype->GetSignature() & mSignature) == mSignature) {
+                mArchetypes.push_back(archetype);
+            }
+        }
+    }
+
+    [[nodiscard]] std::vector<std::pair<Archetype*, Chunk*>> QueryBase::mGatherChunks() const
+    {
+        std::vector<std::pair<Archetype*, Chunk*>> chunks;
+        for (Archetype* archetype : mArchetypes) {
+            for (std::size_t i = 0; i < archetype->GetChunkCount(); i++) {
+                chunks.emplace_back(archetype, &archetype->GetChunk(i));
+            }
+        }
+        return chunks;
+    }
+}
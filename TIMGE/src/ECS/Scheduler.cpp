@@ -0,0 +1,375 @@
+#include "TIMGE/ECS/Scheduler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <format>
+
+namespace TIMGE::ECS
+{
+    namespace
+    {
+        constexpr std::array<std::string_view, static_cast<std::size_t>(Stage::COUNT)> STAGE_NAMES = {
+            "PRE_UPDATE",
+            "UPDATE",
+            "POST_UPDATE"
+        };
+    }
+
+    SchedulerException::SchedulerException(std::string message)
+     : Exception(std::format("Scheduler: {}", message))
+    {}
+
+    Scheduler::Scheduler()
+    {
+        for (Graph& graph : mGraphs)
+        {
+            graph.mCriticalPathTime = 0.0;
+            graph.mDirty = false;
+            graph.mWorld = nullptr;
+            graph.mJobSystem = nullptr;
+            graph.mCounter = nullptr;
+            graph.mDeltaTime = 0.0;
+        }
+    }
+
+    void Scheduler::AddSystem(std::string name, Stage stage, Signature reads, Signature writes, System_T system)
+    {
+        if (stage >= Stage::COUNT) {
+            throw SchedulerException("Invalid stage.");
+        }
+        if (!system) {
+            throw SchedulerException(std::format("System \"{}\" has no function.", name));
+        }
+
+        for (const Graph& graph : mGraphs) {
+            for (const auto& node : graph.mNodes) {
+                if (node->mName == name) {
+                    throw SchedulerException(std::format("System \"{}\" already exists.", name));
+                }
+            }
+        }
+
+        Graph& graph = mGraphs[static_cast<std::size_t>(stage)];
+
+        auto node = std::make_unique<Node>();
+        node->mName = std::move(name);
+        node->mReads = reads & ~writes;
+        node->mWrites = writes;
+        node->mSystem = std::move(system);
+        node->mPending = 0;
+        node->mMilliseconds = 0.0;
+        node->mGraph = &graph;
+
+        graph.mNodes.push_back(std::move(node));
+        graph.mDirty = true;
+    }
+
+    void Scheduler::RemoveSystem(std::string_view name)
+    {
+        for (Graph& graph : mGraphs)
+        {
+            auto it = std::find_if(graph.mNodes.begin(), graph.mNodes.end(), [name](const auto& node) {
+                return node->mName == name;
+            });
+
+            if (it != graph.mNodes.end())
+            {
+                graph.mNodes.erase(it);
+                graph.mDirty = true;
+                return;
+            }
+        }
+
+        throw SchedulerException(std::format("System \"{}\" does not exist.", name));
+    }
+
+    void Scheduler::Clear()
+    {
+        for (Graph& graph : mGraphs)
+        {
+            graph.mNodes.clear();
+            graph.mDirty = true;
+        }
+    }
+
+    void Scheduler::Run(Stage stage, World& world, JobSystem& jobSystem, double deltaTime)
+    {
+        if (stage >= Stage::COUNT) {
+            throw SchedulerException("Invalid stage.");
+        }
+
+        Graph& graph = mGraphs[static_cast<std::size_t>(stage)];
+        if (graph.mNodes.empty()) {
+            return;
+        }
+        if (graph.mDirty) {
+            mBuild(graph);
+        }
+
+        for (auto& node : graph.mNodes) {
+            node->mPending.store(static_cast<uint32_t>(node->mPredecessors.size()), std::memory_order_relaxed);
+        }
+
+        JobSystem::Counter counter{0};
+        graph.mWorld = &world;
+        graph.mJobSystem = &jobSystem;
+        graph.mCounter = &counter;
+        graph.mDeltaTime = deltaTime;
+        graph.mError = nullptr;
+
+        for (uint32_t root : graph.mRoots) {
+            mSubmit(*graph.mNodes[root]);
+        }
+        jobSystem.Wait(counter);
+
+        graph.mCounter = nullptr;
+
+        if (graph.mError) {
+            for (auto& node : graph.mNodes) {
+                node->mCommands.Clear();
+            }
+            std::rethrow_exception(graph.mError);
+        }
+
+        for (auto& node : graph.mNodes) {
+            world.Execute(node->mCommands);
+        }
+
+        mComputeCriticalPath(graph);
+    }
+
+    [[nodiscard]] std::size_t Scheduler::GetSystemCount(Stage stage) const {
+        return mGraphs.at(static_cast<std::size_t>(stage)).mNodes.size();
+    }
+
+    [[nodiscard]] std::vector<std::string_view> Scheduler::GetCriticalPath(Stage stage)
+    {
+        Graph& graph = mGraphs.at(static_cast<std::size_t>(stage));
+        if (graph.mDirty) {
+            mBuild(graph);
+        }
+
+        std::vector<std::string_view> path;
+        for (uint32_t index : graph.mCriticalPath) {
+            path.push_back(graph.mNodes[index]->mName);
+        }
+
+        return path;
+    }
+
+    [[nodiscard]] double Scheduler::GetCriticalPathTime(Stage stage)
+    {
+        Graph& graph = mGraphs.at(static_cast<std::size_t>(stage));
+        if (graph.mDirty) {
+            mBuild(graph);
+        }
+
+        return graph.mCriticalPathTime;
+    }
+
+    [[nodiscard]] std::string Scheduler::Dump()
+    {
+        std::string dump;
+
+        for (std::size_t stage = 0; stage < mGraphs.size(); stage++)
+        {
+            Graph& graph = mGraphs[stage];
+            if (graph.mDirty) {
+                mBuild(graph);
+            }
+
+            dump += std::format("{} ({} systems)\n", STAGE_NAMES[stage], graph.mNodes.size());
+
+            for (std::size_t i = 0; i < graph.mNodes.size(); i++)
+            {
+                const Node& node = *graph.mNodes[i];
+
+                std::string after;
+                for (uint32_t predecessor : node.mPredecessors) {
+                    after += std::format("{}{}", after.empty() ? "" : ", ", graph.mNodes[predecessor]->mName);
+                }
+
+                dump += std::format("  {:<24} R {:<16} W {:<16} after [{}] {:.3f} ms\n",
+                    node.mName, mFormatSignature(node.mReads), mFormatSignature(node.mWrites), after, node.mMilliseconds);
+            }
+
+            if (!graph.mCriticalPath.empty())
+            {
+                std::string path;
+                for (uint32_t index : graph.mCriticalPath) {
+                    path += std::format("{}{}", path.empty() ? "" : " -> ", graph.mNodes[index]->mName);
+                }
+                dump += std::format("  critical path {:.3f} ms: {}\n", graph.mCriticalPathTime, path);
+            }
+        }
+
+        return dump;
+    }
+
+    [[nodiscard]] std::string Scheduler::DumpGraphviz()
+    {
+        std::string dump = "digraph Schedule {\n  rankdir=LR;\n  node [shape=box];\n";
+
+        for (std::size_t stage = 0; stage < mGraphs.size(); stage++)
+        {
+            Graph& graph = mGraphs[stage];
+            if (graph.mDirty) {
+                mBuild(graph);
+            }
+
+            dump += std::format("  subgraph cluster_{} {{\n    label=\"{}\";\n", stage, STAGE_NAMES[stage]);
+
+            for (std::size_t i = 0; i < graph.mNodes.size(); i++)
+            {
+                const Node& node = *graph.mNodes[i];
+                bool critical = std::find(graph.mCriticalPath.begin(), graph.mCriticalPath.end(), i) != graph.mCriticalPath.end();
+
+                dump += std::format("    s{}_{} [label=\"{}\\n{:.3f} ms\"{}];\n",
+                    stage, i, node.mName, node.mMilliseconds, critical ? ", color=red" : "");
+
+                for (uint32_t successor : node.mSuccessors) {
+                    dump += std::format("    s{}_{} -> s{}_{};\n", stage, i, stage, successor);
+                }
+            }
+
+            dump += "  }\n";
+        }
+
+        return dump + "}\n";
+    }
+
+    void Scheduler::mBuild(Graph& graph)
+    {
+        graph.mRoots.clear();
+
+        for (auto& node : graph.mNodes)
+        {
+            node->mPredecessors.clear();
+            node->mSuccessors.clear();
+        }
+
+        for (uint32_t j = 0; j < graph.mNodes.size(); j++)
+        {
+            Node& later = *graph.mNodes[j];
+            Signature covered = 0;
+
+            for (uint32_t i = j; i-- > 0;)
+            {
+                Node& earlier = *graph.mNodes[i];
+                if (!mConflicts(earlier, later)) {
+                    continue;
+                }
+
+                Signature touched = earlier.mReads | earlier.mWrites;
+                if (touched != 0 && (touched & ~covered) == 0) {
+                    continue;
+                }
+                covered |= earlier.mWrites;
+
+                later.mPredecessors.push_back(i);
+                earlier.mSuccessors.push_back(j);
+            }
+
+            std::reverse(later.mPredecessors.begin(), later.mPredecessors.end());
+            if (later.mPredecessors.empty()) {
+                graph.mRoots.push_back(j);
+            }
+        }
+
+        graph.mDirty = false;
+        mComputeCriticalPath(graph);
+    }
+
+    void Scheduler::mComputeCriticalPath(Graph& graph)
+    {
+        std::size_t count = graph.mNodes.size();
+        std::vector<double> finish(count, 0.0);
+        std::vector<uint32_t> length(count, 0);
+        std::vector<uint32_t> previous(count, UINT32_MAX);
+
+        uint32_t last = UINT32_MAX;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const Node& node = *graph.mNodes[i];
+
+            for (uint32_t predecessor : node.mPredecessors) {
+                if (finish[predecessor] > finish[i] || (finish[predecessor] == finish[i] && length[predecessor] >= length[i])) {
+                    finish[i] = finish[predecessor];
+                    length[i] = length[predecessor];
+                    previous[i] = predecessor;
+                }
+            }
+            finish[i] += node.mMilliseconds;
+            length[i]++;
+
+            if (last == UINT32_MAX || finish[i] > finish[last] || (finish[i] == finish[last] && length[i] > length[last])) {
+                last = i;
+            }
+        }
+
+        graph.mCriticalPath.clear();
+        graph.mCriticalPathTime = last == UINT32_MAX ? 0.0 : finish[last];
+
+        for (uint32_t i = last; i != UINT32_MAX; i = previous[i]) {
+            graph.mCriticalPath.push_back(i);
+        }
+        std::reverse(graph.mCriticalPath.begin(), graph.mCriticalPath.end());
+    }
+
+    void Scheduler::mSubmit(Node& node) {
+        node.mGraph->mJobSystem->Submit({ &Scheduler::mExecute, &node }, *node.mGraph->mCounter);
+    }
+
+    void Scheduler::mExecute(void* data, uint32_t workerIndex)
+    {
+        Node& node = *static_cast<Node*>(data);
+        Graph& graph = *node.mGraph;
+
+        auto start = std::chrono::steady_clock::now();
+        try
+        {
+            SystemContext context{ *graph.mWorld, node.mCommands, *graph.mJobSystem, graph.mDeltaTime, workerIndex };
+            node.mSystem(context);
+        }
+        catch (...)
+        {
+            std::lock_guard lock(graph.mErrorMutex);
+            if (!graph.mError) {
+                graph.mError = std::current_exception();
+            }
+        }
+        node.mMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        for (uint32_t successor : node.mSuccessors)
+        {
+            Node& next = *graph.mNodes[successor];
+            if (next.mPending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                mSubmit(next);
+            }
+        }
+    }
+
+    [[nodiscard]] bool Scheduler::mConflicts(const Node& first, const Node& second)
+    {
+        return (first.mWrites & (second.mReads | second.mWrites)) != 0
+            || (second.mWrites & first.mReads) != 0;
+    }
+
+    [[nodiscard]] std::string Scheduler::mFormatSignature(Signature signature)
+    {
+        if (signature == EXCLUSIVE) {
+            return "{*}";
+        }
+
+        std::string result = "{";
+        while (signature != 0)
+        {
+            int id = std::countr_zero(signature);
+            result += std::format("{}{}", result.size() > 1 ? "," : "", id);
+            signature &= signature - 1;
+        }
+
+        return result + "}";
+    }
+}
@@ -0,0 +1,201 @@
+#include "TIMGE/ECS/World.hpp"
+
+#include <atomic>
+
+namespace TIMGE::ECS
+{
+    World::World() {
+        (void)mGetArchetype(0);
+    }
+
+    World::~World()
+    {
+        mQueries.clear();
+        mArchetypes.clear();
+        mArchetypeMap.clear();
+    }
+
+    [[maybe_unused]] Entity World::CreateEntity() {
+        return mCreate(mGetArchetype(0));
+    }
+
+    void World::DestroyEntity(Entity entity)
+    {
+        mRemoveRow(mGetRecord(entity));
+        mEntities.Remove(entity);
+    }
+
+    void World::Execute(CommandBuffer& commandBuffer)
+    {
+        Entity created{};
+
+        for (const CommandBuffer::Command& command : commandBuffer.mCommands)
+        {
+            Entity target = command.mEntity.IsNull() ? created : command.mEntity;
+            const ComponentInfo* info = command.mPayload ? &Component::GetInfo(command.mComponent) : nullptr;
+
+            switch (command.mType)
+            {
+                case CommandBuffer::Type::CREATE:
+                    created = CreateEntity();
+                    break;
+                case CommandBuffer::Type::DESTROY:
+                    if (IsAlive(target)) { DestroyEntity(target); }
+                    break;
+                case CommandBuffer::Type::ADD:
+                    if (IsAlive(target)) { info->mMoveConstruct(mAddComponent(target, command.mComponent), command.mPayload); }
+                    info->mDestroy(command.mPayload);
+                    break;
+                case CommandBuffer::Type::REMOVE:
+                    if (IsAlive(target) && mGetRecord(target).mArchetype->HasComponent(command.mComponent)) { mRemoveComponent(target, command.mComponent); }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        commandBuffer.mReset();
+    }
+
+    void World::Clear()
+    {
+        while (!mEntities.IsEmpty()) {
+            DestroyEntity(mEntities.GetHandle(mEntities.GetSize() - 1));
+        }
+    }
+
+    [[nodiscard]] bool World::IsAlive(Entity entity) const {
+        return mEntities.Contains(entity);
+    }
+
+    [[nodiscard]] std::size_t World::GetEntityCount() const {
+        return mEntities.GetSize();
+    }
+
+    [[nodiscard]] const std::vector<Archetype*>& World::GetArchetypes() const {
+        return mArchetypes;
+    }
+
+    [[nodiscard]] Archetype& World::mGetArchetype(Signature signature)
+    {
+        if (auto it = mArchetypeMap.find(signature); it != mArchetypeMap.end()) {
+            return *it->second;
+        }
+
+        auto archetype = std::make_unique<Archetype>(signature);
+        mArchetypes.push_back(archetype.get());
+
+        return *mArchetypeMap.emplace(signature, std::move(archetype)).first->second;
+    }
+
+    [[nodiscard]] Archetype& World::mGetAddTarget(Archetype& archetype, ComponentID id)
+    {
+        if (!archetype.mAddEdges[id])
+        {
+            Archetype& target = mGetArchetype(archetype.mSignature | (Signature{1} << id));
+            archetype.mAddEdges[id] = &target;
+            target.mRemoveEdges[id] = &archetype;
+        }
+
+        return *archetype.mAddEdges[id];
+    }
+
+    [[nodiscard]] Archetype& World::mGetRemoveTarget(Archetype& archetype, ComponentID id)
+    {
+        if (!archetype.mRemoveEdges[id])
+        {
+            Archetype& target = mGetArchetype(archetype.mSignature & ~(Signature{1} << id));
+            archetype.mRemoveEdges[id] = &target;
+            target.mAddEdges[id] = &archetype;
+        }
+
+        return *archetype.mRemoveEdges[id];
+    }
+
+    [[nodiscard]] EntityRecord& World::mGetRecord(Entity entity)
+    {
+        EntityRecord* record = mEntities.TryGet(entity);
+        if (!record) {
+            throw ECSException("Entity is not alive.");
+        }
+
+        return *record;
+    }
+
+    [[nodiscard]] Entity World::mCreate(Archetype& archetype)
+    {
+        Entity entity = mEntities.Add(EntityRecord{ &archetype, 0, 0 });
+        Archetype::Location location = archetype.mAllocate(entity);
+
+        EntityRecord& record = mEntities.Get(entity);
+        record.mChunk = location.mChunk;
+        record.mRow = location.mRow;
+
+        return entity;
+    }
+
+    [[nodiscard]] void* World::mAddComponent(Entity entity, ComponentID id)
+    {
+        EntityRecord& record = mGetRecord(entity);
+        Archetype& archetype = *record.mArchetype;
+
+        if (archetype.HasComponent(id))
+        {
+            void* component = archetype.mGetComponent({ record.mChunk, record.mRow }, id);
+            Component::GetInfo(id).mDestroy(component);
+            return component;
+        }
+
+        Archetype& target = mGetAddTarget(archetype, id);
+        mMove(entity, record, target);
+
+        return target.mGetComponent({ record.mChunk, record.mRow }, id);
+    }
+
+    void World::mRemoveComponent(Entity entity, ComponentID id)
+    {
+        EntityRecord& record = mGetRecord(entity);
+        if (!record.mArchetype->HasComponent(id)) {
+            throw ECSException("Entity does not have the component being removed.");
+        }
+
+        mMove(entity, record, mGetRemoveTarget(*record.mArchetype, id));
+    }
+
+    void World::mMove(Entity entity, EntityRecord& record, Archetype& target)
+    {
+        Archetype& source = *record.mArchetype;
+        Archetype::Location from{ record.mChunk, record.mRow };
+        Archetype::Location to = target.mAllocate(entity);
+
+        for (ComponentID id : source.mComponents) {
+            if (target.HasComponent(id)) {
+                Component::GetInfo(id).mMoveConstruct(target.mGetComponent(to, id), source.mGetComponent(from, id));
+            }
+        }
+
+        mRemoveRow(record);
+
+        record.mArchetype = &target;
+        record.mChunk = to.mChunk;
+        record.mRow = to.mRow;
+    }
+
+    void World::mRemoveRow(EntityRecord& record)
+    {
+        Entity moved = record.mArchetype->mRemove({ record.mChunk, record.mRow });
+
+        if (!moved.IsNull())
+        {
+            EntityRecord& movedRecord = mEntities.Get(moved);
+            movedRecord.mChunk = record.mChunk;
+            movedRecord.mRow = record.mRow;
+        }
+    }
+
+    [[nodiscard]] std::size_t World::mNextQueryIndex()
+    {
+        static std::atomic<std::size_t> next{0};
+        return next++;
+    }
+}
@@ -0,0 +1,204 @@
+#include "TIMGE/EventBus.hpp"
+
+#include <atomic>
+#include <format>
+
+namespace TIMGE
+{
+    EventBusException::EventBusException(std::string message)
+     : Exception(std::format("EventBus: {}", message))
+    {}
+
+    [[nodiscard]] bool EventBus::Subscription::IsNull() const {
+        return mIndex == mNULL_INDEX;
+    }
+
+    EventBus::EventBus()
+     : mChannels{},
+       mPages{},
+       mFree{},
+       mRetired{},
+       mDispatchDepth{}
+    {
+        for (Channel& channel : mChannels)
+        {
+            channel.mHeads.fill(mNULL_INDEX);
+            channel.mTails.fill(mNULL_INDEX);
+            channel.mCount = 0;
+        }
+    }
+
+    void EventBus::Unsubscribe(Subscription& subscription)
+    {
+        if (!IsSubscribed(subscription)) {
+            throw EventBusException("Cannot unsubscribe an inactive subscription.");
+        }
+
+        Node& node = mGetNode(subscription.mIndex);
+        Channel& channel = mChannels[node.mType];
+        std::size_t priority = static_cast<std::size_t>(node.mPriority);
+
+        if (node.mPrevious != mNULL_INDEX) {
+            mGetNode(node.mPrevious).mNext = node.mNext;
+        } else {
+            channel.mHeads[priority] = node.mNext;
+        }
+
+        if (node.mNext != mNULL_INDEX) {
+            mGetNode(node.mNext).mPrevious = node.mPrevious;
+        } else {
+            channel.mTails[priority] = node.mPrevious;
+        }
+
+        node.mActive = false;
+        node.mGeneration++;
+        channel.mCount--;
+
+        // A dispatch in progress may still be standing on this node, so keep its
+        // next link and storage alive until the outermost Publish returns.
+        if (mDispatchDepth != 0) {
+            mRetired.push_back(subscription.mIndex);
+        }
+        else
+        {
+            node.mListener.Reset();
+            mFree.push_back(subscription.mIndex);
+        }
+
+        subscription = {};
+    }
+
+    void EventBus::Clear()
+    {
+        for (uint32_t type = 0; type < MAX_EVENT_TYPES; type++)
+        {
+            for (std::size_t priority = 0; priority < mPRIORITIES; priority++)
+            {
+                while (mChannels[type].mHeads[priority] != mNULL_INDEX)
+                {
+                    Subscription subscription{ type, mChannels[type].mHeads[priority], mGetNode(mChannels[type].mHeads[priority]).mGeneration };
+                    Unsubscribe(subscription);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] bool EventBus::IsSubscribed(const Subscription& subscription) const
+    {
+        if (subscription.IsNull() || subscription.mIndex >= mPages.size() * mPAGE_SIZE) {
+            return false;
+        }
+
+        const Node& node = mGetNode(subscription.mIndex);
+        return node.mActive && node.mGeneration == subscription.mGeneration && node.mType == subscription.mType;
+    }
+
+    [[nodiscard]] uint32_t EventBus::mRegisterType()
+    {
+        static std::atomic<uint32_t> count = 0;
+
+        uint32_t type = count.fetch_add(1);
+        if (type >= MAX_EVENT_TYPES) {
+            throw EventBusException(std::format("Cannot register more than {} event types.", MAX_EVENT_TYPES));
+        }
+
+        return type;
+    }
+
+    [[nodiscard]] EventBus::Subscription EventBus::mSubscribe(uint32_t type, Listener_T&& listener, Priority priority)
+    {
+        if (priority >= Priority::COUNT) {
+            throw EventBusException("Invalid listener priority.");
+        }
+
+        if (mFree.empty())
+        {
+            uint32_t first = static_cast<uint32_t>(mPages.size() * mPAGE_SIZE);
+            mPages.push_back(std::make_unique<Page_T>());
+
+            // Both lists can hold every node, so Unsubscribe and the end of a
+            // dispatch never have to grow them.
+            mFree.reserve(mPages.size() * mPAGE_SIZE);
+            mRetired.reserve(mPages.size() * mPAGE_SIZE);
+
+            for (uint32_t index = first + mPAGE_SIZE; index-- > first;) {
+                mFree.push_back(index);
+            }
+        }
+
+        uint32_t index = mFree.back();
+        mFree.pop_back();
+
+        Channel& channel = mChannels[type];
+        std::size_t slot = static_cast<std::size_t>(priority);
+
+        Node& node = mGetNode(index);
+        node.mListener = std::move(listener);
+        node.mPrevious = channel.mTails[slot];
+        node.mNext = mNULL_INDEX;
+        node.mType = type;
+        node.mPriority = priority;
+        node.mActive = true;
+
+        if (channel.mTails[slot] != mNULL_INDEX) {
+            mGetNode(channel.mTails[slot]).mNext = index;
+        } else {
+            channel.mHeads[slot] = index;
+        }
+        channel.mTails[slot] = index;
+        channel.mCount++;
+
+        return { type, index, node.mGeneration };
+    }
+
+    void EventBus::mPublish(uint32_t type, const void* event)
+    {
+        const Channel& channel = mChannels[type];
+        if (channel.mCount == 0) {
+            return;
+        }
+
+        mDispatchDepth++;
+        try
+        {
+            for (std::size_t priority = 0; priority < mPRIORITIES; priority++)
+            {
+                for (uint32_t index = channel.mHeads[priority]; index != mNULL_INDEX; index = mGetNode(index).mNext)
+                {
+                    Node& node = mGetNode(index);
+                    if (node.mActive) {
+                        node.mListener(event);
+                    }
+                }
+            }
+        }
+        catch (...)
+        {
+            mEndDispatch();
+            throw;
+        }
+        mEndDispatch();
+    }
+
+    void EventBus::mEndDispatch()
+    {
+        if (--mDispatchDepth != 0) {
+            return;
+        }
+
+        for (uint32_t index : mRetired)
+        {
+            mGetNode(index).mListener.Reset();
+            mFree.push_back(index);
+        }
+        mRetired.clear();
+    }
+
+    [[nodiscard]] EventBus::Node& EventBus::mGetNode(uint32_t index) {
+        return (*mPages[index / mPAGE_SIZE])[index % mPAGE_SIZE];
+    }
+
+    [[nodiscard]] const EventBus::Node& EventBus::mGetNode(uint32_t index) const {
+        return (*mPages[index / mPAGE_SIZE])[index % mPAGE_SIZE];
+    }
+}
@@ -0,0 +1,188 @@
+#include "TIMGE/Gamepad.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+namespace TIMGE
+{
+    GamepadException::GamepadException(std::string message)
+     : Exception(std::format("Gamepad: {}", message))
+    {}
+
+    Gamepad::GetGamepadState_t Gamepad::GetGamepadState = glfwGetGamepadState;
+    Gamepad::GetGamepadName_t Gamepad::GetGamepadName = glfwGetGamepadName;
+
+    Gamepad::Gamepad()
+     : mCurrent{},
+       mPrevious{},
+       mNames{},
+       mDeadzone{0.15f},
+       mTriggerDeadzone{0.05f}
+    {}
+
+    void Gamepad::Poll()
+    {
+        mPrevious = mCurrent;
+
+        for (uint32_t pad = 0; pad < MAX_GAMEPADS; pad++)
+        {
+            Snapshot& snapshot = mCurrent[pad];
+
+            GLFWgamepadstate state;
+            if (GetGamepadState(static_cast<int>(pad), &state) != GLFW_TRUE)
+            {
+                snapshot = {};
+                mNames[pad].clear();
+                continue;
+            }
+
+            snapshot.mConnected = true;
+            snapshot.mButtons = 0;
+            for (uint32_t button = 0; button < BUTTON_COUNT; button++) {
+                if (state.buttons[button] == GLFW_PRESS) {
+                    snapshot.mButtons |= static_cast<uint16_t>(1u << button);
+                }
+            }
+
+            std::copy(std::begin(state.axes), std::end(state.axes), snapshot.mAxes.begin());
+            mFilterStick(snapshot.mAxes[GLFW_GAMEPAD_AXIS_LEFT_X], snapshot.mAxes[GLFW_GAMEPAD_AXIS_LEFT_Y]);
+            mFilterStick(snapshot.mAxes[GLFW_GAMEPAD_AXIS_RIGHT_X], snapshot.mAxes[GLFW_GAMEPAD_AXIS_RIGHT_Y]);
+            snapshot.mAxes[GLFW_GAMEPAD_AXIS_LEFT_TRIGGER] = mFilterTrigger(snapshot.mAxes[GLFW_GAMEPAD_AXIS_LEFT_TRIGGER]);
+            snapshot.mAxes[GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER] = mFilterTrigger(snapshot.mAxes[GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER]);
+
+            if (!mPrevious[pad].mConnected)
+            {
+                const char* name = GetGamepadName(static_cast<int>(pad));
+                mNames[pad] = name != nullptr ? name : "";
+            }
+        }
+    }
+
+    void Gamepad::SetDeadzone(float deadzone)
+    {
+        if (!(deadzone >= 0.0f && deadzone < 1.0f)) {
+            throw GamepadException("Deadzone must be in [0, 1)!");
+        }
+        mDeadzone = deadzone;
+    }
+
+    void Gamepad::SetTriggerDeadzone(float deadzone)
+    {
+        if (!(deadzone >= 0.0f && deadzone < 1.0f)) {
+            throw GamepadException("Trigger deadzone must be in [0, 1)!");
+        }
+        mTriggerDeadzone = deadzone;
+    }
+
+    [[nodiscard]] bool Gamepad::IsConnected(uint32_t pad) const
+    {
+        mCheckPad(pad);
+        return mCurrent[pad].mConnected;
+    }
+
+    [[nodiscard]] bool Gamepad::Pressed(uint32_t pad, GamepadButton button) const
+    {
+        mCheckPad(pad);
+        return (mCurrent[pad].mButtons >> static_cast<int>(button)) & 1;
+    }
+
+    [[nodiscard]] bool Gamepad::Released(uint32_t pad, GamepadButton button) const {
+        return !Pressed(pad, button);
+    }
+
+    [[nodiscard]] bool Gamepad::JustPressed(uint32_t pad, GamepadButton button) const
+    {
+        mCheckPad(pad);
+        uint16_t pressed = mCurrent[pad].mButtons & ~mPrevious[pad].mButtons;
+        return (pressed >> static_cast<int>(button)) & 1;
+    }
+
+    [[nodiscard]] bool Gamepad::JustReleased(uint32_t pad, GamepadButton button) const
+    {
+        mCheckPad(pad);
+        uint16_t released = mPrevious[pad].mButtons & ~mCurrent[pad].mButtons;
+        return (released >> static_cast<int>(button)) & 1;
+    }
+
+    [[nodiscard]] float Gamepad::GetAxis(uint32_t pad, GamepadAxis axis) const
+    {
+        mCheckPad(pad);
+        return mCurrent[pad].mAxes[static_cast<std::size_t>(axis)];
+    }
+
+    [[nodiscard]] std::string_view Gamepad::GetName(uint32_t pad) const
+    {
+        mCheckPad(pad);
+        return mNames[pad];
+    }
+
+    [[nodiscard]] const Gamepad::Snapshot& Gamepad::GetSnapshot(uint32_t pad) const
+    {
+        mCheckPad(pad);
+        return mCurrent[pad];
+    }
+
+    [[nodiscard]] const Gamepad::Snapshot& Gamepad::GetPreviousSnapshot(uint32_t pad) const
+    {
+        mCheckPad(pad);
+        return mPrevious[pad];
+    }
+
+    [[nodiscard]] uint32_t Gamepad::GetPrimary() const
+    {
+        for (uint32_t pad = 0; pad < MAX_GAMEPADS; pad++) {
+            if (mCurrent[pad].mConnected) {
+                return pad;
+            }
+        }
+        return NONE;
+    }
+
+    [[nodiscard]] std::size_t Gamepad::GetConnectedCount() const
+    {
+        return std::count_if(mCurrent.begin(), mCurrent.end(), [](const Snapshot& snapshot) {
+            return snapshot.mConnected;
+        });
+    }
+
+    [[nodiscard]] float Gamepad::GetDeadzone() const {
+        return mDeadzone;
+    }
+
+    [[nodiscard]] float Gamepad::GetTriggerDeadzone() const {
+        return mTriggerDeadzone;
+    }
+
+    void Gamepad::mCheckPad(uint32_t pad) const
+    {
+        if (pad >= MAX_GAMEPADS) {
+            throw GamepadException(std::format("Invalid gamepad {}!", pad));
+        }
+    }
+
+    void Gamepad::mFilterStick(float& x, float& y) const
+    {
+        float magnitude = std::sqrt(x * x + y * y);
+        if (magnitude <= mDeadzone)
+        {
+            x = 0.0f;
+            y = 0.0f;
+            return;
+        }
+
+        float scale = std::min(1.0f, (magnitude - mDeadzone) / (1.0f - mDeadzone)) / magnitude;
+        x *= scale;
+        y *= scale;
+    }
+
+    [[nodiscard]] float Gamepad::mFilterTrigger(float value) const
+    {
+        float normalized = std::clamp((value + 1.0f) * 0.5f, 0.0f, 1.0f);
+        if (normalized <= mTriggerDeadzone) {
+            return 0.0f;
+        }
+
+        return (normalized - mTriggerDeadzone) / (1.0f - mTriggerDeadzone);
+    }
+}
@@ -0,0 +1,352 @@
+#include "TIMGE/HotReloader.hpp"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <format>
+#include <iterator>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace TIMGE
+{
+    namespace
+    {
+        // Only used where inotify is unavailable and write times are polled.
+        constexpr std::chrono::milliseconds POLL_INTERVAL{250};
+    }
+
+    HotReloaderException::HotReloaderException(std::string message)
+     : Exception(std::format("HotReloader: {}", message))
+    {}
+
+    HotReloader::HotReloader(std::function<void()> onPending)
+     : mEntries{},
+       mResults{},
+       mFailures{},
+       mStatistics{},
+       mNextId{},
+       mOnPending{std::move(onPending)},
+       mThread{},
+       mRunning{false},
+       mMutex{},
+       mCondition{},
+       mNotify{-1},
+       mWake{-1, -1},
+       mDirectories{}
+    {}
+
+    HotReloader::~HotReloader()
+    {
+        if (mThread.joinable())
+        {
+            {
+                std::lock_guard lock(mMutex);
+                mRunning = false;
+            }
+            mCondition.notify_all();
+
+#ifdef __linux__
+            char byte = 0;
+            [[maybe_unused]] ssize_t written = write(mWake[1], &byte, 1);
+#endif // __linux__
+
+            mThread.join();
+        }
+
+#ifdef __linux__
+        for (int descriptor : { mNotify, mWake[0], mWake[1] }) {
+            if (descriptor >= 0) {
+                close(descriptor);
+            }
+        }
+#endif // __linux__
+    }
+
+    void HotReloader::Unwatch(uint32_t watch)
+    {
+        std::lock_guard lock(mMutex);
+
+        auto entry = std::find_if(mEntries.begin(), mEntries.end(), [watch](const Entry& candidate) { return candidate.mId == watch; });
+        if (entry == mEntries.end()) {
+            throw HotReloaderException(std::format("Watch {} doesn't exist!", watch));
+        }
+        mEntries.erase(entry);
+    }
+
+    [[maybe_unused]] std::size_t HotReloader::Apply()
+    {
+        std::vector<Result> results;
+        {
+            std::lock_guard lock(mMutex);
+            results.swap(mResults);
+        }
+
+        std::size_t applied = 0;
+        for (Result& result : results)
+        {
+            {
+                std::lock_guard lock(mMutex);
+                if (std::none_of(mEntries.begin(), mEntries.end(), [&result](const Entry& entry) { return entry.mId == result.mId; })) {
+                    continue;
+                }
+            }
+
+            // A throwing applier has not replaced anything yet, so the old asset
+            // stays live exactly as it does when the load itself fails.
+            if (result.mError.empty())
+            {
+                try {
+                    result.mApply();
+                } catch (const Exception& exception) {
+                    result.mError = exception.What();
+                } catch (const std::exception& exception) {
+                    result.mError = exception.what();
+                }
+            }
+
+            std::erase_if(mFailures, [&result](const Failure& failure) { return failure.mPath == result.mPath; });
+
+            if (!result.mError.empty())
+            {
+                mFailures.push_back({ result.mPath, std::move(result.mError) });
+                mStatistics.mFailures++;
+                continue;
+            }
+
+            mStatistics.mReloads++;
+            applied++;
+        }
+
+        return applied;
+    }
+
+    [[nodiscard]] std::size_t HotReloader::GetWatchCount() const
+    {
+        std::lock_guard lock(mMutex);
+        return mEntries.size();
+    }
+
+    [[nodiscard]] const std::vector<HotReloader::Failure>& HotReloader::GetFailures() const {
+        return mFailures;
+    }
+
+    [[nodiscard]] const HotReloader::Statistics& HotReloader::GetStatistics() const {
+        return mStatistics;
+    }
+
+    [[maybe_unused]] uint32_t HotReloader::mAdd(const std::filesystem::path& path, Loader_T load)
+    {
+        std::filesystem::path file = std::filesystem::absolute(path).lexically_normal();
+        std::filesystem::path directory = file.parent_path();
+
+        if (!std::filesystem::is_directory(directory)) {
+            throw HotReloaderException(std::format("Directory \"{}\" doesn't exist!", directory.string()));
+        }
+
+        mStart();
+
+#ifdef __linux__
+        bool watched;
+        {
+            std::lock_guard lock(mMutex);
+            watched = std::any_of(mDirectories.begin(), mDirectories.end(), [&directory](const auto& watch) { return watch.second == directory; });
+        }
+
+        // Directories are watched rather than files because editors commonly
+        // save by writing a new file and renaming it over the old one.
+        if (!watched)
+        {
+            int descriptor = inotify_add_watch(mNotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+            if (descriptor < 0) {
+                throw HotReloaderException(std::format("Failed to watch \"{}\"!", directory.string()));
+            }
+
+            std::lock_guard lock(mMutex);
+            mDirectories.emplace(descriptor, directory);
+        }
+#endif // __linux__
+
+        std::error_code error;
+        std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(file, error);
+
+        std::lock_guard lock(mMutex);
+        mEntries.push_back({ mNextId, std::move(file), std::move(load), writeTime, {}, false });
+
+        return mNextId++;
+    }
+
+    void HotReloader::mStart()
+    {
+        if (mThread.joinable()) {
+            return;
+        }
+
+#ifdef __linux__
+        mNotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (mNotify < 0) {
+            throw HotReloaderException("Failed to initialize inotify!");
+        }
+        if (pipe2(mWake, O_CLOEXEC) != 0) {
+            throw HotReloaderException("Failed to create the wake pipe!");
+        }
+#endif // __linux__
+
+        mRunning = true;
+        mThread = std::thread(&HotReloader::mRun, this);
+    }
+
+    void HotReloader::mRun()
+    {
+#ifdef __linux__
+        std::array<pollfd, 2> descriptors{ pollfd{ mNotify, POLLIN, 0 }, pollfd{ mWake[0], POLLIN, 0 } };
+        alignas(inotify_event) std::array<char, 4096> buffer;
+
+        while (mRunning)
+        {
+            int timeout = mHasDirty() ? static_cast<int>(DEBOUNCE.count()) : -1;
+            if (poll(descriptors.data(), descriptors.size(), timeout) < 0 && errno != EINTR) {
+                break;
+            }
+            if (descriptors[1].revents & POLLIN) {
+                break;
+            }
+
+            if (descriptors[0].revents & POLLIN)
+            {
+                ssize_t size;
+                while ((size = read(mNotify, buffer.data(), buffer.size())) > 0) {
+                    for (ssize_t offset = 0; offset < size;)
+                    {
+                        const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+                        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                        if (event->len == 0) {
+                            continue;
+                        }
+
+                        std::filesystem::path file;
+                        {
+                            std::lock_guard lock(mMutex);
+                            auto directory = mDirectories.find(event->wd);
+                            if (directory == mDirectories.end()) {
+                                continue;
+                            }
+                            file = directory->second / event->name;
+                        }
+                        mMarkDirty(file);
+                    }
+                }
+            }
+
+            mLoadDirty();
+        }
+#else
+        std::unique_lock lock(mMutex);
+        while (mRunning)
+        {
+            mCondition.wait_for(lock, POLL_INTERVAL, [this]{ return !mRunning; });
+            if (!mRunning) {
+                break;
+            }
+
+            lock.unlock();
+            mPollWriteTimes();
+            mLoadDirty();
+            lock.lock();
+        }
+#endif // __linux__
+    }
+
+    void HotReloader::mMarkDirty(const std::filesystem::path& path)
+    {
+        std::lock_guard lock(mMutex);
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (Entry& entry : mEntries)
+        {
+            if (entry.mPath == path)
+            {
+                entry.mDirty = true;
+                entry.mChanged = now;
+            }
+        }
+    }
+
+    void HotReloader::mPollWriteTimes()
+    {
+        std::lock_guard lock(mMutex);
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (Entry& entry : mEntries)
+        {
+            std::error_code error;
+            std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(entry.mPath, error);
+            if (error || writeTime == entry.mWriteTime) {
+                continue;
+            }
+
+            entry.mWriteTime = writeTime;
+            entry.mDirty = true;
+            entry.mChanged = now;
+        }
+    }
+
+    void HotReloader::mLoadDirty()
+    {
+        std::vector<Entry> due;
+        {
+            std::lock_guard lock(mMutex);
+
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            for (Entry& entry : mEntries)
+            {
+                if (entry.mDirty && now - entry.mChanged >= DEBOUNCE)
+                {
+                    entry.mDirty = false;
+                    due.push_back(entry);
+                }
+            }
+        }
+
+        if (due.empty()) {
+            return;
+        }
+
+        std::vector<Result> results;
+        results.reserve(due.size());
+        for (const Entry& entry : due)
+        {
+            results.push_back({ entry.mId, entry.mPath, nullptr, {} });
+            Result& result = results.back();
+            try {
+                result.mApply = entry.mLoad(entry.mPath);
+            } catch (const Exception& exception) {
+                result.mError = exception.What();
+            } catch (const std::exception& exception) {
+                result.mError = exception.what();
+            }
+        }
+
+        {
+            std::lock_guard lock(mMutex);
+            std::move(results.begin(), results.end(), std::back_inserter(mResults));
+        }
+
+        if (mOnPending) {
+            mOnPending();
+        }
+    }
+
+    [[nodiscard]] bool HotReloader::mHasDirty()
+    {
+        std::lock_guard lock(mMutex);
+        return std::any_of(mEntries.begin(), mEntries.end(), [](const Entry& entry) { return entry.mDirty; });
+    }
+}
@@ -0,0 +1,780 @@
+#include "TIMGE/Input/ActionMap.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <format>
+
+namespace TIMGE::Input
+{
+    namespace
+    {
+        struct Name
+        {
+            std::string_view mName;
+            int32_t mCode;
+        };
+
+        constexpr std::array<Name, 120> KEY_NAMES = {{
+            { "SPACE", GLFW_KEY_SPACE },
+            { "APOSTROPHE", GLFW_KEY_APOSTROPHE },
+            { "COMMA", GLFW_KEY_COMMA },
+            { "MINUS", GLFW_KEY_MINUS },
+            { "PERIOD", GLFW_KEY_PERIOD },
+            { "SLASH", GLFW_KEY_SLASH },
+            { "ZERO", GLFW_KEY_0 },
+            { "ONE", GLFW_KEY_1 },
+            { "TWO", GLFW_KEY_2 },
+            { "THREE", GLFW_KEY_3 },
+            { "FOUR", GLFW_KEY_4 },
+            { "FIVE", GLFW_KEY_5 },
+            { "SIX", GLFW_KEY_6 },
+            { "SEVEN", GLFW_KEY_7 },
+            { "EIGHT", GLFW_KEY_8 },
+            { "NINE", GLFW_KEY_9 },
+            { "SEMICOLON", GLFW_KEY_SEMICOLON },
+            { "EQUAL", GLFW_KEY_EQUAL },
+            { "A", GLFW_KEY_A },
+            { "B", GLFW_KEY_B },
+            { "C", GLFW_KEY_C },
+            { "D", GLFW_KEY_D },
+            { "E", GLFW_KEY_E },
+            { "F", GLFW_KEY_F },
+            { "G", GLFW_KEY_G },
+            { "H", GLFW_KEY_H },
+            { "I", GLFW_KEY_I },
+            { "J", GLFW_KEY_J },
+            { "K", GLFW_KEY_K },
+            { "L", GLFW_KEY_L },
+            { "M", GLFW_KEY_M },
+            { "N", GLFW_KEY_N },
+            { "O", GLFW_KEY_O },
+            { "P", GLFW_KEY_P },
+            { "Q", GLFW_KEY_Q },
+            { "R", GLFW_KEY_R },
+            { "S", GLFW_KEY_S },
+            { "T", GLFW_KEY_T },
+            { "U", GLFW_KEY_U },
+            { "V", GLFW_KEY_V },
+            { "W", GLFW_KEY_W },
+            { "X", GLFW_KEY_X },
+            { "Y", GLFW_KEY_Y },
+            { "Z", GLFW_KEY_Z },
+            { "LEFT_BRACKET", GLFW_KEY_LEFT_BRACKET },
+            { "BACKSLASH", GLFW_KEY_BACKSLASH },
+            { "RIGHT_BRACKET", GLFW_KEY_RIGHT_BRACKET },
+            { "GRAVE_ACCENT", GLFW_KEY_GRAVE_ACCENT },
+            { "WORLD_1", GLFW_KEY_WORLD_1 },
+            { "WORLD_2", GLFW_KEY_WORLD_2 },
+            { "ESCAPE", GLFW_KEY_ESCAPE },
+            { "ENTER", GLFW_KEY_ENTER },
+            { "TAB", GLFW_KEY_TAB },
+            { "BACKSPACE", GLFW_KEY_BACKSPACE },
+            { "INSERT", GLFW_KEY_INSERT },
+            { "DELETE", GLFW_KEY_DELETE },
+            { "RIGHT", GLFW_KEY_RIGHT },
+            { "LEFT", GLFW_KEY_LEFT },
+            { "DOWN", GLFW_KEY_DOWN },
+            { "UP", GLFW_KEY_UP },
+            { "PAGE_UP", GLFW_KEY_PAGE_UP },
+            { "PAGE_DOWN", GLFW_KEY_PAGE_DOWN },
+            { "HOME", GLFW_KEY_HOME },
+            { "END", GLFW_KEY_END },
+            { "CAPS_LOCK", GLFW_KEY_CAPS_LOCK },
+            { "SCROLL_LOCK", GLFW_KEY_SCROLL_LOCK },
+            { "NUM_LOCK", GLFW_KEY_NUM_LOCK },
+            { "PRINT_SCREEN", GLFW_KEY_PRINT_SCREEN },
+            { "PAUSE", GLFW_KEY_PAUSE },
+            { "F1", GLFW_KEY_F1 },
+            { "F2", GLFW_KEY_F2 },
+            { "F3", GLFW_KEY_F3 },
+            { "F4", GLFW_KEY_F4 },
+            { "F5", GLFW_KEY_F5 },
+            { "F6", GLFW_KEY_F6 },
+            { "F7", GLFW_KEY_F7 },
+            { "F8", GLFW_KEY_F8 },
+            { "F9", GLFW_KEY_F9 },
+            { "F10", GLFW_KEY_F10 },
+            { "F11", GLFW_KEY_F11 },
+            { "F12", GLFW_KEY_F12 },
+            { "F13", GLFW_KEY_F13 },
+            { "F14", GLFW_KEY_F14 },
+            { "F15", GLFW_KEY_F15 },
+            { "F16", GLFW_KEY_F16 },
+            { "F17", GLFW_KEY_F17 },
+            { "F18", GLFW_KEY_F18 },
+            { "F19", GLFW_KEY_F19 },
+            { "F20", GLFW_KEY_F20 },
+            { "F21", GLFW_KEY_F21 },
+            { "F22", GLFW_KEY_F22 },
+            { "F23", GLFW_KEY_F23 },
+            { "F24", GLFW_KEY_F24 },
+            { "F25", GLFW_KEY_F25 },
+            { "KP_0", GLFW_KEY_KP_0 },
+            { "KP_1", GLFW_KEY_KP_1 },
+            { "KP_2", GLFW_KEY_KP_2 },
+            { "KP_3", GLFW_KEY_KP_3 },
+            { "KP_4", GLFW_KEY_KP_4 },
+            { "KP_5", GLFW_KEY_KP_5 },
+            { "KP_6", GLFW_KEY_KP_6 },
+            { "KP_7", GLFW_KEY_KP_7 },
+            { "KP_8", GLFW_KEY_KP_8 },
+            { "KP_9", GLFW_KEY_KP_9 },
+            { "KP_DECIMAL", GLFW_KEY_KP_DECIMAL },
+            { "KP_DIVIDE", GLFW_KEY_KP_DIVIDE },
+            { "KP_MULTIPLY", GLFW_KEY_KP_MULTIPLY },
+            { "KP_SUBTRACT", GLFW_KEY_KP_SUBTRACT },
+            { "KP_ADD", GLFW_KEY_KP_ADD },
+            { "KP_ENTER", GLFW_KEY_KP_ENTER },
+            { "KP_EQUAL", GLFW_KEY_KP_EQUAL },
+            { "LEFT_SHIFT", GLFW_KEY_LEFT_SHIFT },
+            { "LEFT_CONTROL", GLFW_KEY_LEFT_CONTROL },
+            { "LEFT_ALT", GLFW_KEY_LEFT_ALT },
+            { "LEFT_SUPER", GLFW_KEY_LEFT_SUPER },
+            { "RIGHT_SHIFT", GLFW_KEY_RIGHT_SHIFT },
+            { "RIGHT_CONTROL", GLFW_KEY_RIGHT_CONTROL },
+            { "RIGHT_ALT", GLFW_KEY_RIGHT_ALT },
+            { "RIGHT_SUPER", GLFW_KEY_RIGHT_SUPER },
+            { "MENU", GLFW_KEY_MENU }
+        }};
+
+        constexpr std::array<Name, 15> GAMEPAD_NAMES = {{
+            { "A", GLFW_GAMEPAD_BUTTON_A },
+            { "B", GLFW_GAMEPAD_BUTTON_B },
+            { "X", GLFW_GAMEPAD_BUTTON_X },
+            { "Y", GLFW_GAMEPAD_BUTTON_Y },
+            { "LEFT_BUMPER", GLFW_GAMEPAD_BUTTON_LEFT_BUMPER },
+            { "RIGHT_BUMPER", GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER },
+            { "BACK", GLFW_GAMEPAD_BUTTON_BACK },
+            { "START", GLFW_GAMEPAD_BUTTON_START },
+            { "GUIDE", GLFW_GAMEPAD_BUTTON_GUIDE },
+            { "LEFT_THUMB", GLFW_GAMEPAD_BUTTON_LEFT_THUMB },
+            { "RIGHT_THUMB", GLFW_GAMEPAD_BUTTON_RIGHT_THUMB },
+            { "DPAD_UP", GLFW_GAMEPAD_BUTTON_DPAD_UP },
+            { "DPAD_RIGHT", GLFW_GAMEPAD_BUTTON_DPAD_RIGHT },
+            { "DPAD_DOWN", GLFW_GAMEPAD_BUTTON_DPAD_DOWN },
+            { "DPAD_LEFT", GLFW_GAMEPAD_BUTTON_DPAD_LEFT }
+        }};
+
+        constexpr std::array<Name, 3> MOUSE_NAMES = {{
+            { "LEFT", GLFW_MOUSE_BUTTON_LEFT },
+            { "RIGHT", GLFW_MOUSE_BUTTON_RIGHT },
+            { "MIDDLE", GLFW_MOUSE_BUTTON_MIDDLE }
+        }};
+
+        constexpr std::array<Name, 5> MODIFIER_NAMES = {{
+            { "CONTROL", GLFW_MOD_CONTROL },
+            { "CTRL", GLFW_MOD_CONTROL },
+            { "SHIFT", GLFW_MOD_SHIFT },
+            { "ALT", GLFW_MOD_ALT },
+            { "SUPER", GLFW_MOD_SUPER }
+        }};
+
+        [[nodiscard]] std::string_view Trim(std::string_view text)
+        {
+            while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+        [[nodiscard]] std::string Normalize(std::string_view text)
+        {
+            std::string result;
+            for (char character : Trim(text))
+            {
+                if (std::isspace(static_cast<unsigned char>(character)))
+                {
+                    if (!result.empty() && result.back() != '_') {
+                        result += '_';
+                    }
+                    continue;
+                }
+                result += static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+            }
+            return result;
+        }
+
+        [[nodiscard]] std::string Capitalize(std::string_view name)
+        {
+            std::string result;
+            bool first = true;
+            for (char character : name)
+            {
+                if (character == '_')
+                {
+                    result += ' ';
+                    first = true;
+                    continue;
+                }
+                result += first ? character : static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+                first = false;
+            }
+            return result;
+        }
+
+        template<std::size_t Size_T>
+        [[nodiscard]] const Name* FindName(const std::array<Name, Size_T>& names, std::string_view name)
+        {
+            auto it = std::find_if(names.begin(), names.end(), [name](const Name& entry) { return entry.mName == name; });
+            return it != names.end() ? &*it : nullptr;
+        }
+
+        template<std::size_t Size_T>
+        [[nodiscard]] const Name* FindCode(const std::array<Name, Size_T>& names, int32_t code)
+        {
+            auto it = std::find_if(names.begin(), names.end(), [code](const Name& entry) { return entry.mCode == code; });
+            return it != names.end() ? &*it : nullptr;
+        }
+    }
+
+    ActionMap::ActionMap()
+     : mTable{},
+       mActive{},
+       mActions{},
+       mAxes{},
+       mGamepadAxes{},
+       mActionCount{},
+       mAxisCount{}
+    {
+        Clear();
+    }
+
+    [[maybe_unused]] Action ActionMap::AddAction(std::string_view name)
+    {
+        if (mActionCount == MAX_ACTIONS) {
+            throw InputException(std::format("Cannot add action \"{}\", the limit is {}.", name, MAX_ACTIONS));
+        }
+        for (std::size_t i = 0; i < mActionCount; i++) {
+            if (mActions[i].mName == name) {
+                throw InputException(std::format("Action \"{}\" already exists.", name));
+            }
+        }
+
+        ActionData& data = mActions[mActionCount];
+        data.mName = name;
+        data.mBindingCount = 0;
+        data.mHeld = 0;
+        data.mPressed = false;
+        data.mReleased = false;
+
+        return static_cast<Action>(mActionCount++);
+    }
+
+    [[maybe_unused]] Axis ActionMap::AddAxis(std::string_view name, Action negative, Action positive, int32_t gamepadAxis)
+    {
+        if (mAxisCount == MAX_AXES) {
+            throw InputException(std::format("Cannot add axis \"{}\", the limit is {}.", name, MAX_AXES));
+        }
+        if (negative != NULL_ACTION) {
+            mCheckAction(negative);
+        }
+        if (positive != NULL_ACTION) {
+            mCheckAction(positive);
+        }
+        if (gamepadAxis >= static_cast<int32_t>(GAMEPAD_AXIS_COUNT)) {
+            throw InputException(std::format("Invalid gamepad axis {}.", gamepadAxis));
+        }
+
+        mAxes[mAxisCount] = { std::string(name), negative, positive, gamepadAxis };
+        return static_cast<Axis>(mAxisCount++);
+    }
+
+    void ActionMap::Bind(Action action, const Binding& binding) {
+        mBind(action, { &binding, 1 });
+    }
+
+    void ActionMap::Bind(Action action, std::string_view bindings)
+    {
+        std::string_view list = bindings;
+        std::array<Binding, MAX_BINDINGS> parsed;
+        std::size_t count = 0;
+
+        while (!bindings.empty())
+        {
+            if (count == MAX_BINDINGS) {
+                throw InputException(std::format("\"{}\" lists more than {} bindings.", list, MAX_BINDINGS));
+            }
+
+            std::size_t separator = bindings.find('|');
+            parsed[count++] = ParseBinding(bindings.substr(0, separator));
+
+            if (separator == std::string_view::npos) {
+                break;
+            }
+            bindings.remove_prefix(separator + 1);
+        }
+
+        mBind(action, { parsed.data(), count });
+    }
+
+    void ActionMap::Rebind(Action action, std::size_t index, const Binding& binding)
+    {
+        mCheckAction(action);
+
+        ActionData& data = mActions[action];
+        if (index > data.mBindingCount || index >= MAX_BINDINGS) {
+            throw InputException(std::format("Action \"{}\" has no binding {}.", data.mName, index));
+        }
+        if (mGetSlot(binding) == mTABLE_SIZE) {
+            throw InputException(std::format("Invalid binding code {}.", binding.mCode));
+        }
+
+        mTake(action, binding);
+        data.mBindings[index] = binding;
+        data.mBindingCount = std::max<uint8_t>(data.mBindingCount, static_cast<uint8_t>(index + 1));
+        mCompile();
+    }
+
+    void ActionMap::Unbind(Action action)
+    {
+        mCheckAction(action);
+
+        mActions[action].mBindingCount = 0;
+        mCompile();
+    }
+
+    void ActionMap::Clear()
+    {
+        mActionCount = 0;
+        mAxisCount = 0;
+        mActive.fill(NULL_ACTION);
+        mGamepadAxes.fill(0.0f);
+        mCompile();
+    }
+
+    void ActionMap::NewFrame()
+    {
+        for (std::size_t i = 0; i < mActionCount; i++)
+        {
+            mActions[i].mPressed = false;
+            mActions[i].mReleased = false;
+        }
+    }
+
+    void ActionMap::OnKey(Key key, Keyboard::Action action, Modifier mods)
+    {
+        std::size_t slot = mGetSlot({ Device::KEYBOARD, static_cast<int32_t>(key), {} });
+        if (slot == mTABLE_SIZE) {
+            return;
+        }
+
+        if (action == Keyboard::Action::PRESSED) {
+            mPress(slot, static_cast<uint8_t>(mods));
+        }
+        else if (action == Keyboard::Action::RELEASED) {
+            mRelease(slot);
+        }
+    }
+
+    void ActionMap::OnMouseButton(Button button, Mouse::Action action, Modifier mods)
+    {
+        std::size_t slot = mGetSlot({ Device::MOUSE, static_cast<int32_t>(button), {} });
+        if (slot == mTABLE_SIZE) {
+            return;
+        }
+
+        if (action == Mouse::Action::PRESSED) {
+            mPress(slot, static_cast<uint8_t>(mods));
+        }
+        else if (action == Mouse::Action::RELEASED) {
+            mRelease(slot);
+        }
+    }
+
+    void ActionMap::OnGamepadButton(int32_t button, bool pressed)
+    {
+        std::size_t slot = mGetSlot({ Device::GAMEPAD, button, {} });
+        if (slot == mTABLE_SIZE) {
+            return;
+        }
+
+        if (pressed) {
+            mPress(slot, 0);
+        }
+        else {
+            mRelease(slot);
+        }
+    }
+
+    void ActionMap::OnGamepadAxis(int32_t axis, float value)
+    {
+        if (axis >= 0 && axis < static_cast<int32_t>(GAMEPAD_AXIS_COUNT)) {
+            mGamepadAxes[axis] = value;
+        }
+    }
+
+    [[nodiscard]] Action ActionMap::Resolve(Key key, Modifier mods) const {
+        return Resolve({ Device::KEYBOARD, static_cast<int32_t>(key), mods });
+    }
+
+    [[nodiscard]] Action ActionMap::Resolve(Button button, Modifier mods) const {
+        return Resolve({ Device::MOUSE, static_cast<int32_t>(button), mods });
+    }
+
+    [[nodiscard]] Action ActionMap::Resolve(const Binding& binding) const
+    {
+        std::size_t slot = mGetSlot(binding);
+        if (slot == mTABLE_SIZE) {
+            return NULL_ACTION;
+        }
+
+        return mLookup(slot, static_cast<uint8_t>(binding.mModifiers));
+    }
+
+    [[nodiscard]] bool ActionMap::IsDown(Action action) const
+    {
+        mCheckAction(action);
+        return mActions[action].mHeld != 0;
+    }
+
+    [[nodiscard]] bool ActionMap::WasPressed(Action action) const
+    {
+        mCheckAction(action);
+        return mActions[action].mPressed;
+    }
+
+    [[nodiscard]] bool ActionMap::WasReleased(Action action) const
+    {
+        mCheckAction(action);
+        return mActions[action].mReleased;
+    }
+
+    [[nodiscard]] float ActionMap::GetAxis(Axis axis) const
+    {
+        if (axis >= mAxisCount) {
+            throw InputException(std::format("Invalid axis {}.", axis));
+        }
+
+        const AxisData& data = mAxes[axis];
+        float value = 0.0f;
+
+        if (data.mNegative != NULL_ACTION && mActions[data.mNegative].mHeld != 0) {
+            value -= 1.0f;
+        }
+        if (data.mPositive != NULL_ACTION && mActions[data.mPositive].mHeld != 0) {
+            value += 1.0f;
+        }
+        if (data.mGamepadAxis >= 0) {
+            value += mGamepadAxes[data.mGamepadAxis];
+        }
+
+        return std::clamp(value, -1.0f, 1.0f);
+    }
+
+    [[nodiscard]] Action ActionMap::GetAction(std::string_view name) const
+    {
+        for (std::size_t i = 0; i < mActionCount; i++) {
+            if (mActions[i].mName == name) {
+                return static_cast<Action>(i);
+            }
+        }
+
+        throw InputException(std::format("Action \"{}\" does not exist.", name));
+    }
+
+    [[nodiscard]] Axis ActionMap::GetAxis(std::string_view name) const
+    {
+        for (std::size_t i = 0; i < mAxisCount; i++) {
+            if (mAxes[i].mName == name) {
+                return static_cast<Axis>(i);
+            }
+        }
+
+        throw InputException(std::format("Axis \"{}\" does not exist.", name));
+    }
+
+    [[nodiscard]] std::string_view ActionMap::GetName(Action action) const
+    {
+        mCheckAction(action);
+        return mActions[action].mName;
+    }
+
+    [[nodiscard]] std::span<const Binding> ActionMap::GetBindings(Action action) const
+    {
+        mCheckAction(action);
+        return { mActions[action].mBindings.data(), mActions[action].mBindingCount };
+    }
+
+    [[nodiscard]] std::size_t ActionMap::GetActionCount() const {
+        return mActionCount;
+    }
+
+    [[nodiscard]] Binding ActionMap::ParseBinding(std::string_view binding)
+    {
+        Binding result{ Device::KEYBOARD, -1, {} };
+        int32_t modifiers = 0;
+
+        std::string_view text = Trim(binding);
+        std::size_t separator;
+        while ((separator = text.find('+')) != std::string_view::npos)
+        {
+            const Name* modifier = FindName(MODIFIER_NAMES, Normalize(text.substr(0, separator)));
+            if (modifier == nullptr) {
+                throw InputException(std::format("Unknown modifier in binding \"{}\".", binding));
+            }
+
+            modifiers |= modifier->mCode;
+            text.remove_prefix(separator + 1);
+        }
+        result.mModifiers = static_cast<Modifier>(modifiers);
+
+        std::string name = Normalize(text);
+        const Name* found = nullptr;
+
+        if (name.starts_with("MOUSE_"))
+        {
+            result.mDevice = Device::MOUSE;
+            name.erase(0, 6);
+
+            if (name.size() == 1 && name[0] >= '1' && name[0] <= '8') {
+                result.mCode = name[0] - '1';
+                return result;
+            }
+            found = FindName(MOUSE_NAMES, name);
+        }
+        else if (name.starts_with("GAMEPAD_"))
+        {
+            result.mDevice = Device::GAMEPAD;
+            found = FindName(GAMEPAD_NAMES, std::string_view(name).substr(8));
+        }
+        else
+        {
+            if (name.size() == 1 && name[0] >= '0' && name[0] <= '9') {
+                result.mCode = GLFW_KEY_0 + (name[0] - '0');
+                return result;
+            }
+            found = FindName(KEY_NAMES, name);
+        }
+
+        if (found == nullptr) {
+            throw InputException(std::format("Unknown binding \"{}\".", binding));
+        }
+
+        result.mCode = found->mCode;
+        return result;
+    }
+
+    [[nodiscard]] std::string ActionMap::FormatBinding(const Binding& binding)
+    {
+        std::string result;
+
+        int32_t modifiers = static_cast<int32_t>(binding.mModifiers);
+        for (const Name& modifier : MODIFIER_NAMES) {
+            if ((modifiers & modifier.mCode) != 0 && modifier.mName != "CTRL") {
+                result += Capitalize(modifier.mName) + "+";
+            }
+        }
+
+        switch (binding.mDevice)
+        {
+            case Device::KEYBOARD:
+                if (const Name* name = FindCode(KEY_NAMES, binding.mCode); name != nullptr) {
+                    return result + Capitalize(name->mName);
+                }
+                break;
+            case Device::MOUSE:
+                if (const Name* name = FindCode(MOUSE_NAMES, binding.mCode); name != nullptr) {
+                    return result + "Mouse " + Capitalize(name->mName);
+                }
+                return result + std::format("Mouse {}", binding.mCode + 1);
+            case Device::GAMEPAD:
+                if (const Name* name = FindCode(GAMEPAD_NAMES, binding.mCode); name != nullptr) {
+                    return result + "Gamepad " + Capitalize(name->mName);
+                }
+                break;
+        }
+
+        return result + std::format("Unknown {}", binding.mCode);
+    }
+
+    [[nodiscard]] std::size_t ActionMap::mGetSlot(const Binding& binding)
+    {
+        if (binding.mCode < 0) {
+            return mTABLE_SIZE;
+        }
+
+        std::size_t code = static_cast<std::size_t>(binding.mCode);
+        switch (binding.mDevice)
+        {
+            case Device::KEYBOARD:
+                return code < KEY_COUNT ? code : mTABLE_SIZE;
+            case Device::MOUSE:
+                return code < BUTTON_COUNT ? KEY_COUNT + code : mTABLE_SIZE;
+            case Device::GAMEPAD:
+                return code < GAMEPAD_BUTTON_COUNT ? KEY_COUNT + BUTTON_COUNT + code : mTABLE_SIZE;
+        }
+
+        return mTABLE_SIZE;
+    }
+
+    [[nodiscard]] Action ActionMap::mLookup(std::size_t slot, uint8_t modifiers) const
+    {
+        modifiers &= mCHORD_MASK;
+
+        Action action = NULL_ACTION;
+        int best = -1;
+
+        for (const Entry& entry : mTable[slot])
+        {
+            if (entry.mAction == NULL_ACTION || (entry.mModifiers & ~modifiers) != 0) {
+                continue;
+            }
+
+            int specificity = std::popcount(entry.mModifiers);
+            if (specificity > best)
+            {
+                best = specificity;
+                action = entry.mAction;
+            }
+        }
+
+        return action;
+    }
+
+    void ActionMap::mCheckAction(Action action) const
+    {
+        if (action >= mActionCount) {
+            throw InputException(std::format("Invalid action {}.", action));
+        }
+    }
+
+    [[nodiscard]] bool ActionMap::mSameInput(const Binding& first, const Binding& second)
+    {
+        return first.mDevice == second.mDevice && first.mCode == second.mCode
+            && (static_cast<uint8_t>(first.mModifiers) & mCHORD_MASK) == (static_cast<uint8_t>(second.mModifiers) & mCHORD_MASK);
+    }
+
+    void ActionMap::mBind(Action action, std::span<const Binding> bindings)
+    {
+        mCheckAction(action);
+
+        ActionData& data = mActions[action];
+        if (data.mBindingCount + bindings.size() > MAX_BINDINGS) {
+            throw InputException(std::format("Action \"{}\" cannot hold more than {} bindings.", data.mName, MAX_BINDINGS));
+        }
+
+        // Everything is checked up front, so a failing binding leaves the
+        // action and the lookup table as they were.
+        for (const Binding& binding : bindings)
+        {
+            std::size_t slot = mGetSlot(binding);
+            if (slot == mTABLE_SIZE) {
+                throw InputException(std::format("Invalid binding code {}.", binding.mCode));
+            }
+
+            uint8_t modifiers = static_cast<uint8_t>(binding.mModifiers) & mCHORD_MASK;
+            if (std::none_of(mTable[slot].begin(), mTable[slot].end(), [modifiers](const Entry& entry) { return entry.mAction == NULL_ACTION || entry.mModifiers == modifiers; })) {
+                throw InputException(std::format("Too many chords on \"{}\".", FormatBinding(binding)));
+            }
+        }
+
+        for (const Binding& binding : bindings)
+        {
+            mTake(action, binding);
+            mInsert(action, binding);
+
+            auto bound = data.mBindings.begin() + data.mBindingCount;
+            if (std::none_of(data.mBindings.begin(), bound, [&binding](const Binding& existing) { return mSameInput(existing, binding); })) {
+                data.mBindings[data.mBindingCount++] = binding;
+            }
+        }
+    }
+
+    void ActionMap::mTake(Action action, const Binding& binding)
+    {
+        uint8_t modifiers = static_cast<uint8_t>(binding.mModifiers) & mCHORD_MASK;
+
+        for (Entry& entry : mTable[mGetSlot(binding)])
+        {
+            if (entry.mAction == NULL_ACTION || entry.mAction == action || entry.mModifiers != modifiers) {
+                continue;
+            }
+
+            ActionData& owner = mActions[entry.mAction];
+            auto bound = owner.mBindings.begin() + owner.mBindingCount;
+            owner.mBindingCount = static_cast<uint8_t>(std::remove_if(owner.mBindings.begin(), bound, [&binding](const Binding& existing) {
+                return mSameInput(existing, binding);
+            }) - owner.mBindings.begin());
+
+            entry.mAction = NULL_ACTION;
+        }
+    }
+
+    void ActionMap::mInsert(Action action, const Binding& binding)
+    {
+        std::size_t slot = mGetSlot(binding);
+        if (slot == mTABLE_SIZE) {
+            throw InputException(std::format("Invalid binding code {}.", binding.mCode));
+        }
+
+        uint8_t modifiers = static_cast<uint8_t>(binding.mModifiers) & mCHORD_MASK;
+        Entry* free = nullptr;
+
+        for (Entry& entry : mTable[slot])
+        {
+            if (entry.mAction != NULL_ACTION && entry.mModifiers == modifiers)
+            {
+                entry.mAction = action;
+                return;
+            }
+            if (entry.mAction == NULL_ACTION && free == nullptr) {
+                free = &entry;
+            }
+        }
+
+        if (free == nullptr) {
+            throw InputException(std::format("Too many chords on \"{}\".", FormatBinding(binding)));
+        }
+
+        *free = { modifiers, action };
+    }
+
+    void ActionMap::mCompile()
+    {
+        for (auto& entries : mTable) {
+            entries.fill({ 0, NULL_ACTION });
+        }
+
+        for (std::size_t i = 0; i < mActionCount; i++) {
+            for (uint8_t j = 0; j < mActions[i].mBindingCount; j++) {
+                mInsert(static_cast<Action>(i), mActions[i].mBindings[j]);
+            }
+        }
+    }
+
+    void ActionMap::mPress(std::size_t slot, uint8_t modifiers)
+    {
+        if (mActive[slot] != NULL_ACTION) {
+            return;
+        }
+
+        Action action = mLookup(slot, modifiers);
+        mActive[slot] = action;
+        if (action == NULL_ACTION) {
+            return;
+        }
+
+        ActionData& data = mActions[action];
+        if (data.mHeld++ == 0) {
+            data.mPressed = true;
+        }
+    }
+
+    void ActionMap::mRelease(std::size_t slot)
+    {
+        Action action = mActive[slot];
+        if (action == NULL_ACTION) {
+            return;
+        }
+        mActive[slot] = NULL_ACTION;
+
+        ActionData& data = mActions[action];
+        if (data.mHeld != 0 && --data.mHeld == 0) {
+            data.mReleased = true;
+        }
+    }
+}
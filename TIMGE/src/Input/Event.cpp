@@ -0,0 +1,220 @@
+#include "TIMGE/Input/Event.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <format>
+
+namespace TIMGE::Input
+{
+    namespace
+    {
+        constexpr std::array<uint8_t, 5> HEADER = { 'T', 'I', 'M', 'R', 1 };
+
+        struct Layout
+        {
+            uint8_t mIntegers;
+            uint8_t mReals;
+        };
+
+        constexpr std::array<Layout, static_cast<std::size_t>(EventType::COUNT)> LAYOUTS = {{
+            { 0, 1 }, // FRAME
+            { 3, 0 }, // MOUSE_BUTTON
+            { 0, 2 }, // CURSOR_POS
+            { 1, 0 }, // CURSOR_ENTER
+            { 0, 2 }, // SCROLL
+            { 4, 0 }, // KEY
+            { 1, 0 }, // CHAR
+            { 2, 0 }, // CHAR_MODS
+            { 0, 0 }, // DROP
+            { 2, 0 }  // JOYSTICK
+        }};
+    }
+
+    InputException::InputException(std::string message)
+     : Exception(std::format("Input: {}", message))
+    {}
+
+    EventWriter::EventWriter()
+     : mFrame{}, mTimestamp{}, mEventCount{}
+    {
+        mWriteHeader();
+    }
+
+    void EventWriter::Write(const Event& event)
+    {
+        if (event.mType >= EventType::COUNT) {
+            throw InputException("Invalid event type.");
+        }
+        if (event.mFrame < mFrame || event.mTimestamp < mTimestamp) {
+            throw InputException("Events must be written in order.");
+        }
+
+        mData.push_back(static_cast<uint8_t>(event.mType));
+        mWriteVarint(event.mFrame - mFrame);
+        mWriteVarint(event.mTimestamp - mTimestamp);
+        mFrame = event.mFrame;
+        mTimestamp = event.mTimestamp;
+
+        const Layout& layout = LAYOUTS[static_cast<std::size_t>(event.mType)];
+        for (uint8_t i = 0; i < layout.mIntegers; i++) {
+            mWriteInteger(event.mIntegers[i]);
+        }
+        for (uint8_t i = 0; i < layout.mReals; i++) {
+            mWriteReal(event.mReals[i]);
+        }
+
+        if (event.mType == EventType::DROP)
+        {
+            mWriteVarint(event.mPaths.size());
+            for (const std::string& path : event.mPaths)
+            {
+                mWriteVarint(path.size());
+                mData.insert(mData.end(), path.begin(), path.end());
+            }
+        }
+
+        mEventCount++;
+    }
+
+    void EventWriter::Clear()
+    {
+        mData.clear();
+        mFrame = 0;
+        mTimestamp = 0;
+        mEventCount = 0;
+        mWriteHeader();
+    }
+
+    [[nodiscard]] const std::vector<uint8_t>& EventWriter::GetData() const {
+        return mData;
+    }
+
+    [[nodiscard]] std::size_t EventWriter::GetEventCount() const {
+        return mEventCount;
+    }
+
+    void EventWriter::mWriteHeader() {
+        mData.insert(mData.end(), HEADER.begin(), HEADER.end());
+    }
+
+    void EventWriter::mWriteVarint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            mData.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        mData.push_back(static_cast<uint8_t>(value));
+    }
+
+    void EventWriter::mWriteInteger(int32_t value)
+    {
+        uint32_t bits = static_cast<uint32_t>(value);
+        mWriteVarint((bits << 1) ^ (value < 0 ? ~0u : 0u));
+    }
+
+    void EventWriter::mWriteReal(double value)
+    {
+        uint64_t bits = std::bit_cast<uint64_t>(value);
+        for (uint32_t i = 0; i < sizeof(bits); i++) {
+            mData.push_back(static_cast<uint8_t>(bits >> (i * 8)));
+        }
+    }
+
+    EventReader::EventReader(std::span<const uint8_t> data)
+     : mData{data}, mOffset{}, mFrame{}, mTimestamp{}
+    {
+        if (mData.empty()) {
+            return;
+        }
+        if (mData.size() < HEADER.size() || !std::equal(HEADER.begin(), HEADER.end(), mData.begin())) {
+            throw InputException("Not an input recording.");
+        }
+        mOffset = HEADER.size();
+    }
+
+    [[nodiscard]] bool EventReader::Read(Event& event)
+    {
+        if (mOffset >= mData.size()) {
+            return false;
+        }
+
+        uint8_t type = mData[mOffset++];
+        if (type >= static_cast<uint8_t>(EventType::COUNT)) {
+            throw InputException(std::format("Invalid event type {} at offset {}.", type, mOffset - 1));
+        }
+
+        event.mType = static_cast<EventType>(type);
+        mFrame += mReadVarint();
+        mTimestamp += mReadVarint();
+        event.mFrame = mFrame;
+        event.mTimestamp = mTimestamp;
+        event.mIntegers = {};
+        event.mReals = {};
+        event.mPaths.clear();
+
+        const Layout& layout = LAYOUTS[type];
+        for (uint8_t i = 0; i < layout.mIntegers; i++) {
+            event.mIntegers[i] = mReadInteger();
+        }
+        for (uint8_t i = 0; i < layout.mReals; i++) {
+            event.mReals[i] = mReadReal();
+        }
+
+        if (event.mType == EventType::DROP)
+        {
+            uint64_t count = mReadVarint();
+            for (uint64_t i = 0; i < count; i++)
+            {
+                uint64_t length = mReadVarint();
+                if (length > mData.size() - mOffset) {
+                    throw InputException("Truncated input recording.");
+                }
+
+                event.mPaths.emplace_back(reinterpret_cast<const char*>(mData.data() + mOffset), length);
+                mOffset += length;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] uint64_t EventReader::mReadVarint()
+    {
+        uint64_t value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7)
+        {
+            if (mOffset >= mData.size()) {
+                throw InputException("Truncated input recording.");
+            }
+
+            uint8_t byte = mData[mOffset++];
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+
+        throw InputException("Malformed varint in input recording.");
+    }
+
+    [[nodiscard]] int32_t EventReader::mReadInteger()
+    {
+        uint32_t bits = static_cast<uint32_t>(mReadVarint());
+        return static_cast<int32_t>((bits >> 1) ^ (~(bits & 1) + 1));
+    }
+
+    [[nodiscard]] double EventReader::mReadReal()
+    {
+        if (mData.size() - mOffset < sizeof(uint64_t)) {
+            throw InputException("Truncated input recording.");
+        }
+
+        uint64_t bits = 0;
+        for (uint32_t i = 0; i < sizeof(bits); i++) {
+            bits |= static_cast<uint64_t>(mData[mOffset++]) << (i * 8);
+        }
+
+        return std::bit_cast<double>(bits);
+    }
+}
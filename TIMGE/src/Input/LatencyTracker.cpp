@@ -0,0 +1,187 @@
+#include "TIMGE/Input/LatencyTracker.hpp"
+#include "TIMGE/Input/Event.hpp"
+
+#include <algorithm>
+#include <format>
+#include <string_view>
+
+namespace TIMGE::Input
+{
+    namespace
+    {
+        constexpr std::array<std::string_view, static_cast<std::size_t>(LatencyTracker::Source::COUNT)> SOURCE_NAMES = {
+            "KEY",
+            "MOUSE_BUTTON",
+            "CURSOR_POS",
+            "SCROLL"
+        };
+    }
+
+    LatencyTracker::LatencyTracker()
+     : mPending{},
+       mInFlight{},
+       mPendingCount{},
+       mInFlightCount{},
+       mDistributions{},
+       mFrame{},
+       mDropped{},
+       mEnabled{false}
+    {
+        Reset();
+    }
+
+    void LatencyTracker::SetEnabled(bool enabled)
+    {
+        mEnabled = enabled;
+        mPendingCount = 0;
+        mInFlightCount = 0;
+    }
+
+    void LatencyTracker::Reset()
+    {
+        for (Distribution& distribution : mDistributions)
+        {
+            distribution.mBins.fill(0);
+            distribution.mCount = 0;
+            distribution.mSum = 0.0;
+            distribution.mMin = 0.0;
+            distribution.mMax = 0.0;
+        }
+
+        mPendingCount = 0;
+        mInFlightCount = 0;
+        mDropped = 0;
+    }
+
+    void LatencyTracker::OnInput(Source source)
+    {
+        if (!mEnabled) {
+            return;
+        }
+        if (mPendingCount == MAX_PENDING)
+        {
+            mDropped++;
+            return;
+        }
+
+        mPending[mPendingCount++] = { source, Clock_T::now() };
+    }
+
+    void LatencyTracker::OnFrameBegin()
+    {
+        mFrame++;
+        if (!mEnabled) {
+            return;
+        }
+
+        std::size_t count = std::min(mPendingCount, MAX_PENDING - mInFlightCount);
+        std::copy_n(mPending.begin(), count, mInFlight.begin() + mInFlightCount);
+
+        mInFlightCount += count;
+        mDropped += mPendingCount - count;
+        mPendingCount = 0;
+    }
+
+    void LatencyTracker::OnFramePresented()
+    {
+        if (!mEnabled) {
+            return;
+        }
+
+        Clock_T::time_point presented = Clock_T::now();
+
+        for (std::size_t i = 0; i < mInFlightCount; i++)
+        {
+            const Pending& pending = mInFlight[i];
+            Distribution& distribution = mDistributions[static_cast<std::size_t>(pending.mSource)];
+
+            double milliseconds = std::chrono::duration<double, std::milli>(presented - pending.mArrival).count();
+            std::size_t bin = std::min(static_cast<std::size_t>(milliseconds / BIN_WIDTH), BIN_COUNT);
+
+            distribution.mBins[bin]++;
+            distribution.mMin = distribution.mCount == 0 ? milliseconds : std::min(distribution.mMin, milliseconds);
+            distribution.mMax = distribution.mCount == 0 ? milliseconds : std::max(distribution.mMax, milliseconds);
+            distribution.mSum += milliseconds;
+            distribution.mCount++;
+        }
+
+        mInFlightCount = 0;
+    }
+
+    [[nodiscard]] bool LatencyTracker::IsEnabled() const {
+        return mEnabled;
+    }
+
+    [[nodiscard]] uint64_t LatencyTracker::GetFrame() const {
+        return mFrame;
+    }
+
+    [[nodiscard]] uint64_t LatencyTracker::GetDropped() const {
+        return mDropped;
+    }
+
+    [[nodiscard]] LatencyTracker::Statistics LatencyTracker::GetStatistics(Source source) const
+    {
+        if (source >= Source::COUNT) {
+            throw InputException("Invalid latency source.");
+        }
+
+        const Distribution& distribution = mDistributions[static_cast<std::size_t>(source)];
+        if (distribution.mCount == 0) {
+            return {};
+        }
+
+        return {
+            distribution.mCount,
+            distribution.mMin,
+            distribution.mMax,
+            distribution.mSum / distribution.mCount,
+            mPercentile(distribution, 0.50),
+            mPercentile(distribution, 0.90),
+            mPercentile(distribution, 0.99)
+        };
+    }
+
+    [[nodiscard]] std::span<const uint32_t> LatencyTracker::GetHistogram(Source source) const
+    {
+        if (source >= Source::COUNT) {
+            throw InputException("Invalid latency source.");
+        }
+
+        return mDistributions[static_cast<std::size_t>(source)].mBins;
+    }
+
+    [[nodiscard]] std::string LatencyTracker::Dump() const
+    {
+        std::string dump = std::format("{:<14} {:>8} {:>8} {:>8} {:>8} {:>8} {:>8}\n", "source", "count", "mean", "p50", "p90", "p99", "max");
+
+        for (std::size_t i = 0; i < SOURCE_NAMES.size(); i++)
+        {
+            Statistics statistics = GetStatistics(static_cast<Source>(i));
+            dump += std::format("{:<14} {:>8} {:>8.2f} {:>8.2f} {:>8.2f} {:>8.2f} {:>8.2f}\n",
+                SOURCE_NAMES[i], statistics.mCount, statistics.mMean, statistics.mP50, statistics.mP90, statistics.mP99, statistics.mMax);
+        }
+
+        if (mDropped != 0) {
+            dump += std::format("{} events dropped\n", mDropped);
+        }
+
+        return dump;
+    }
+
+    [[nodiscard]] double LatencyTracker::mPercentile(const Distribution& distribution, double fraction) const
+    {
+        uint64_t target = static_cast<uint64_t>(fraction * (distribution.mCount - 1)) + 1;
+        uint64_t cumulative = 0;
+
+        for (std::size_t bin = 0; bin < BIN_COUNT; bin++)
+        {
+            cumulative += distribution.mBins[bin];
+            if (cumulative >= target) {
+                return std::clamp((bin + 0.5) * BIN_WIDTH, distribution.mMin, distribution.mMax);
+            }
+        }
+
+        return distribution.mMax;
+    }
+}
@@ -0,0 +1,124 @@
+#include "TIMGE/Input/Recorder.hpp"
+#include "TIMGE/Application.hpp"
+
+#include <format>
+#include <fstream>
+
+#include <GLFW/glfw3.h>
+
+namespace TIMGE::Input
+{
+    Recorder* Recorder::mActive = nullptr;
+
+    Recorder::Recorder()
+     : mWriter{},
+       mApplication{nullptr},
+       mPreviousProcessor{nullptr},
+       mStartTime{},
+       mFrame{}
+    {}
+
+    Recorder::~Recorder() {
+        Stop();
+    }
+
+    void Recorder::Start(Application& application)
+    {
+        if (mActive != nullptr) {
+            throw InputException("A recording is already in progress.");
+        }
+
+        mWriter.Clear();
+        mApplication = &application;
+        mPreviousProcessor = application.GetEventProcessor();
+        mStartTime = std::chrono::steady_clock::now();
+        mFrame = 0;
+        mActive = this;
+
+        application.SetEventProcessor(&Recorder::mProcessEvents);
+    }
+
+    void Recorder::Stop()
+    {
+        if (mActive != this) {
+            return;
+        }
+
+        if (mApplication->GetEventProcessor() == &Recorder::mProcessEvents) {
+            mApplication->SetEventProcessor(mPreviousProcessor);
+        }
+        mActive = nullptr;
+    }
+
+    void Recorder::Save(const std::filesystem::path& path) const
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw InputException(std::format("Failed to open \"{}\" for writing.", path.string()));
+        }
+
+        const std::vector<uint8_t>& data = mWriter.GetData();
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            throw InputException(std::format("Failed to write \"{}\".", path.string()));
+        }
+    }
+
+    void Recorder::Record(EventType type, const std::array<int32_t, 4>& integers, const std::array<double, 2>& reals)
+    {
+        Event event{ type, 0, 0, integers, reals, {} };
+        mWrite(event);
+    }
+
+    void Recorder::RecordDrop(int pathCount, const char* paths[])
+    {
+        Event event{ EventType::DROP, 0, 0, {}, {}, {} };
+        event.mPaths.assign(paths, paths + pathCount);
+        mWrite(event);
+    }
+
+    [[nodiscard]] bool Recorder::IsRecording() const {
+        return mActive == this;
+    }
+
+    [[nodiscard]] uint64_t Recorder::GetFrame() const {
+        return mFrame;
+    }
+
+    [[nodiscard]] std::size_t Recorder::GetEventCount() const {
+        return mWriter.GetEventCount();
+    }
+
+    [[nodiscard]] const std::vector<uint8_t>& Recorder::GetData() const {
+        return mWriter.GetData();
+    }
+
+    [[nodiscard]] Recorder* Recorder::GetActive() {
+        return mActive;
+    }
+
+    void Recorder::mProcessEvents()
+    {
+        if (mActive == nullptr)
+        {
+            glfwPollEvents();
+            return;
+        }
+
+        Recorder& recorder = *mActive;
+
+        recorder.Record(EventType::FRAME, {}, { recorder.mApplication->GetDeltaTime(), 0.0 });
+        recorder.mPreviousProcessor();
+        recorder.mFrame++;
+    }
+
+    void Recorder::mWrite(Event& event)
+    {
+        event.mFrame = mFrame;
+        event.mTimestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - mStartTime
+        ).count());
+
+        mWriter.Write(event);
+    }
+}
@@ -0,0 +1,183 @@
+#include "TIMGE/Input/Replayer.hpp"
+#include "TIMGE/Application.hpp"
+#include "TIMGE/Callback.hpp"
+
+#include <format>
+#include <fstream>
+#include <iterator>
+
+namespace TIMGE::Input
+{
+    Replayer* Replayer::mActive = nullptr;
+
+    Replayer::Replayer()
+     : mData{},
+       mReader{},
+       mPending{},
+       mHasPending{false},
+       mDispatching{false},
+       mPinDeltaTime{true},
+       mApplication{nullptr},
+       mPreviousProcessor{nullptr},
+       mFrame{},
+       mEventCount{}
+    {}
+
+    Replayer::~Replayer() {
+        Stop();
+    }
+
+    void Replayer::Load(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw InputException(std::format("Failed to open \"{}\" for reading.", path.string()));
+        }
+
+        SetData(std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+    }
+
+    void Replayer::SetData(std::vector<uint8_t> data)
+    {
+        if (mActive == this) {
+            throw InputException("Cannot change the recording while replaying.");
+        }
+
+        mReader = EventReader(data);
+        mData = std::move(data);
+    }
+
+    void Replayer::Start(Application& application, bool pinDeltaTime)
+    {
+        if (mActive != nullptr) {
+            throw InputException("A replay is already in progress.");
+        }
+
+        mReader = EventReader(mData);
+        mHasPending = mReader.Read(mPending);
+        if (!mHasPending) {
+            throw InputException("Recording is empty.");
+        }
+
+        mDispatching = false;
+        mPinDeltaTime = pinDeltaTime;
+        mApplication = &application;
+        mPreviousProcessor = application.GetEventProcessor();
+        mFrame = 0;
+        mEventCount = 0;
+        mActive = this;
+
+        application.SetEventProcessor(&Replayer::mProcessEvents);
+    }
+
+    void Replayer::Stop()
+    {
+        if (mActive != this) {
+            return;
+        }
+
+        if (mApplication->GetEventProcessor() == &Replayer::mProcessEvents) {
+            mApplication->SetEventProcessor(mPreviousProcessor);
+        }
+        mDispatching = false;
+        mActive = nullptr;
+    }
+
+    [[nodiscard]] bool Replayer::IsReplaying() const {
+        return mActive == this;
+    }
+
+    [[nodiscard]] bool Replayer::IsDispatching() const {
+        return mDispatching;
+    }
+
+    [[nodiscard]] uint64_t Replayer::GetFrame() const {
+        return mFrame;
+    }
+
+    [[nodiscard]] std::size_t Replayer::GetEventCount() const {
+        return mEventCount;
+    }
+
+    [[nodiscard]] Replayer* Replayer::GetActive() {
+        return mActive;
+    }
+
+    void Replayer::mProcessEvents()
+    {
+        glfwPollEvents();
+
+        if (mActive == nullptr) {
+            return;
+        }
+
+        Replayer& replayer = *mActive;
+        GLFWwindow* window = glfwGetCurrentContext();
+
+        replayer.mDispatching = true;
+        while (replayer.mHasPending && replayer.mPending.mFrame <= replayer.mFrame)
+        {
+            if (replayer.mPending.mType != EventType::FRAME)
+            {
+                replayer.mDispatch(window, replayer.mPending);
+                replayer.mEventCount++;
+            }
+            replayer.mHasPending = replayer.mReader.Read(replayer.mPending);
+        }
+        replayer.mDispatching = false;
+
+        if (replayer.mPinDeltaTime && replayer.mHasPending && replayer.mPending.mType == EventType::FRAME) {
+            replayer.mApplication->mDeltaTimeOverride = replayer.mPending.mReals[0];
+        }
+
+        replayer.mFrame++;
+        if (!replayer.mHasPending) {
+            replayer.Stop();
+        }
+    }
+
+    void Replayer::mDispatch(GLFWwindow* window, const Event& event)
+    {
+        const auto& integers = event.mIntegers;
+        const auto& reals = event.mReals;
+
+        switch (event.mType)
+        {
+            case EventType::MOUSE_BUTTON:
+                Callback::MouseButtonCallback(window, integers[0], integers[1], integers[2]);
+                break;
+            case EventType::CURSOR_POS:
+                Callback::CursorPosCallback(window, reals[0], reals[1]);
+                break;
+            case EventType::CURSOR_ENTER:
+                Callback::CursorEnterCallback(window, integers[0]);
+                break;
+            case EventType::SCROLL:
+                Callback::ScrollCallback(window, reals[0], reals[1]);
+                break;
+            case EventType::KEY:
+                Callback::KeyCallback(window, integers[0], integers[1], integers[2], integers[3]);
+                break;
+            case EventType::CHAR:
+                Callback::CharCallback(window, static_cast<unsigned int>(integers[0]));
+                break;
+            case EventType::CHAR_MODS:
+                Callback::CharModsCallback(window, static_cast<unsigned int>(integers[0]), integers[1]);
+                break;
+            case EventType::DROP:
+            {
+                std::vector<const char*> paths;
+                for (const std::string& path : event.mPaths) {
+                    paths.push_back(path.c_str());
+                }
+                Callback::DropCallback(window, static_cast<int>(paths.size()), paths.data());
+                break;
+            }
+            case EventType::JOYSTICK:
+                Callback::JoystickCallback(integers[0], integers[1]);
+                break;
+            default:
+                break;
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#include "TIMGE/JobSystem.hpp"
+
+#include <algorithm>
+#include <format>
+#include <thread>
+
+namespace TIMGE
+{
+    JobSystemException::JobSystemException(std::string message)
+     : Exception(std::format("JobSystem: {}", message))
+    {}
+
+    thread_local uint32_t JobSystem::mWorkerIndex = 0;
+
+    JobSystem::JobSystem(uint32_t threadCount)
+     : mRunning{true}
+    {
+        if (threadCount == 0) {
+            threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        mThreads.reserve(threadCount - 1);
+        for (uint32_t i = 1; i < threadCount; i++) {
+            mThreads.emplace_back(&JobSystem::mWorkerLoop, this, i);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(mMutex);
+            mRunning = false;
+        }
+        mCondition.notify_all();
+
+        for (auto& thread : mThreads) {
+            thread.join();
+        }
+    }
+
+    void JobSystem::Submit(const Job& job, Counter& counter)
+    {
+        if (!job.mFunction) {
+            throw JobSystemException("Cannot submit a job without a function.");
+        }
+
+        counter.fetch_add(1, std::memory_order_relaxed);
+
+        if (mThreads.empty())
+        {
+            mExecute({ job, &counter });
+            return;
+        }
+
+        {
+            std::lock_guard lock(mMutex);
+            mQueue.push_back({ job, &counter });
+        }
+        mCondition.notify_one();
+    }
+
+    void JobSystem::Wait(const Counter& counter)
+    {
+        while (counter.load(std::memory_order_acquire) != 0)
+        {
+            if (!mTryExecute(counter)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    [[nodiscard]] uint32_t JobSystem::GetThreadCount() const {
+        return static_cast<uint32_t>(mThreads.size()) + 1;
+    }
+
+    [[nodiscard]] uint32_t JobSystem::GetWorkerIndex() {
+        return mWorkerIndex;
+    }
+
+    void JobSystem::mWorkerLoop(uint32_t workerIndex)
+    {
+        mWorkerIndex = workerIndex;
+
+        while (true)
+        {
+            QueuedJob job;
+            {
+                std::unique_lock lock(mMutex);
+                mCondition.wait(lock, [this]{ return !mRunning || !mQueue.empty(); });
+
+                if (!mRunning && mQueue.empty()) {
+                    return;
+                }
+
+                job = mQueue.front();
+                mQueue.pop_front();
+            }
+            mExecute(job);
+        }
+    }
+
+    [[nodiscard]] bool JobSystem::mTryExecute(const Counter& counter)
+    {
+        QueuedJob job;
+        {
+            std::lock_guard lock(mMutex);
+            auto queued = std::find_if(mQueue.begin(), mQueue.end(), [&counter](const QueuedJob& candidate) { return candidate.mCounter == &counter; });
+            if (queued == mQueue.end()) {
+                return false;
+            }
+
+            job = *queued;
+            mQueue.erase(queued);
+        }
+        mExecute(job);
+
+        return true;
+    }
+
+    void JobSystem::mExecute(const QueuedJob& job)
+    {
+        job.mJob.mFunction(job.mJob.mData, mWorkerIndex);
+        job.mCounter->fetch_sub(1, std::memory_order_release);
+    }
+}
@@ -2,18 +2,39 @@
 #include "TIMGE/Utils/Vector.hpp"
 
 #include <algorithm>
+#include <cstdlib>
 #include <format>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include <GLFW/glfw3.h>
 
 namespace TIMGE
 {
+    namespace
+    {
+        [[nodiscard]] Monitor::VideoMode ToVideoMode(const GLFWvidmode& mode)
+        {
+            return {
+                V2ui32{ static_cast<uint32_t>(mode.width), static_cast<uint32_t>(mode.height) },
+                static_cast<uint32_t>(mode.refreshRate),
+                static_cast<uint32_t>(mode.redBits + mode.greenBits + mode.blueBits)
+            };
+        }
+
+        [[nodiscard]] uint64_t GetArea(const V2ui32& size) {
+            return static_cast<uint64_t>(size[V2ui32::WIDTH]) * size[V2ui32::HEIGHT];
+        }
+    }
+
     MonitorException::MonitorException(std::string message)
      : Exception(std::format("Monitor: {}", message))
     {}
 
     std::vector<Monitor> Monitor::mMonitors;
+    std::unordered_map<GLFWmonitor*, std::size_t> Monitor::mIndices;
+    uint64_t Monitor::mGeneration = 0;
 
     bool Monitor::mMonitorsRetrieved = false;
 
@@ -26,7 +47,7 @@ namespace TIMGE
         mRetrievePosition();
         mRetrieveWorkarea();
         mRetrieveName();
-
+        mRetrieveVideoModes();
     }
 
     Monitor::~Monitor() {}
@@ -57,6 +78,10 @@ namespace TIMGE
         return mMonitors[0];
     }
 
+    [[nodiscard]] uint64_t Monitor::GetGeneration() {
+        return mGeneration;
+    }
+
     [[nodiscard]] const V2ui32& Monitor::GetPhysicalSize() const {
         return mPhysicalSize;
     }
@@ -85,6 +110,39 @@ namespace TIMGE
         return mGamma;
     }
 
+    [[nodiscard]] const std::vector<Monitor::VideoMode>& Monitor::GetVideoModes() const {
+        return mVideoModes;
+    }
+
+    [[nodiscard]] const Monitor::VideoMode& Monitor::GetVideoMode() const {
+        return mVideoMode;
+    }
+
+    [[nodiscard]] const Monitor::VideoMode& Monitor::GetBestVideoMode(const V2ui32& size, uint32_t refreshRate) const
+    {
+        if (mVideoModes.empty()) {
+            throw MonitorException(std::format("Monitor \"{}\" reports no video modes.", mName));
+        }
+
+        // Ranked by closeness to the requested size first, then by whether the
+        // refresh rate is a whole multiple of the target so every frame is shown
+        // for the same number of refreshes, then by raw refresh distance.
+        auto rank = [&](const VideoMode& mode) {
+            uint64_t area = GetArea(mode.mSize);
+            uint64_t target = GetArea(size);
+            uint64_t sizeDistance = (area > target ? area - target : target - area)
+                + (mode.mSize[V2ui32::WIDTH] == size[V2ui32::WIDTH] && mode.mSize[V2ui32::HEIGHT] == size[V2ui32::HEIGHT] ? 0 : 1);
+            bool paced = refreshRate != 0 && mode.mRefreshRate != 0 && mode.mRefreshRate % refreshRate == 0;
+            uint32_t refreshDistance = static_cast<uint32_t>(std::abs(static_cast<int64_t>(mode.mRefreshRate) - refreshRate));
+
+            return std::make_tuple(sizeDistance, !paced, refreshDistance, ~mode.mBitDepth);
+        };
+
+        return *std::min_element(mVideoModes.begin(), mVideoModes.end(), [&](const VideoMode& left, const VideoMode& right) {
+            return rank(left) < rank(right);
+        });
+    }
+
 	void Monitor::SetGamma(float gamma) {
         glfwSetGamma(mMonitor, (mGamma = gamma));
     }
@@ -117,30 +175,48 @@ namespace TIMGE
         mName = glfwGetMonitorName(mMonitor);
     }
 
+    void Monitor::mRetrieveVideoModes()
+    {
+        int modeCount = 0;
+        const GLFWvidmode* modes = glfwGetVideoModes(mMonitor, &modeCount);
 
-    void Monitor::mConnect(GLFWmonitor* monitor) {
-        for (auto& _monitor : mMonitors)
-        {
-            if (_monitor.mMonitor == monitor) {
-                return;
-            }
+        mVideoModes.clear();
+        mVideoModes.reserve(static_cast<std::size_t>(std::max(modeCount, 0)));
+        for (int i = 0; i < modeCount; i++) {
+            mVideoModes.push_back(ToVideoMode(modes[i]));
         }
 
-        mMonitors.push_back(static_cast<Monitor>(monitor));
+        std::sort(mVideoModes.begin(), mVideoModes.end(), [](const VideoMode& left, const VideoMode& right) {
+            return std::make_tuple(left.mSize[V2ui32::WIDTH], left.mSize[V2ui32::HEIGHT], left.mRefreshRate, left.mBitDepth)
+                 < std::make_tuple(right.mSize[V2ui32::WIDTH], right.mSize[V2ui32::HEIGHT], right.mRefreshRate, right.mBitDepth);
+        });
+        mVideoModes.erase(std::unique(mVideoModes.begin(), mVideoModes.end()), mVideoModes.end());
+
+        if (const GLFWvidmode* mode = glfwGetVideoMode(mMonitor); mode != nullptr) {
+            mVideoMode = ToVideoMode(*mode);
+        } else if (!mVideoModes.empty()) {
+            mVideoMode = mVideoModes.back();
+        } else {
+            mVideoMode = {};
+        }
     }
 
-    void Monitor::mDisconnect(GLFWmonitor* monitor) {
-        if (auto res = std::find_if(mMonitors.begin(), mMonitors.end(), [monitor](Monitor& m){ return m.mMonitor == monitor; }); res != mMonitors.end()) {
-            mMonitors.erase(res);
+
+    [[nodiscard]] GLFWmonitor* Monitor::mGetMonitor() const
+    {
+        if (mIndices.contains(mMonitor)) {
+            return mMonitor;
         }
+
+        // A disconnected monitor falls back to the primary one, so going
+        // fullscreen still has a target instead of silently staying windowed.
+        return mMonitors.empty() ? nullptr : mMonitors[0].mMonitor;
     }
 
-    [[nodiscard]] GLFWmonitor* Monitor::mGetMonitor() const {
-        for (auto& _monitor : mMonitors)
-        {
-            if (_monitor.mMonitor == mMonitor) {
-                return mMonitor;
-            }
+    [[nodiscard]] const Monitor* Monitor::mFind(GLFWmonitor* monitor)
+    {
+        if (auto it = mIndices.find(monitor); it != mIndices.end()) {
+            return &mMonitors[it->second];
         }
 
         return nullptr;
@@ -154,10 +230,35 @@ namespace TIMGE
         for (int i = 0; i < monitorCount; i++)
         {
             if (monitors[i] == nullptr) {
-                return;
+                break;
             }
 
+            mIndices.emplace(monitors[i], mMonitors.size());
             mMonitors.push_back(monitors[i]);
         }
+
+        mGeneration++;
+    }
+
+    void Monitor::mInvalidate()
+    {
+        // GLFW has already updated its monitor list when the callback fires, so
+        // the cache is rebuilt from it, keeping the gamma set on known monitors.
+        std::unordered_map<GLFWmonitor*, float> gammas;
+        for (const Monitor& monitor : mMonitors) {
+            gammas.emplace(monitor.mMonitor, monitor.mGamma);
+        }
+
+        mMonitors.clear();
+        mIndices.clear();
+        mMonitorsRetrieved = true;
+        mRetrieveMonitors();
+
+        for (Monitor& monitor : mMonitors)
+        {
+            if (auto it = gammas.find(monitor.mMonitor); it != gammas.end()) {
+                monitor.mGamma = it->second;
+            }
+        }
     }
 }
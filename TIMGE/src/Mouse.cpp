@@ -1,6 +1,7 @@
 #include "TIMGE/Mouse.hpp"
 #include "TIMGE/Window.hpp"
 
+#include <algorithm>
 #include <filesystem>
 
 #include <format>
@@ -20,13 +21,22 @@ namespace TIMGE
     Mouse::Mouse(const Info& info, Window& window)
      : 
         mWindow{window},
-        mFlags{}
+        mPosition{},
+        mOffset{},
+        mDelta{},
+        mScroll{},
+        mFlags{},
+        mSkipDelta{false},
+        mHistory{},
+        mHistoryStart{},
+        mHistorySize{},
+        mFrameSamples{}
     {
         for (const auto& path: info.mCursorPaths) {
             AddCursor(path);
         }
-        if (!mCursors.empty()) {
-            glfwSetCursor(window.mGetWindow(), mCursors[0].first);
+        if (!mCursors.IsEmpty()) {
+            glfwSetCursor(window.mGetWindow(), *mCursors.begin());
         }
 
         glfwGetCursorPos(window.mGetWindow(), &mPosition[V2d::X], &mPosition[V2d::Y]);
@@ -34,8 +44,8 @@ namespace TIMGE
 
     Mouse::~Mouse()
     {
-        for (auto& cursor : mCursors) {
-            glfwDestroyCursor(cursor.first);
+        for (GLFWcursor* cursor : mCursors) {
+            glfwDestroyCursor(cursor);
         }
     }
 
@@ -49,22 +59,22 @@ namespace TIMGE
 
     void Mouse::Disable() {
         mFlags |= DISABLED;
-        glfwSetInputMode(mWindow.mGetWindow(), GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+        mSetCursorMode(GLFW_CURSOR_DISABLED);
     }
 
     void Mouse::Hide() {
         mFlags |= HIDDEN;
-        glfwSetInputMode(mWindow.mGetWindow(), GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+        mSetCursorMode(GLFW_CURSOR_HIDDEN);
     }
 
     void Mouse::Capture() {
         mFlags |= CAPTURED;
-        glfwSetInputMode(mWindow.mGetWindow(), GLFW_CURSOR, GLFW_CURSOR_CAPTURED);
+        mSetCursorMode(GLFW_CURSOR_CAPTURED);
     }
 
     void Mouse::Restore() {
         mFlags = 0;
-        glfwSetInputMode(mWindow.mGetWindow(), GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+        mSetCursorMode(GLFW_CURSOR_NORMAL);
     }
 
     void Mouse::RawMotion() {
@@ -72,7 +82,7 @@ namespace TIMGE
         glfwSetInputMode(mWindow.mGetWindow(), GLFW_RAW_MOUSE_MOTION, GetState(RAW_MOTION));
     }
 
-    [[maybe_unused]] Cursor& Mouse::AddCursor(const std::filesystem::path& image)
+    [[maybe_unused]] Cursor Mouse::AddCursor(const std::filesystem::path& image)
     {
         if (!std::filesystem::exists(image)) {
             throw MouseException(std::format("Cursor at \"{}\" doesn't exist!", image.string()));
@@ -85,20 +95,17 @@ namespace TIMGE
             throw MouseException("Something went wrong while loading cursor image!");
         }
 
-        std::pair<GLFWcursor*, Cursor> cursor {
-            glfwCreateCursor(&icon, 0, 0),
-            mCursors.size()
-        };
+        GLFWcursor* cursor = glfwCreateCursor(&icon, 0, 0);
+        stbi_image_free(icon.pixels);
 
-        if (!cursor.first) {
+        if (!cursor) {
             throw MouseException("Something went wrong while creating cursor!");
         }
 
-        mCursors.push_back(cursor);
-        return mCursors.back().second;
+        return mCursors.Add(cursor);
     }
 
-    [[maybe_unused]] Cursor& Mouse::AddCursor(StandardCursor shape)
+    [[maybe_unused]] Cursor Mouse::AddCursor(StandardCursor shape)
     {
         static std::unordered_map<StandardCursor, std::string> shapeNames {
             { StandardCursor::ARROW_CURSOR, "Arrow" },
@@ -113,40 +120,44 @@ namespace TIMGE
             { StandardCursor::NOT_ALLOWED_CURSOR, "Not Allowed" }
         };
 
-        std::pair<GLFWcursor*, Cursor> cursor
-        {
-            glfwCreateStandardCursor(static_cast<int>(shape)),
-            mCursors.size()
-        };
-        if (!cursor.first) {
+        GLFWcursor* cursor = glfwCreateStandardCursor(static_cast<int>(shape));
+        if (!cursor) {
             throw MouseException(std::format("Your OS does not support \"{}\" cursor.", shapeNames[shape]));
         }
-        mCursors.push_back(cursor);
-        return mCursors.back().second;
+        return mCursors.Add(cursor);
     }
 
     void Mouse::DeleteCursor(const Cursor& cursor)
     {
-        if (mCursors.empty()) {
+        GLFWcursor** glfwCursor = mCursors.TryGet(cursor);
+        if (!glfwCursor) {
             throw MouseException("Cannot delete a non-existing cursor.");
         }
-        glfwDestroyCursor(mCursors[cursor.mID].first);
-        if (cursor.mID != mCursors.size() - 1) {
-            for (int i = cursor.mID + 1; i < mCursors.size(); i++) {
-                mCursors[i].second.mID -= 1;
-            }
-        }
-        mCursors.erase(mCursors.begin() + cursor.mID);
+        glfwDestroyCursor(*glfwCursor);
+        mCursors.Remove(cursor);
     }
 
-    void Mouse::SetCursor(const Cursor& cursor) {
-        glfwSetCursor(mWindow.mGetWindow(), mCursors[cursor.mID].first);
+    void Mouse::SetCursor(const Cursor& cursor)
+    {
+        GLFWcursor** glfwCursor = mCursors.TryGet(cursor);
+        if (!glfwCursor) {
+            throw MouseException("Cannot set a non-existing cursor.");
+        }
+        glfwSetCursor(mWindow.mGetWindow(), *glfwCursor);
     }
 
     void Mouse::ResetCursor() {
         glfwSetCursor(mWindow.mGetWindow(), nullptr);
     }
 
+    void Mouse::SetHistoryCapacity(std::size_t capacity)
+    {
+        mHistory.assign(capacity, {});
+        mHistoryStart = 0;
+        mHistorySize = 0;
+        mFrameSamples = 0;
+    }
+
     [[nodiscard]] const V2d& Mouse::GetPosition() const {
         return mPosition;
     }
@@ -155,16 +166,97 @@ namespace TIMGE
         return mOffset;
     }
 
+    [[nodiscard]] const V2d& Mouse::GetDelta() const {
+        return mDelta;
+    }
+
+    [[nodiscard]] const V2d& Mouse::GetScroll() const {
+        return mScroll;
+    }
+
+    [[nodiscard]] std::size_t Mouse::GetHistoryCapacity() const {
+        return mHistory.size();
+    }
+
+    [[nodiscard]] std::size_t Mouse::GetHistorySize() const {
+        return mHistorySize;
+    }
+
+    [[nodiscard]] std::size_t Mouse::GetFrameSampleCount() const {
+        return mFrameSamples;
+    }
+
+    [[nodiscard]] const Mouse::Sample& Mouse::GetSample(std::size_t index) const
+    {
+        if (index >= mHistorySize) {
+            throw MouseException(std::format("Sample {} is out of range, history holds {}.", index, mHistorySize));
+        }
+        return mHistory[(mHistoryStart + index) % mHistory.size()];
+    }
+
     [[nodiscard]] bool Mouse::GetState(FLAGS flags) const {
         return mFlags & flags;
     }
 
-    [[nodiscard]] std::vector<Cursor*> Mouse::GetCursors()
+    [[nodiscard]] std::vector<Cursor> Mouse::GetCursors() const
     {
-        std::vector<Cursor*> result;
-        for (auto& cursor: mCursors) {
-            result.emplace_back(&cursor.second);
+        std::vector<Cursor> result;
+        result.reserve(mCursors.GetSize());
+        for (std::size_t i = 0; i < mCursors.GetSize(); i++) {
+            result.push_back(mCursors.GetHandle(i));
         }
         return result;
     }
+
+    void Mouse::mNewFrame()
+    {
+        mDelta = {};
+        mScroll = {};
+        mFrameSamples = 0;
+    }
+
+    void Mouse::mMove(const V2d& position)
+    {
+        V2d delta = mSkipDelta ? V2d{} : position - mPosition;
+
+        mPosition = position;
+        mSkipDelta = false;
+        mDelta += delta;
+
+        if (mHistory.empty()) {
+            return;
+        }
+
+        std::size_t index = (mHistoryStart + mHistorySize) % mHistory.size();
+        if (mHistorySize == mHistory.size()) {
+            mHistoryStart = (mHistoryStart + 1) % mHistory.size();
+        } else {
+            mHistorySize++;
+        }
+
+        mHistory[index] = { position, delta, glfwGetTime() };
+        mFrameSamples = std::min(mFrameSamples + 1, mHistorySize);
+    }
+
+    void Mouse::mEnter(bool entered)
+    {
+        // Nothing is reported while the cursor is outside the window, so the
+        // last known position is stale by the time it comes back.
+        if (entered) {
+            mSkipDelta = true;
+        }
+    }
+
+    void Mouse::mAddScroll(const V2d& offset)
+    {
+        mOffset = offset;
+        mScroll += offset;
+    }
+
+    void Mouse::mSetCursorMode(int mode)
+    {
+        glfwSetInputMode(mWindow.mGetWindow(), GLFW_CURSOR, mode);
+        glfwGetCursorPos(mWindow.mGetWindow(), &mPosition[V2d::X], &mPosition[V2d::Y]);
+        mSkipDelta = true;
+    }
 }
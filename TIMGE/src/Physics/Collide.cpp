@@ -0,0 +1,308 @@
+#include "TIMGE/Physics/Collide.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace TIMGE::Physics
+{
+    namespace
+    {
+        constexpr float LINEAR_SLOP = 0.005f;
+
+        struct ClipVertex
+        {
+            V2f mPosition;
+            uint32_t mFeature;
+        };
+
+        [[nodiscard]] uint32_t MakeFeature(uint32_t referenceEdge, uint32_t incidentVertex, uint32_t clip) {
+            return referenceEdge | (incidentVertex << 8) | (clip << 16);
+        }
+
+        [[nodiscard]] float Length(const V2f& vector) {
+            return std::sqrt(Dot(vector, vector));
+        }
+
+        void TransformPolygon(const Shape& shape, const Transform& transform, V2f* vertices, V2f* normals)
+        {
+            for (uint32_t i = 0; i < shape.GetVertexCount(); i++)
+            {
+                vertices[i] = transform.Apply(shape.GetVertex(i));
+                normals[i] = transform.Rotate(shape.GetNormal(i));
+            }
+        }
+
+        [[nodiscard]] float FindMaxSeparation(uint32_t& edge, const V2f* vertices1, const V2f* normals1, uint32_t count1, const V2f* vertices2, uint32_t count2)
+        {
+            float maxSeparation = -std::numeric_limits<float>::max();
+            edge = 0;
+
+            for (uint32_t i = 0; i < count1; i++)
+            {
+                float separation = std::numeric_limits<float>::max();
+                for (uint32_t j = 0; j < count2; j++) {
+                    separation = std::min(separation, Dot(normals1[i], vertices2[j] - vertices1[i]));
+                }
+
+                if (separation > maxSeparation)
+                {
+                    maxSeparation = separation;
+                    edge = i;
+                }
+            }
+
+            return maxSeparation;
+        }
+
+        [[nodiscard]] uint32_t ClipSegment(ClipVertex* out, const ClipVertex* in, const V2f& normal, float offset, uint32_t referenceVertex)
+        {
+            uint32_t count = 0;
+
+            float distance0 = Dot(normal, in[0].mPosition) - offset;
+            float distance1 = Dot(normal, in[1].mPosition) - offset;
+
+            if (distance0 <= 0.0f) { out[count++] = in[0]; }
+            if (distance1 <= 0.0f) { out[count++] = in[1]; }
+
+            if (distance0 * distance1 < 0.0f)
+            {
+                float interpolation = distance0 / (distance0 - distance1);
+                out[count].mPosition = in[0].mPosition + (in[1].mPosition - in[0].mPosition) * interpolation;
+                out[count].mFeature = (in[0].mFeature & 0xFFFFu) | ((referenceVertex + 1) << 16);
+                count++;
+            }
+
+            return count;
+        }
+
+        [[nodiscard]] Manifold CollideCircles(const Shape& shapeA, const Transform& transformA, const Shape& shapeB, const Transform& transformB)
+        {
+            Manifold manifold{};
+
+            V2f delta = transformB.mPosition - transformA.mPosition;
+            float radius = shapeA.GetRadius() + shapeB.GetRadius();
+            float distanceSquared = Dot(delta, delta);
+
+            if (distanceSquared > radius * radius) {
+                return manifold;
+            }
+
+            float distance = std::sqrt(distanceSquared);
+            manifold.mNormal = distance > 1.0E-6f ? delta * (1.0f / distance) : V2f{ 1.0f, 0.0f };
+
+            float separation = distance - radius;
+            manifold.mPoints[0].mPosition = transformA.mPosition + manifold.mNormal * (shapeA.GetRadius() + 0.5f * separation);
+            manifold.mPoints[0].mSeparation = separation;
+            manifold.mPoints[0].mFeature = 0;
+            manifold.mPointCount = 1;
+
+            return manifold;
+        }
+
+        [[nodiscard]] Manifold CollidePolygonCircle(const Shape& polygon, const Transform& transformA, const Shape& circle, const Transform& transformB)
+        {
+            Manifold manifold{};
+
+            V2f center = transformA.InverseApply(transformB.mPosition);
+            float radius = circle.GetRadius();
+            uint32_t count = polygon.GetVertexCount();
+
+            uint32_t normalIndex = 0;
+            float separation = -std::numeric_limits<float>::max();
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                float s = Dot(polygon.GetNormal(i), center - polygon.GetVertex(i));
+                if (s > radius) {
+                    return manifold;
+                }
+                if (s > separation)
+                {
+                    separation = s;
+                    normalIndex = i;
+                }
+            }
+
+            const V2f& v1 = polygon.GetVertex(normalIndex);
+            const V2f& v2 = polygon.GetVertex((normalIndex + 1) % count);
+
+            V2f closest;
+            V2f normal;
+
+            if (separation < 1.0E-6f)
+            {
+                normal = polygon.GetNormal(normalIndex);
+                closest = center - normal * separation;
+            }
+            else if (Dot(center - v1, v2 - v1) <= 0.0f || Dot(center - v2, v1 - v2) <= 0.0f)
+            {
+                closest = Dot(center - v1, v2 - v1) <= 0.0f ? v1 : v2;
+
+                V2f delta = center - closest;
+                float distanceSquared = Dot(delta, delta);
+                if (distanceSquared > radius * radius) {
+                    return manifold;
+                }
+
+                float distance = std::sqrt(distanceSquared);
+                normal = distance > 1.0E-6f ? delta * (1.0f / distance) : polygon.GetNormal(normalIndex);
+            }
+            else
+            {
+                normal = polygon.GetNormal(normalIndex);
+                closest = center - normal * separation;
+            }
+
+            float pointSeparation = Dot(center - closest, normal) - radius;
+
+            manifold.mNormal = transformA.Rotate(normal);
+            manifold.mPoints[0].mPosition = transformA.Apply(closest + normal * (0.5f * pointSeparation));
+            manifold.mPoints[0].mSeparation = pointSeparation;
+            manifold.mPoints[0].mFeature = normalIndex;
+            manifold.mPointCount = 1;
+
+            return manifold;
+        }
+
+        [[nodiscard]] Manifold CollidePolygons(const Shape& shapeA, const Transform& transformA, const Shape& shapeB, const Transform& transformB)
+        {
+            Manifold manifold{};
+
+            V2f verticesA[MAX_POLYGON_VERTICES];
+            V2f normalsA[MAX_POLYGON_VERTICES];
+            V2f verticesB[MAX_POLYGON_VERTICES];
+            V2f normalsB[MAX_POLYGON_VERTICES];
+
+            uint32_t countA = shapeA.GetVertexCount();
+            uint32_t countB = shapeB.GetVertexCount();
+
+            TransformPolygon(shapeA, transformA, verticesA, normalsA);
+            TransformPolygon(shapeB, transformB, verticesB, normalsB);
+
+            uint32_t edgeA;
+            float separationA = FindMaxSeparation(edgeA, verticesA, normalsA, countA, verticesB, countB);
+            if (separationA > 0.0f) {
+                return manifold;
+            }
+
+            uint32_t edgeB;
+            float separationB = FindMaxSeparation(edgeB, verticesB, normalsB, countB, verticesA, countA);
+            if (separationB > 0.0f) {
+                return manifold;
+            }
+
+            bool flip = separationB > separationA + 0.1f * LINEAR_SLOP;
+
+            const V2f* referenceVertices = flip ? verticesB : verticesA;
+            const V2f* referenceNormals = flip ? normalsB : normalsA;
+            uint32_t referenceCount = flip ? countB : countA;
+            uint32_t referenceEdge = flip ? edgeB : edgeA;
+
+            const V2f* incidentVertices = flip ? verticesA : verticesB;
+            const V2f* incidentNormals = flip ? normalsA : normalsB;
+            uint32_t incidentCount = flip ? countA : countB;
+
+            uint32_t incidentEdge = 0;
+            float minDot = std::numeric_limits<float>::max();
+            for (uint32_t i = 0; i < incidentCount; i++)
+            {
+                float dot = Dot(referenceNormals[referenceEdge], incidentNormals[i]);
+                if (dot < minDot)
+                {
+                    minDot = dot;
+                    incidentEdge = i;
+                }
+            }
+
+            uint32_t incidentNext = (incidentEdge + 1) % incidentCount;
+            ClipVertex incident[2] = {
+                { incidentVertices[incidentEdge], MakeFeature(referenceEdge, incidentEdge, 0) },
+                { incidentVertices[incidentNext], MakeFeature(referenceEdge, incidentNext, 0) }
+            };
+
+            uint32_t referenceNext = (referenceEdge + 1) % referenceCount;
+            const V2f& v11 = referenceVertices[referenceEdge];
+            const V2f& v12 = referenceVertices[referenceNext];
+
+            V2f tangent = v12 - v11;
+            tangent *= 1.0f / Length(tangent);
+            V2f normal{ tangent[V2f::Y], -tangent[V2f::X] };
+
+            float frontOffset = Dot(normal, v11);
+            float sideOffset1 = -Dot(tangent, v11);
+            float sideOffset2 = Dot(tangent, v12);
+
+            ClipVertex clipped1[2];
+            ClipVertex clipped2[2];
+
+            if (ClipSegment(clipped1, incident, tangent * -1.0f, sideOffset1, referenceEdge) < 2) {
+                return manifold;
+            }
+            if (ClipSegment(clipped2, clipped1, tangent, sideOffset2, referenceNext) < 2) {
+                return manifold;
+            }
+
+            manifold.mNormal = flip ? normal * -1.0f : normal;
+
+            for (const ClipVertex& vertex : clipped2)
+            {
+                float separation = Dot(normal, vertex.mPosition) - frontOffset;
+                if (separation > 0.0f) {
+                    continue;
+                }
+
+                ManifoldPoint& point = manifold.mPoints[manifold.mPointCount++];
+                point.mPosition = vertex.mPosition - normal * (0.5f * separation);
+                point.mSeparation = separation;
+                point.mFeature = vertex.mFeature | (flip ? 1u << 24 : 0u);
+            }
+
+            return manifold;
+        }
+    }
+
+    [[nodiscard]] Manifold Collide(const Shape& shapeA, const Transform& transformA, const Shape& shapeB, const Transform& transformB)
+    {
+        bool circleA = shapeA.GetType() == Shape::Type::CIRCLE;
+        bool circleB = shapeB.GetType() == Shape::Type::CIRCLE;
+
+        if (circleA && circleB) {
+            return CollideCircles(shapeA, transformA, shapeB, transformB);
+        }
+        if (!circleA && circleB) {
+            return CollidePolygonCircle(shapeA, transformA, shapeB, transformB);
+        }
+        if (circleA && !circleB)
+        {
+            Manifold manifold = CollidePolygonCircle(shapeB, transformB, shapeA, transformA);
+            manifold.mNormal *= -1.0f;
+            return manifold;
+        }
+
+        return CollidePolygons(shapeA, transformA, shapeB, transformB);
+    }
+
+    [[nodiscard]] Collision::AABB ComputeAABB(const Shape& shape, const Transform& transform)
+    {
+        if (shape.GetType() == Shape::Type::CIRCLE)
+        {
+            float radius = shape.GetRadius();
+            return {
+                { transform.mPosition[V2f::X] - radius, transform.mPosition[V2f::Y] - radius },
+                { transform.mPosition[V2f::X] + radius, transform.mPosition[V2f::Y] + radius }
+            };
+        }
+
+        V2f first = transform.Apply(shape.GetVertex(0));
+        Collision::AABB bounds{ first, first };
+
+        for (uint32_t i = 1; i < shape.GetVertexCount(); i++)
+        {
+            V2f vertex = transform.Apply(shape.GetVertex(i));
+            bounds = bounds.Merge({ vertex, vertex });
+        }
+
+        return bounds;
+    }
+}
@@ -0,0 +1,137 @@
+#include "TIMGE/Physics/Shape.hpp"
+
+#include <cmath>
+#include <format>
+#include <numbers>
+
+namespace TIMGE::Physics
+{
+    PhysicsException::PhysicsException(std::string message)
+     : Exception(std::format("Physics: {}", message))
+    {}
+
+    Shape::Shape(Type type)
+     : mType{type},
+       mRadius{0.0f},
+       mVertexCount{0}
+    {}
+
+    [[nodiscard]] Shape Shape::Circle(float radius)
+    {
+        if (!(radius > 0.0f)) {
+            throw PhysicsException("Circle radius must be positive.");
+        }
+
+        Shape shape(Type::CIRCLE);
+        shape.mRadius = radius;
+
+        return shape;
+    }
+
+    [[nodiscard]] Shape Shape::Box(float halfWidth, float halfHeight)
+    {
+        std::array<V2f, 4> vertices = {
+            V2f{ -halfWidth, -halfHeight },
+            V2f{ halfWidth, -halfHeight },
+            V2f{ halfWidth, halfHeight },
+            V2f{ -halfWidth, halfHeight }
+        };
+
+        return Polygon(vertices);
+    }
+
+    [[nodiscard]] Shape Shape::Polygon(std::span<const V2f> vertices)
+    {
+        if (vertices.size() < 3 || vertices.size() > MAX_POLYGON_VERTICES) {
+            throw PhysicsException(std::format("Polygons need between 3 and {} vertices.", MAX_POLYGON_VERTICES));
+        }
+
+        Shape shape(Type::POLYGON);
+        shape.mVertexCount = static_cast<uint32_t>(vertices.size());
+
+        for (uint32_t i = 0; i < shape.mVertexCount; i++)
+        {
+            const V2f& current = vertices[i];
+            const V2f& next = vertices[(i + 1) % shape.mVertexCount];
+            V2f edge = next - current;
+
+            float length = std::sqrt(edge[V2f::X] * edge[V2f::X] + edge[V2f::Y] * edge[V2f::Y]);
+            if (length <= 1.0E-6f) {
+                throw PhysicsException("Polygon has a degenerate edge.");
+            }
+
+            shape.mVertices[i] = current;
+            shape.mNormals[i] = { edge[V2f::Y] / length, -edge[V2f::X] / length };
+        }
+
+        for (uint32_t i = 0; i < shape.mVertexCount; i++)
+        {
+            const V2f& edge = shape.mNormals[i];
+            const V2f& nextEdge = shape.mNormals[(i + 1) % shape.mVertexCount];
+            if (edge[V2f::X] * nextEdge[V2f::Y] - edge[V2f::Y] * nextEdge[V2f::X] <= 0.0f) {
+                throw PhysicsException("Polygon must be convex with counter-clockwise winding.");
+            }
+        }
+
+        return shape;
+    }
+
+    [[nodiscard]] Shape::Type Shape::GetType() const {
+        return mType;
+    }
+
+    [[nodiscard]] float Shape::GetRadius() const {
+        return mRadius;
+    }
+
+    [[nodiscard]] uint32_t Shape::GetVertexCount() const {
+        return mVertexCount;
+    }
+
+    [[nodiscard]] const V2f& Shape::GetVertex(uint32_t index) const {
+        return mVertices[index];
+    }
+
+    [[nodiscard]] const V2f& Shape::GetNormal(uint32_t index) const {
+        return mNormals[index];
+    }
+
+    [[nodiscard]] MassData Shape::ComputeMass(float density) const
+    {
+        if (mType == Type::CIRCLE)
+        {
+            float mass = density * std::numbers::pi_v<float> * mRadius * mRadius;
+            return { mass, 0.5f * mass * mRadius * mRadius, V2f{} };
+        }
+
+        float area = 0.0f;
+        float inertia = 0.0f;
+        float centerX = 0.0f;
+        float centerY = 0.0f;
+
+        for (uint32_t i = 0; i < mVertexCount; i++)
+        {
+            const V2f& a = mVertices[i];
+            const V2f& b = mVertices[(i + 1) % mVertexCount];
+
+            float cross = a[V2f::X] * b[V2f::Y] - a[V2f::Y] * b[V2f::X];
+            float triangleArea = 0.5f * cross;
+
+            area += triangleArea;
+            centerX += triangleArea * (a[V2f::X] + b[V2f::X]) / 3.0f;
+            centerY += triangleArea * (a[V2f::Y] + b[V2f::Y]) / 3.0f;
+
+            float intX = a[V2f::X] * a[V2f::X] + b[V2f::X] * a[V2f::X] + b[V2f::X] * b[V2f::X];
+            float intY = a[V2f::Y] * a[V2f::Y] + b[V2f::Y] * a[V2f::Y] + b[V2f::Y] * b[V2f::Y];
+            inertia += (0.25f / 3.0f) * cross * (intX + intY);
+        }
+
+        centerX /= area;
+        centerY /= area;
+
+        float mass = density * area;
+        float centerInertia = density * inertia - mass * (centerX * centerX + centerY * centerY);
+
+        return { mass, centerInertia, V2f{ centerX, centerY } };
+    }
+}
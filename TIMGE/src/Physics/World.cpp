@@ -0,0 +1,760 @@
+#include "TIMGE/Physics/World.hpp"
+#include "TIMGE/Utils/SIMD.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace TIMGE::Physics
+{
+    namespace
+    {
+        constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+        constexpr float LINEAR_SLOP = 0.005f;
+        constexpr float BAUMGARTE = 0.2f;
+        constexpr float RESTITUTION_THRESHOLD = 1.0f;
+        constexpr float AABB_MARGIN = 0.1f;
+        constexpr uint32_t BATCH_SEARCH_WINDOW = 16;
+
+        [[nodiscard]] uint32_t FindRoot(std::vector<uint32_t>& parents, uint32_t index)
+        {
+            while (parents[index] != index)
+            {
+                parents[index] = parents[parents[index]];
+                index = parents[index];
+            }
+
+            return index;
+        }
+
+        [[nodiscard]] Float4 Gather(const std::vector<float>& values, const uint32_t* indices) {
+            return { values[indices[0]], values[indices[1]], values[indices[2]], values[indices[3]] };
+        }
+
+        void Scatter(std::vector<float>& values, const uint32_t* indices, const Float4& value)
+        {
+            float lanes[Float4::WIDTH];
+            value.Store(lanes);
+
+            for (uint32_t lane = 0; lane < Float4::WIDTH; lane++) {
+                values[indices[lane]] = lanes[lane];
+            }
+        }
+    }
+
+    World::World(const V2f& gravity)
+     : mBroadphase{AABB_MARGIN},
+       mGravity{gravity},
+       mIterations{8}
+    {}
+
+    [[maybe_unused]] Body World::CreateBody(const BodyInfo& info)
+    {
+        MassData mass = info.mShape.ComputeMass(info.mDensity);
+        bool dynamic = info.mType == BodyType::DYNAMIC;
+
+        if (dynamic && !(mass.mMass > 0.0f)) {
+            throw PhysicsException("Dynamic bodies need a positive density.");
+        }
+
+        Transform transform{ info.mPosition, std::cos(info.mAngle), std::sin(info.mAngle) };
+        V2f center = transform.Apply(mass.mCenter);
+
+        uint32_t index = static_cast<uint32_t>(mBodies.mType.size());
+        Collision::Proxy proxy = mBroadphase.CreateProxy(ComputeAABB(info.mShape, transform), index);
+        Body body = mBodyRecords.Add(BodyRecord{ proxy });
+
+        mBodies.mType.push_back(info.mType);
+        mBodies.mShape.push_back(info.mShape);
+        mBodies.mCenterX.push_back(center[V2f::X]);
+        mBodies.mCenterY.push_back(center[V2f::Y]);
+        mBodies.mAngle.push_back(info.mAngle);
+        mBodies.mLocalCenterX.push_back(mass.mCenter[V2f::X]);
+        mBodies.mLocalCenterY.push_back(mass.mCenter[V2f::Y]);
+        mBodies.mVelocityX.push_back(info.mType == BodyType::STATIC ? 0.0f : info.mVelocity[V2f::X]);
+        mBodies.mVelocityY.push_back(info.mType == BodyType::STATIC ? 0.0f : info.mVelocity[V2f::Y]);
+        mBodies.mAngularVelocity.push_back(info.mType == BodyType::STATIC ? 0.0f : info.mAngularVelocity);
+        mBodies.mForceX.push_back(0.0f);
+        mBodies.mForceY.push_back(0.0f);
+        mBodies.mTorque.push_back(0.0f);
+        mBodies.mInverseMass.push_back(dynamic ? 1.0f / mass.mMass : 0.0f);
+        mBodies.mInverseInertia.push_back(dynamic && mass.mInertia > 0.0f ? 1.0f / mass.mInertia : 0.0f);
+        mBodies.mFriction.push_back(info.mFriction);
+        mBodies.mRestitution.push_back(info.mRestitution);
+
+        return body;
+    }
+
+    void World::DestroyBody(Body body)
+    {
+        uint32_t index = mGetIndex(body);
+        uint32_t last = static_cast<uint32_t>(mBodies.mType.size() - 1);
+
+        mBroadphase.DestroyProxy(mBodyRecords.Get(body).mProxy);
+        mBodyRecords.Remove(body);
+
+        auto swapRemove = [index, last](auto& values)
+        {
+            if (index != last) {
+                values[index] = std::move(values[last]);
+            }
+            values.pop_back();
+        };
+
+        swapRemove(mBodies.mType);
+        swapRemove(mBodies.mShape);
+        swapRemove(mBodies.mCenterX);
+        swapRemove(mBodies.mCenterY);
+        swapRemove(mBodies.mAngle);
+        swapRemove(mBodies.mLocalCenterX);
+        swapRemove(mBodies.mLocalCenterY);
+        swapRemove(mBodies.mVelocityX);
+        swapRemove(mBodies.mVelocityY);
+        swapRemove(mBodies.mAngularVelocity);
+        swapRemove(mBodies.mForceX);
+        swapRemove(mBodies.mForceY);
+        swapRemove(mBodies.mTorque);
+        swapRemove(mBodies.mInverseMass);
+        swapRemove(mBodies.mInverseInertia);
+        swapRemove(mBodies.mFriction);
+        swapRemove(mBodies.mRestitution);
+
+        if (index != last) {
+            mBroadphase.SetUserData(mBodyRecords.begin()[index].mProxy, index);
+        }
+
+        uint64_t slot = body.GetIndex();
+        std::erase_if(mCache, [slot](const CachedContact& cached) {
+            return (cached.mKey >> 32) == slot || (cached.mKey & 0xFFFFFFFFu) == slot;
+        });
+    }
+
+    void World::Clear()
+    {
+        while (!mBodyRecords.IsEmpty()) {
+            DestroyBody(mBodyRecords.GetHandle(mBodyRecords.GetSize() - 1));
+        }
+
+        mContacts.clear();
+        mCache.clear();
+        mIslands.clear();
+    }
+
+    void World::Step(float timestep, JobSystem& jobSystem)
+    {
+        if (!(timestep > 0.0f)) {
+            throw PhysicsException("Timestep must be positive.");
+        }
+
+        mIntegrateVelocities(timestep);
+        mUpdateBroadphase();
+        mFindContacts(jobSystem);
+        mBuildIslands();
+
+        mScratch.resize(jobSystem.GetThreadCount());
+        jobSystem.ParallelFor(static_cast<uint32_t>(mIslands.size()), 1, [this, timestep](uint32_t begin, uint32_t end, uint32_t workerIndex) {
+            for (uint32_t i = begin; i < end; i++) {
+                mSolveIsland(mIslands[i], mScratch[workerIndex], timestep);
+            }
+        });
+
+        mIntegratePositions(timestep);
+        mStoreImpulses();
+    }
+
+    void World::SetGravity(const V2f& gravity) {
+        mGravity = gravity;
+    }
+
+    void World::SetIterations(uint32_t iterations) {
+        mIterations = std::max(iterations, 1u);
+    }
+
+    void World::SetTransform(Body body, const V2f& position, float angle)
+    {
+        uint32_t index = mGetIndex(body);
+        Transform transform{ position, std::cos(angle), std::sin(angle) };
+        V2f center = transform.Apply({ mBodies.mLocalCenterX[index], mBodies.mLocalCenterY[index] });
+
+        mBodies.mCenterX[index] = center[V2f::X];
+        mBodies.mCenterY[index] = center[V2f::Y];
+        mBodies.mAngle[index] = angle;
+
+        mBroadphase.MoveProxy(mBodyRecords.Get(body).mProxy, ComputeAABB(mBodies.mShape[index], transform));
+    }
+
+    void World::SetVelocity(Body body, const V2f& velocity)
+    {
+        uint32_t index = mGetIndex(body);
+        if (mBodies.mType[index] == BodyType::STATIC) {
+            return;
+        }
+
+        mBodies.mVelocityX[index] = velocity[V2f::X];
+        mBodies.mVelocityY[index] = velocity[V2f::Y];
+    }
+
+    void World::SetAngularVelocity(Body body, float angularVelocity)
+    {
+        uint32_t index = mGetIndex(body);
+        if (mBodies.mType[index] == BodyType::STATIC) {
+            return;
+        }
+
+        mBodies.mAngularVelocity[index] = angularVelocity;
+    }
+
+    void World::ApplyForce(Body body, const V2f& force)
+    {
+        uint32_t index = mGetIndex(body);
+        mBodies.mForceX[index] += force[V2f::X];
+        mBodies.mForceY[index] += force[V2f::Y];
+    }
+
+    void World::ApplyTorque(Body body, float torque) {
+        mBodies.mTorque[mGetIndex(body)] += torque;
+    }
+
+    void World::ApplyImpulse(Body body, const V2f& impulse)
+    {
+        uint32_t index = mGetIndex(body);
+        mBodies.mVelocityX[index] += mBodies.mInverseMass[index] * impulse[V2f::X];
+        mBodies.mVelocityY[index] += mBodies.mInverseMass[index] * impulse[V2f::Y];
+    }
+
+    [[nodiscard]] bool World::IsAlive(Body body) const {
+        return mBodyRecords.Contains(body);
+    }
+
+    [[nodiscard]] BodyType World::GetType(Body body) const {
+        return mBodies.mType[mGetIndex(body)];
+    }
+
+    [[nodiscard]] const Shape& World::GetShape(Body body) const {
+        return mBodies.mShape[mGetIndex(body)];
+    }
+
+    [[nodiscard]] V2f World::GetPosition(Body body) const {
+        return mGetTransform(mGetIndex(body)).mPosition;
+    }
+
+    [[nodiscard]] float World::GetAngle(Body body) const {
+        return mBodies.mAngle[mGetIndex(body)];
+    }
+
+    [[nodiscard]] V2f World::GetVelocity(Body body) const
+    {
+        uint32_t index = mGetIndex(body);
+        return { mBodies.mVelocityX[index], mBodies.mVelocityY[index] };
+    }
+
+    [[nodiscard]] float World::GetAngularVelocity(Body body) const {
+        return mBodies.mAngularVelocity[mGetIndex(body)];
+    }
+
+    [[nodiscard]] const V2f& World::GetGravity() const {
+        return mGravity;
+    }
+
+    [[nodiscard]] uint32_t World::GetIterations() const {
+        return mIterations;
+    }
+
+    [[nodiscard]] std::size_t World::GetBodyCount() const {
+        return mBodies.mType.size();
+    }
+
+    [[nodiscard]] std::size_t World::GetContactCount() const {
+        return mContacts.size();
+    }
+
+    [[nodiscard]] std::size_t World::GetIslandCount() const {
+        return mIslands.size();
+    }
+
+    [[nodiscard]] uint32_t World::mGetIndex(Body body) const
+    {
+        if (!mBodyRecords.Contains(body)) {
+            throw PhysicsException("Body is invalid or has been destroyed.");
+        }
+
+        return static_cast<uint32_t>(mBodyRecords.GetDenseIndex(body));
+    }
+
+    [[nodiscard]] Transform World::mGetTransform(uint32_t index) const
+    {
+        float angle = mBodies.mAngle[index];
+        Transform transform{ V2f{}, std::cos(angle), std::sin(angle) };
+
+        V2f offset = transform.Rotate({ mBodies.mLocalCenterX[index], mBodies.mLocalCenterY[index] });
+        transform.mPosition = V2f{ mBodies.mCenterX[index], mBodies.mCenterY[index] } - offset;
+
+        return transform;
+    }
+
+    [[nodiscard]] uint64_t World::mGetPairKey(uint32_t first, uint32_t second) const
+    {
+        uint64_t slotFirst = mBodyRecords.GetHandle(first).GetIndex();
+        uint64_t slotSecond = mBodyRecords.GetHandle(second).GetIndex();
+
+        return (std::min(slotFirst, slotSecond) << 32) | std::max(slotFirst, slotSecond);
+    }
+
+    void World::mIntegrateVelocities(float timestep)
+    {
+        for (std::size_t i = 0; i < mBodies.mType.size(); i++)
+        {
+            if (mBodies.mType[i] == BodyType::DYNAMIC)
+            {
+                float inverseMass = mBodies.mInverseMass[i];
+                mBodies.mVelocityX[i] += timestep * (mGravity[V2f::X] + inverseMass * mBodies.mForceX[i]);
+                mBodies.mVelocityY[i] += timestep * (mGravity[V2f::Y] + inverseMass * mBodies.mForceY[i]);
+                mBodies.mAngularVelocity[i] += timestep * mBodies.mInverseInertia[i] * mBodies.mTorque[i];
+            }
+
+            mBodies.mForceX[i] = 0.0f;
+            mBodies.mForceY[i] = 0.0f;
+            mBodies.mTorque[i] = 0.0f;
+        }
+    }
+
+    void World::mUpdateBroadphase()
+    {
+        const BodyRecord* records = mBodyRecords.begin();
+
+        for (uint32_t i = 0; i < mBodies.mType.size(); i++) {
+            if (mBodies.mType[i] != BodyType::STATIC) {
+                mBroadphase.MoveProxy(records[i].mProxy, ComputeAABB(mBodies.mShape[i], mGetTransform(i)));
+            }
+        }
+    }
+
+    void World::mFindContacts(JobSystem& jobSystem)
+    {
+        mPairs.clear();
+        mBroadphase.FindPairs(mPairs);
+
+        std::erase_if(mPairs, [this](const Collision::Pair& pair) {
+            return mBodies.mType[pair.mFirst] != BodyType::DYNAMIC && mBodies.mType[pair.mSecond] != BodyType::DYNAMIC;
+        });
+
+        mContacts.resize(mPairs.size());
+        for (std::size_t i = 0; i < mPairs.size(); i++)
+        {
+            uint32_t first = mPairs[i].mFirst;
+            uint32_t second = mPairs[i].mSecond;
+            if (mBodyRecords.GetHandle(first).GetIndex() > mBodyRecords.GetHandle(second).GetIndex()) {
+                std::swap(first, second);
+            }
+
+            mContacts[i].mKey = mGetPairKey(first, second);
+            mContacts[i].mBodyA = first;
+            mContacts[i].mBodyB = second;
+        }
+
+        std::sort(mContacts.begin(), mContacts.end(), [](const Contact& first, const Contact& second) {
+            return first.mKey < second.mKey;
+        });
+
+        jobSystem.ParallelFor(static_cast<uint32_t>(mContacts.size()), 64, [this](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t i = begin; i < end; i++)
+            {
+                Contact& contact = mContacts[i];
+                contact.mManifold = Collide(
+                    mBodies.mShape[contact.mBodyA], mGetTransform(contact.mBodyA),
+                    mBodies.mShape[contact.mBodyB], mGetTransform(contact.mBodyB)
+                );
+
+                for (uint32_t point = 0; point < 2; point++)
+                {
+                    contact.mNormalImpulse[point] = 0.0f;
+                    contact.mTangentImpulse[point] = 0.0f;
+                }
+
+                auto cached = std::lower_bound(mCache.begin(), mCache.end(), contact.mKey, [](const CachedContact& cachedContact, uint64_t key) {
+                    return cachedContact.mKey < key;
+                });
+                if (cached == mCache.end() || cached->mKey != contact.mKey) {
+                    continue;
+                }
+
+                for (uint32_t point = 0; point < contact.mManifold.mPointCount; point++) {
+                    for (uint32_t old = 0; old < cached->mPointCount; old++) {
+                        if (cached->mFeatures[old] == contact.mManifold.mPoints[point].mFeature)
+                        {
+                            contact.mNormalImpulse[point] = cached->mNormalImpulse[old];
+                            contact.mTangentImpulse[point] = cached->mTangentImpulse[old];
+                        }
+                    }
+                }
+            }
+        });
+
+        std::erase_if(mContacts, [](const Contact& contact) {
+            return contact.mManifold.mPointCount == 0;
+        });
+    }
+
+    void World::mBuildIslands()
+    {
+        std::size_t bodyCount = mBodies.mType.size();
+
+        mIslandParents.resize(bodyCount);
+        for (uint32_t i = 0; i < bodyCount; i++) {
+            mIslandParents[i] = i;
+        }
+
+        for (const Contact& contact : mContacts)
+        {
+            if (mBodies.mType[contact.mBodyA] != BodyType::DYNAMIC || mBodies.mType[contact.mBodyB] != BodyType::DYNAMIC) {
+                continue;
+            }
+
+            uint32_t rootA = FindRoot(mIslandParents, contact.mBodyA);
+            uint32_t rootB = FindRoot(mIslandParents, contact.mBodyB);
+            if (rootA != rootB) {
+                mIslandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+            }
+        }
+
+        std::vector<uint32_t> islandOfRoot(bodyCount, NONE);
+        std::vector<uint32_t> contactIsland(mContacts.size());
+        std::vector<uint32_t> islandSizes;
+
+        for (std::size_t i = 0; i < mContacts.size(); i++)
+        {
+            const Contact& contact = mContacts[i];
+            uint32_t body = mBodies.mType[contact.mBodyA] == BodyType::DYNAMIC ? contact.mBodyA : contact.mBodyB;
+            uint32_t root = FindRoot(mIslandParents, body);
+
+            if (islandOfRoot[root] == NONE)
+            {
+                islandOfRoot[root] = static_cast<uint32_t>(islandSizes.size());
+                islandSizes.push_back(0);
+            }
+
+            contactIsland[i] = islandOfRoot[root];
+            islandSizes[contactIsland[i]]++;
+        }
+
+        mIslands.resize(islandSizes.size());
+        uint32_t offset = 0;
+        for (std::size_t i = 0; i < islandSizes.size(); i++)
+        {
+            mIslands[i] = { offset, offset };
+            offset += islandSizes[i];
+        }
+
+        std::vector<Contact> sorted(mContacts.size());
+        for (std::size_t i = 0; i < mContacts.size(); i++) {
+            sorted[mIslands[contactIsland[i]].mContactEnd++] = mContacts[i];
+        }
+        mContacts.swap(sorted);
+    }
+
+    void World::mSolveIsland(const Island& island, Scratch& scratch, float timestep)
+    {
+        mBatchIsland(island, scratch, timestep);
+
+        std::vector<float>& velocityX = scratch.mVelocityX;
+        std::vector<float>& velocityY = scratch.mVelocityY;
+        std::vector<float>& angularVelocity = scratch.mAngularVelocity;
+
+        for (uint32_t iteration = 0; iteration < mIterations; iteration++)
+        {
+            for (ContactBatch& batch : scratch.mBatches)
+            {
+                Float4 vAX = Gather(velocityX, batch.mBodyA);
+                Float4 vAY = Gather(velocityY, batch.mBodyA);
+                Float4 wA = Gather(angularVelocity, batch.mBodyA);
+                Float4 vBX = Gather(velocityX, batch.mBodyB);
+                Float4 vBY = Gather(velocityY, batch.mBodyB);
+                Float4 wB = Gather(angularVelocity, batch.mBodyB);
+
+                Float4 normalX = Float4::Load(batch.mNormalX);
+                Float4 normalY = Float4::Load(batch.mNormalY);
+                Float4 tangentX = normalY;
+                Float4 tangentY = -normalX;
+                Float4 friction = Float4::Load(batch.mFriction);
+                Float4 inverseMassA = Float4::Load(batch.mInverseMassA);
+                Float4 inverseInertiaA = Float4::Load(batch.mInverseInertiaA);
+                Float4 inverseMassB = Float4::Load(batch.mInverseMassB);
+                Float4 inverseInertiaB = Float4::Load(batch.mInverseInertiaB);
+
+                auto apply = [&](const Float4& anchorAX, const Float4& anchorAY, const Float4& anchorBX, const Float4& anchorBY, const Float4& impulseX, const Float4& impulseY)
+                {
+                    vAX = vAX - inverseMassA * impulseX;
+                    vAY = vAY - inverseMassA * impulseY;
+                    wA = wA - inverseInertiaA * (anchorAX * impulseY - anchorAY * impulseX);
+                    vBX = vBX + inverseMassB * impulseX;
+                    vBY = vBY + inverseMassB * impulseY;
+                    wB = wB + inverseInertiaB * (anchorBX * impulseY - anchorBY * impulseX);
+                };
+
+                for (ContactBatch::Point& point : batch.mPoints)
+                {
+                    Float4 anchorAX = Float4::Load(point.mAnchorAX);
+                    Float4 anchorAY = Float4::Load(point.mAnchorAY);
+                    Float4 anchorBX = Float4::Load(point.mAnchorBX);
+                    Float4 anchorBY = Float4::Load(point.mAnchorBY);
+
+                    Float4 relativeX = vBX - wB * anchorBY - vAX + wA * anchorAY;
+                    Float4 relativeY = vBY + wB * anchorBX - vAY - wA * anchorAX;
+
+                    Float4 tangentImpulse = Float4::Load(point.mTangentImpulse);
+                    Float4 maxFriction = friction * Float4::Load(point.mNormalImpulse);
+                    Float4 lambda = -(Float4::Load(point.mTangentMass) * (relativeX * tangentX + relativeY * tangentY));
+                    Float4 newImpulse = Float4::Max(-maxFriction, Float4::Min(tangentImpulse + lambda, maxFriction));
+                    lambda = newImpulse - tangentImpulse;
+                    newImpulse.Store(point.mTangentImpulse);
+
+                    apply(anchorAX, anchorAY, anchorBX, anchorBY, tangentX * lambda, tangentY * lambda);
+                }
+
+                for (ContactBatch::Point& point : batch.mPoints)
+                {
+                    Float4 anchorAX = Float4::Load(point.mAnchorAX);
+                    Float4 anchorAY = Float4::Load(point.mAnchorAY);
+                    Float4 anchorBX = Float4::Load(point.mAnchorBX);
+                    Float4 anchorBY = Float4::Load(point.mAnchorBY);
+
+                    Float4 relativeX = vBX - wB * anchorBY - vAX + wA * anchorAY;
+                    Float4 relativeY = vBY + wB * anchorBX - vAY - wA * anchorAX;
+
+                    Float4 normalImpulse = Float4::Load(point.mNormalImpulse);
+                    Float4 normalVelocity = relativeX * normalX + relativeY * normalY;
+                    Float4 lambda = -(Float4::Load(point.mNormalMass) * (normalVelocity - Float4::Load(point.mBias)));
+                    Float4 newImpulse = Float4::Max(normalImpulse + lambda, Float4(0.0f));
+                    lambda = newImpulse - normalImpulse;
+                    newImpulse.Store(point.mNormalImpulse);
+
+                    apply(anchorAX, anchorAY, anchorBX, anchorBY, normalX * lambda, normalY * lambda);
+                }
+
+                Scatter(velocityX, batch.mBodyA, vAX);
+                Scatter(velocityY, batch.mBodyA, vAY);
+                Scatter(angularVelocity, batch.mBodyA, wA);
+                Scatter(velocityX, batch.mBodyB, vBX);
+                Scatter(velocityY, batch.mBodyB, vBY);
+                Scatter(angularVelocity, batch.mBodyB, wB);
+            }
+        }
+
+        for (const ContactBatch& batch : scratch.mBatches) {
+            for (uint32_t lane = 0; lane < batch.mCount; lane++)
+            {
+                Contact& contact = mContacts[batch.mContact[lane]];
+                for (uint32_t point = 0; point < 2; point++)
+                {
+                    contact.mNormalImpulse[point] = batch.mPoints[point].mNormalImpulse[lane];
+                    contact.mTangentImpulse[point] = batch.mPoints[point].mTangentImpulse[lane];
+                }
+            }
+        }
+
+        for (std::size_t local = 0; local < scratch.mGlobalIndex.size(); local++)
+        {
+            uint32_t global = scratch.mGlobalIndex[local];
+            scratch.mLocalIndex[global] = NONE;
+
+            if (mBodies.mType[global] == BodyType::DYNAMIC)
+            {
+                mBodies.mVelocityX[global] = velocityX[local];
+                mBodies.mVelocityY[global] = velocityY[local];
+                mBodies.mAngularVelocity[global] = angularVelocity[local];
+            }
+        }
+    }
+
+    void World::mBatchIsland(const Island& island, Scratch& scratch, float timestep)
+    {
+        if (scratch.mLocalIndex.size() < mBodies.mType.size()) {
+            scratch.mLocalIndex.resize(mBodies.mType.size(), NONE);
+        }
+
+        scratch.mGlobalIndex.clear();
+        scratch.mVelocityX.clear();
+        scratch.mVelocityY.clear();
+        scratch.mAngularVelocity.clear();
+        scratch.mBatches.clear();
+
+        auto getLocal = [&](uint32_t global)
+        {
+            if (scratch.mLocalIndex[global] == NONE)
+            {
+                scratch.mLocalIndex[global] = static_cast<uint32_t>(scratch.mGlobalIndex.size());
+                scratch.mGlobalIndex.push_back(global);
+                scratch.mVelocityX.push_back(mBodies.mVelocityX[global]);
+                scratch.mVelocityY.push_back(mBodies.mVelocityY[global]);
+                scratch.mAngularVelocity.push_back(mBodies.mAngularVelocity[global]);
+            }
+            return scratch.mLocalIndex[global];
+        };
+
+        std::size_t firstOpen = 0;
+
+        for (uint32_t index = island.mContactBegin; index < island.mContactEnd; index++)
+        {
+            const Contact& contact = mContacts[index];
+            uint32_t a = contact.mBodyA;
+            uint32_t b = contact.mBodyB;
+            uint32_t localA = getLocal(a);
+            uint32_t localB = getLocal(b);
+            bool dynamicA = mBodies.mType[a] == BodyType::DYNAMIC;
+            bool dynamicB = mBodies.mType[b] == BodyType::DYNAMIC;
+
+            std::size_t batchIndex = std::max(firstOpen, scratch.mBatches.size() > BATCH_SEARCH_WINDOW ? scratch.mBatches.size() - BATCH_SEARCH_WINDOW : 0);
+            for (; batchIndex < scratch.mBatches.size(); batchIndex++)
+            {
+                const ContactBatch& batch = scratch.mBatches[batchIndex];
+                if (batch.mCount == mLANES) {
+                    continue;
+                }
+
+                bool conflict = false;
+                for (uint32_t lane = 0; lane < batch.mCount && !conflict; lane++)
+                {
+                    conflict = (dynamicA && (batch.mBodyA[lane] == localA || batch.mBodyB[lane] == localA))
+                            || (dynamicB && (batch.mBodyA[lane] == localB || batch.mBodyB[lane] == localB));
+                }
+
+                if (!conflict) {
+                    break;
+                }
+            }
+
+            if (batchIndex == scratch.mBatches.size())
+            {
+                ContactBatch& batch = scratch.mBatches.emplace_back();
+                std::fill(std::begin(batch.mContact), std::end(batch.mContact), NONE);
+            }
+
+            ContactBatch& batch = scratch.mBatches[batchIndex];
+            uint32_t lane = batch.mCount++;
+
+            while (firstOpen < scratch.mBatches.size() && scratch.mBatches[firstOpen].mCount == mLANES) {
+                firstOpen++;
+            }
+
+            const Manifold& manifold = contact.mManifold;
+            float normalX = manifold.mNormal[V2f::X];
+            float normalY = manifold.mNormal[V2f::Y];
+            float tangentX = normalY;
+            float tangentY = -normalX;
+
+            float inverseMassA = mBodies.mInverseMass[a];
+            float inverseInertiaA = mBodies.mInverseInertia[a];
+            float inverseMassB = mBodies.mInverseMass[b];
+            float inverseInertiaB = mBodies.mInverseInertia[b];
+            float restitution = std::max(mBodies.mRestitution[a], mBodies.mRestitution[b]);
+
+            batch.mContact[lane] = index;
+            batch.mBodyA[lane] = localA;
+            batch.mBodyB[lane] = localB;
+            batch.mNormalX[lane] = normalX;
+            batch.mNormalY[lane] = normalY;
+            batch.mFriction[lane] = std::sqrt(mBodies.mFriction[a] * mBodies.mFriction[b]);
+            batch.mInverseMassA[lane] = inverseMassA;
+            batch.mInverseInertiaA[lane] = inverseInertiaA;
+            batch.mInverseMassB[lane] = inverseMassB;
+            batch.mInverseInertiaB[lane] = inverseInertiaB;
+
+            for (uint32_t p = 0; p < manifold.mPointCount; p++)
+            {
+                const ManifoldPoint& manifoldPoint = manifold.mPoints[p];
+                ContactBatch::Point& point = batch.mPoints[p];
+
+                float anchorAX = manifoldPoint.mPosition[V2f::X] - mBodies.mCenterX[a];
+                float anchorAY = manifoldPoint.mPosition[V2f::Y] - mBodies.mCenterY[a];
+                float anchorBX = manifoldPoint.mPosition[V2f::X] - mBodies.mCenterX[b];
+                float anchorBY = manifoldPoint.mPosition[V2f::Y] - mBodies.mCenterY[b];
+
+                float normalA = anchorAX * normalY - anchorAY * normalX;
+                float normalB = anchorBX * normalY - anchorBY * normalX;
+                float tangentA = anchorAX * tangentY - anchorAY * tangentX;
+                float tangentB = anchorBX * tangentY - anchorBY * tangentX;
+
+                float normalK = inverseMassA + inverseMassB + inverseInertiaA * normalA * normalA + inverseInertiaB * normalB * normalB;
+                float tangentK = inverseMassA + inverseMassB + inverseInertiaA * tangentA * tangentA + inverseInertiaB * tangentB * tangentB;
+
+                float relativeX = mBodies.mVelocityX[b] - mBodies.mAngularVelocity[b] * anchorBY - mBodies.mVelocityX[a] + mBodies.mAngularVelocity[a] * anchorAY;
+                float relativeY = mBodies.mVelocityY[b] + mBodies.mAngularVelocity[b] * anchorBX - mBodies.mVelocityY[a] - mBodies.mAngularVelocity[a] * anchorAX;
+                float normalVelocity = relativeX * normalX + relativeY * normalY;
+
+                float positionBias = (BAUMGARTE / timestep) * std::max(0.0f, -manifoldPoint.mSeparation - LINEAR_SLOP);
+                float restitutionBias = normalVelocity < -RESTITUTION_THRESHOLD ? -restitution * normalVelocity : 0.0f;
+
+                point.mAnchorAX[lane] = anchorAX;
+                point.mAnchorAY[lane] = anchorAY;
+                point.mAnchorBX[lane] = anchorBX;
+                point.mAnchorBY[lane] = anchorBY;
+                point.mNormalMass[lane] = normalK > 0.0f ? 1.0f / normalK : 0.0f;
+                point.mTangentMass[lane] = tangentK > 0.0f ? 1.0f / tangentK : 0.0f;
+                point.mBias[lane] = std::max(positionBias, restitutionBias);
+                point.mNormalImpulse[lane] = contact.mNormalImpulse[p];
+                point.mTangentImpulse[lane] = contact.mTangentImpulse[p];
+
+                float impulseX = normalX * contact.mNormalImpulse[p] + tangentX * contact.mTangentImpulse[p];
+                float impulseY = normalY * contact.mNormalImpulse[p] + tangentY * contact.mTangentImpulse[p];
+
+                scratch.mVelocityX[localA] -= inverseMassA * impulseX;
+                scratch.mVelocityY[localA] -= inverseMassA * impulseY;
+                scratch.mAngularVelocity[localA] -= inverseInertiaA * (anchorAX * impulseY - anchorAY * impulseX);
+                scratch.mVelocityX[localB] += inverseMassB * impulseX;
+                scratch.mVelocityY[localB] += inverseMassB * impulseY;
+                scratch.mAngularVelocity[localB] += inverseInertiaB * (anchorBX * impulseY - anchorBY * impulseX);
+            }
+        }
+
+        uint32_t dummy = static_cast<uint32_t>(scratch.mGlobalIndex.size());
+        scratch.mVelocityX.push_back(0.0f);
+        scratch.mVelocityY.push_back(0.0f);
+        scratch.mAngularVelocity.push_back(0.0f);
+
+        for (ContactBatch& batch : scratch.mBatches) {
+            for (uint32_t lane = batch.mCount; lane < mLANES; lane++)
+            {
+                batch.mBodyA[lane] = dummy;
+                batch.mBodyB[lane] = dummy;
+            }
+        }
+    }
+
+    void World::mIntegratePositions(float timestep)
+    {
+        for (std::size_t i = 0; i < mBodies.mType.size(); i++)
+        {
+            if (mBodies.mType[i] == BodyType::STATIC) {
+                continue;
+            }
+
+            mBodies.mCenterX[i] += timestep * mBodies.mVelocityX[i];
+            mBodies.mCenterY[i] += timestep * mBodies.mVelocityY[i];
+            mBodies.mAngle[i] += timestep * mBodies.mAngularVelocity[i];
+        }
+    }
+
+    void World::mStoreImpulses()
+    {
+        mCache.resize(mContacts.size());
+
+        for (std::size_t i = 0; i < mContacts.size(); i++)
+        {
+            const Contact& contact = mContacts[i];
+            CachedContact& cached = mCache[i];
+
+            cached.mKey = contact.mKey;
+            cached.mPointCount = contact.mManifold.mPointCount;
+            for (uint32_t point = 0; point < 2; point++)
+            {
+                cached.mFeatures[point] = contact.mManifold.mPoints[point].mFeature;
+                cached.mNormalImpulse[point] = contact.mNormalImpulse[point];
+                cached.mTangentImpulse[point] = contact.mTangentImpulse[point];
+            }
+        }
+
+        std::sort(mCache.begin(), mCache.end(), [](const CachedContact& first, const CachedContact& second) {
+            return first.mKey < second.mKey;
+        });
+    }
+}
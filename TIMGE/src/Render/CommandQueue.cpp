@@ -0,0 +1,250 @@
+#include "TIMGE/Render/CommandQueue.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <format>
+#include <functional>
+#include <tuple>
+
+#include <glad/glad.h>
+
+namespace TIMGE::Render
+{
+    namespace
+    {
+        constexpr std::array<GLenum, 3> PRIMITIVES = {
+            GL_TRIANGLES,
+            GL_LINES,
+            GL_POINTS
+        };
+
+        struct Cursor
+        {
+            uint64_t mKey;
+            uint32_t mSequence;
+            uint32_t mBuffer;
+            uint32_t mIndex;
+
+            [[nodiscard]] bool operator>(const Cursor& cursor) const {
+                return std::tie(mKey, mSequence, mBuffer, mIndex) > std::tie(cursor.mKey, cursor.mSequence, cursor.mBuffer, cursor.mIndex);
+            }
+        };
+
+        void SortPackets(std::vector<Packet>& packets)
+        {
+            std::stable_sort(packets.begin(), packets.end(), [](const Packet& a, const Packet& b) {
+                return std::tie(a.mKey, a.mSequence) < std::tie(b.mKey, b.mSequence);
+            });
+        }
+    }
+
+    CommandQueueException::CommandQueueException(std::string message)
+     : Exception(std::format("CommandQueue: {}", message))
+    {}
+
+    CommandBuffer::CommandBuffer(uint8_t index)
+     : mIndex{index},
+       mSequence{},
+       mPackets{},
+       mUniforms{}
+    {}
+
+    void CommandBuffer::Draw(const Packet& packet, std::span<const float> uniforms)
+    {
+        if (uniforms.size() % 4 != 0 || uniforms.size() / 4 > UINT16_MAX) {
+            throw CommandQueueException("Uniform data must be a whole number of vec4s.");
+        }
+
+        Packet& recorded = mPackets.emplace_back(packet);
+        recorded.mUniformOffset = static_cast<uint32_t>(mUniforms.size());
+        recorded.mSequence = mSequence;
+        recorded.mUniformCount = static_cast<uint16_t>(uniforms.size() / 4);
+        recorded.mBuffer = mIndex;
+
+        mUniforms.insert(mUniforms.end(), uniforms.begin(), uniforms.end());
+    }
+
+    void CommandBuffer::Clear()
+    {
+        mPackets.clear();
+        mUniforms.clear();
+    }
+
+    [[nodiscard]] std::size_t CommandBuffer::GetSize() const {
+        return mPackets.size();
+    }
+
+    [[nodiscard]] const std::vector<Packet>& CommandBuffer::GetPackets() const {
+        return mPackets;
+    }
+
+    CommandQueue::CommandQueue(uint32_t bufferCount)
+     : mBuffers{},
+       mMerged{},
+       mStatistics{},
+       mSorted{false}
+    {
+        if (bufferCount == 0 || bufferCount > MAX_BUFFERS) {
+            throw CommandQueueException(std::format("Buffer count must be between 1 and {}.", MAX_BUFFERS));
+        }
+
+        mBuffers.reserve(bufferCount);
+        for (uint32_t i = 0; i < bufferCount; i++) {
+            mBuffers.emplace_back(static_cast<uint8_t>(i));
+        }
+    }
+
+    void CommandQueue::Sort(JobSystem& jobSystem)
+    {
+        jobSystem.ParallelFor(static_cast<uint32_t>(mBuffers.size()), 1, [this](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t i = begin; i < end; i++) {
+                SortPackets(mBuffers[i].mPackets);
+            }
+        });
+        mMerge();
+    }
+
+    void CommandQueue::Sort()
+    {
+        for (CommandBuffer& buffer : mBuffers) {
+            SortPackets(buffer.mPackets);
+        }
+        mMerge();
+    }
+
+    void CommandQueue::Execute()
+    {
+        if (!mSorted) {
+            Sort();
+        }
+
+        mStatistics = { static_cast<uint32_t>(mMerged.size()), 0, 0, 0, 0 };
+
+        // Bindings are compared against the previous packet only; the sort key
+        // is what groups packets so that these comparisons mostly hit.
+        uint32_t program = UINT32_MAX;
+        uint32_t vertexArray = UINT32_MAX;
+        uint32_t texture = UINT32_MAX;
+
+        glActiveTexture(GL_TEXTURE0);
+
+        for (const Packet* packet : mMerged)
+        {
+            if (packet->mProgram != program)
+            {
+                program = packet->mProgram;
+                glUseProgram(program);
+                mStatistics.mProgramBinds++;
+            }
+            if (packet->mVertexArray != vertexArray)
+            {
+                vertexArray = packet->mVertexArray;
+                glBindVertexArray(vertexArray);
+                mStatistics.mVertexArrayBinds++;
+            }
+            if (packet->mTexture != texture)
+            {
+                texture = packet->mTexture;
+                glBindTexture(GL_TEXTURE_2D, texture);
+                mStatistics.mTextureBinds++;
+            }
+            if (packet->mUniformCount != 0 && packet->mUniformLocation >= 0) {
+                glUniform4fv(packet->mUniformLocation, packet->mUniformCount, mBuffers[packet->mBuffer].mUniforms.data() + packet->mUniformOffset);
+            }
+
+            glDrawElements(PRIMITIVES[static_cast<std::size_t>(packet->mPrimitive)], static_cast<GLsizei>(packet->mIndexCount), GL_UNSIGNED_INT,
+                reinterpret_cast<const void*>(static_cast<std::size_t>(packet->mFirstIndex) * sizeof(uint32_t)));
+            mStatistics.mDrawCalls++;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glBindVertexArray(0);
+        glUseProgram(0);
+
+        Reset();
+    }
+
+    void CommandQueue::Reset()
+    {
+        for (CommandBuffer& buffer : mBuffers) {
+            buffer.Clear();
+        }
+        mMerged.clear();
+        mSorted = false;
+    }
+
+    [[nodiscard]] CommandBuffer& CommandQueue::GetBuffer(uint32_t index)
+    {
+        if (index >= mBuffers.size()) {
+            throw CommandQueueException(std::format("Buffer {} does not exist.", index));
+        }
+
+        mSorted = false;
+        return mBuffers[index];
+    }
+
+    [[nodiscard]] uint32_t CommandQueue::GetBufferCount() const {
+        return static_cast<uint32_t>(mBuffers.size());
+    }
+
+    [[nodiscard]] std::size_t CommandQueue::GetSize() const
+    {
+        std::size_t size = 0;
+        for (const CommandBuffer& buffer : mBuffers) {
+            size += buffer.mPackets.size();
+        }
+        return size;
+    }
+
+    [[nodiscard]] const CommandQueue::Statistics& CommandQueue::GetStatistics() const {
+        return mStatistics;
+    }
+
+    [[nodiscard]] uint64_t CommandQueue::MakeKey(uint8_t layer, uint16_t program, uint16_t material, float depth)
+    {
+        static constexpr uint32_t DEPTH_MAX = (1u << 24) - 1;
+        uint32_t quantized = static_cast<uint32_t>(std::lround(std::clamp(depth, 0.0f, 1.0f) * DEPTH_MAX));
+
+        return static_cast<uint64_t>(layer) << 56
+            | static_cast<uint64_t>(program) << 40
+            | static_cast<uint64_t>(material) << 24
+            | quantized;
+    }
+
+    void CommandQueue::mMerge()
+    {
+        mMerged.clear();
+        mMerged.reserve(GetSize());
+
+        std::vector<Cursor> heap;
+        heap.reserve(mBuffers.size());
+        for (uint32_t i = 0; i < mBuffers.size(); i++) {
+            if (!mBuffers[i].mPackets.empty()) {
+                heap.push_back({ mBuffers[i].mPackets.front().mKey, mBuffers[i].mPackets.front().mSequence, i, 0 });
+            }
+        }
+        std::make_heap(heap.begin(), heap.end(), std::greater<>{});
+
+        while (!heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<>{});
+            Cursor& cursor = heap.back();
+
+            const std::vector<Packet>& packets = mBuffers[cursor.mBuffer].mPackets;
+            mMerged.push_back(&packets[cursor.mIndex]);
+
+            if (++cursor.mIndex == packets.size())
+            {
+                heap.pop_back();
+                continue;
+            }
+
+            cursor.mKey = packets[cursor.mIndex].mKey;
+            cursor.mSequence = packets[cursor.mIndex].mSequence;
+            std::push_heap(heap.begin(), heap.end(), std::greater<>{});
+        }
+
+        mSorted = true;
+    }
+}
@@ -0,0 +1,484 @@
+#include "TIMGE/Render/Culling.hpp"
+#include "TIMGE/Utils/SIMD.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <format>
+
+namespace TIMGE::Render
+{
+    namespace
+    {
+        constexpr std::array<uint32_t, 36> BOX_INDICES = {
+            0, 1, 3, 0, 3, 2,
+            4, 6, 7, 4, 7, 5,
+            0, 4, 5, 0, 5, 1,
+            2, 3, 7, 2, 7, 6,
+            0, 2, 6, 0, 6, 4,
+            1, 5, 7, 1, 7, 3
+        };
+
+        [[nodiscard]] std::array<std::array<float, 3>, 8> GetCorners(const std::array<float, 3>& min, const std::array<float, 3>& max)
+        {
+            std::array<std::array<float, 3>, 8> corners;
+            for (uint32_t corner = 0; corner < corners.size(); corner++) {
+                corners[corner] = { corner & 4 ? max[0] : min[0], corner & 2 ? max[1] : min[1], corner & 1 ? max[2] : min[2] };
+            }
+            return corners;
+        }
+
+        [[nodiscard]] Float8 LoadBatch(const std::vector<float>& values, std::size_t base, std::size_t lanes)
+        {
+            if (lanes == Float8::WIDTH) {
+                return Float8::Load(values.data() + base);
+            }
+
+            std::array<float, Float8::WIDTH> padded{};
+            std::copy_n(values.data() + base, lanes, padded.begin());
+            return Float8::Load(padded.data());
+        }
+
+        [[nodiscard]] float Edge(float ax, float ay, float bx, float by, float px, float py) {
+            return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+        }
+    }
+
+    CullingException::CullingException(std::string message)
+     : Exception(std::format("Culling: {}", message))
+    {}
+
+    void SphereBounds::Add(const std::array<float, 3>& center, float radius)
+    {
+        mX.push_back(center[0]);
+        mY.push_back(center[1]);
+        mZ.push_back(center[2]);
+        mRadius.push_back(radius);
+    }
+
+    void SphereBounds::Clear()
+    {
+        mX.clear();
+        mY.clear();
+        mZ.clear();
+        mRadius.clear();
+    }
+
+    [[nodiscard]] std::size_t SphereBounds::GetSize() const {
+        return mX.size();
+    }
+
+    void BoxBounds::Add(const std::array<float, 3>& min, const std::array<float, 3>& max)
+    {
+        mMinX.push_back(min[0]);
+        mMinY.push_back(min[1]);
+        mMinZ.push_back(min[2]);
+        mMaxX.push_back(max[0]);
+        mMaxY.push_back(max[1]);
+        mMaxZ.push_back(max[2]);
+    }
+
+    void BoxBounds::Clear()
+    {
+        mMinX.clear();
+        mMinY.clear();
+        mMinZ.clear();
+        mMaxX.clear();
+        mMaxY.clear();
+        mMaxZ.clear();
+    }
+
+    [[nodiscard]] std::size_t BoxBounds::GetSize() const {
+        return mMinX.size();
+    }
+
+    OcclusionBuffer::OcclusionBuffer(uint32_t width, uint32_t height)
+     : mSize{width, height},
+       mViewProjection{},
+       mVertices{},
+       mIndices{},
+       mTriangles{},
+       mLevels{},
+       mRasterized{false}
+    {
+        if (width == 0 || height == 0) {
+            throw CullingException("Occlusion buffer size must be positive.");
+        }
+    }
+
+    void OcclusionBuffer::Begin(const Mat4& viewProjection)
+    {
+        mViewProjection = viewProjection;
+        mVertices.clear();
+        mIndices.clear();
+        mRasterized = false;
+    }
+
+    void OcclusionBuffer::AddOccluder(const std::array<float, 3>& min, const std::array<float, 3>& max)
+    {
+        std::array<std::array<float, 3>, 8> corners = GetCorners(min, max);
+        AddOccluder(corners, BOX_INDICES);
+    }
+
+    void OcclusionBuffer::AddOccluder(std::span<const std::array<float, 3>> vertices, std::span<const uint32_t> indices)
+    {
+        if (indices.size() % 3 != 0) {
+            throw CullingException("Occluder indices must form whole triangles.");
+        }
+
+        uint32_t base = static_cast<uint32_t>(mVertices.size());
+        for (uint32_t index : indices)
+        {
+            if (index >= vertices.size()) {
+                throw CullingException("Occluder index out of range.");
+            }
+            mIndices.push_back(base + index);
+        }
+        mVertices.insert(mVertices.end(), vertices.begin(), vertices.end());
+    }
+
+    void OcclusionBuffer::Rasterize(JobSystem& jobSystem)
+    {
+        uint32_t width = mSize[V2ui32::WIDTH];
+        uint32_t height = mSize[V2ui32::HEIGHT];
+
+        mTriangles.resize(mIndices.size() / 3);
+        jobSystem.ParallelFor(static_cast<uint32_t>(mTriangles.size()), 256, [this](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t i = begin; i < end; i++) {
+                mSetup(i);
+            }
+        });
+
+        mLevels.resize(1);
+        mLevels[0].mWidth = width;
+        mLevels[0].mHeight = height;
+        mLevels[0].mDepth.assign(static_cast<std::size_t>(width) * height, 1.0f);
+
+        // Bands own disjoint rows, so workers never write the same texel.
+        uint32_t bands = (height + mBAND_HEIGHT - 1) / mBAND_HEIGHT;
+        jobSystem.ParallelFor(bands, 1, [this](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t band = begin; band < end; band++) {
+                mRasterizeBand(band);
+            }
+        });
+
+        mBuildHierarchy();
+        mRasterized = true;
+    }
+
+    [[nodiscard]] bool OcclusionBuffer::IsOccluded(const std::array<float, 3>& min, const std::array<float, 3>& max) const
+    {
+        if (!mRasterized) {
+            return false;
+        }
+
+        float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY, nearest = INFINITY;
+        for (const std::array<float, 3>& corner : GetCorners(min, max))
+        {
+            std::array<float, 4> projected = mProject(corner);
+            if (projected[3] < mNEAR_W) {
+                return false;
+            }
+
+            minX = std::min(minX, projected[0]);
+            maxX = std::max(maxX, projected[0]);
+            minY = std::min(minY, projected[1]);
+            maxY = std::max(maxY, projected[1]);
+            nearest = std::min(nearest, projected[2]);
+        }
+
+        float width = static_cast<float>(mSize[V2ui32::WIDTH]);
+        float height = static_cast<float>(mSize[V2ui32::HEIGHT]);
+        if (nearest < 0.0f || maxX < 0.0f || maxY < 0.0f || minX >= width || minY >= height) {
+            return false;
+        }
+
+        uint32_t x0 = static_cast<uint32_t>(std::max(minX, 0.0f));
+        uint32_t y0 = static_cast<uint32_t>(std::max(minY, 0.0f));
+        uint32_t x1 = static_cast<uint32_t>(std::min(maxX, width - 1.0f));
+        uint32_t y1 = static_cast<uint32_t>(std::min(maxY, height - 1.0f));
+
+        // Pick the level where the rectangle spans at most two texels per axis.
+        uint32_t extent = std::max(x1 - x0, y1 - y0) + 1;
+        std::size_t level = 0;
+        while ((1u << level) < extent && level + 1 < mLevels.size()) {
+            level++;
+        }
+
+        const Level& source = mLevels[level];
+        float farthest = 0.0f;
+        for (uint32_t y = y0 >> level; y <= std::min(y1 >> level, source.mHeight - 1); y++) {
+            for (uint32_t x = x0 >> level; x <= std::min(x1 >> level, source.mWidth - 1); x++) {
+                farthest = std::max(farthest, source.mDepth[static_cast<std::size_t>(y) * source.mWidth + x]);
+            }
+        }
+
+        return nearest > farthest;
+    }
+
+    [[nodiscard]] const V2ui32& OcclusionBuffer::GetSize() const {
+        return mSize;
+    }
+
+    [[nodiscard]] std::size_t OcclusionBuffer::GetLevelCount() const {
+        return mLevels.size();
+    }
+
+    [[nodiscard]] const std::vector<float>& OcclusionBuffer::GetLevel(std::size_t level) const
+    {
+        if (level >= mLevels.size()) {
+            throw CullingException(std::format("Level {} does not exist.", level));
+        }
+        return mLevels[level].mDepth;
+    }
+
+    [[nodiscard]] std::size_t OcclusionBuffer::GetTriangleCount() const {
+        return mIndices.size() / 3;
+    }
+
+    [[nodiscard]] std::array<float, 4> OcclusionBuffer::mProject(const std::array<float, 3>& point) const
+    {
+        const Mat4& m = mViewProjection;
+
+        float x = m[0] * point[0] + m[4] * point[1] + m[8] * point[2] + m[12];
+        float y = m[1] * point[0] + m[5] * point[1] + m[9] * point[2] + m[13];
+        float z = m[2] * point[0] + m[6] * point[1] + m[10] * point[2] + m[14];
+        float w = m[3] * point[0] + m[7] * point[1] + m[11] * point[2] + m[15];
+        if (w < mNEAR_W) {
+            return { 0.0f, 0.0f, 0.0f, w };
+        }
+
+        return {
+            (x / w * 0.5f + 0.5f) * mSize[V2ui32::WIDTH],
+            (y / w * 0.5f + 0.5f) * mSize[V2ui32::HEIGHT],
+            z / w * 0.5f + 0.5f,
+            w
+        };
+    }
+
+    void OcclusionBuffer::mSetup(uint32_t triangle)
+    {
+        Triangle& result = mTriangles[triangle];
+        result.mValid = true;
+
+        // Triangles reaching behind the near plane are dropped instead of
+        // clipped; losing an occluder only ever makes culling less aggressive.
+        for (uint32_t vertex = 0; vertex < 3; vertex++)
+        {
+            std::array<float, 4> projected = mProject(mVertices[mIndices[triangle * 3 + vertex]]);
+            if (projected[3] < mNEAR_W)
+            {
+                result.mValid = false;
+                return;
+            }
+
+            result.mX[vertex] = projected[0];
+            result.mY[vertex] = projected[1];
+            result.mZ[vertex] = projected[2];
+        }
+    }
+
+    void OcclusionBuffer::mRasterizeBand(uint32_t band)
+    {
+        Level& target = mLevels[0];
+        int width = static_cast<int>(target.mWidth);
+        int bandBegin = static_cast<int>(band * mBAND_HEIGHT);
+        int bandEnd = std::min(bandBegin + static_cast<int>(mBAND_HEIGHT), static_cast<int>(target.mHeight));
+
+        for (const Triangle& triangle : mTriangles)
+        {
+            if (!triangle.mValid) {
+                continue;
+            }
+
+            const std::array<float, 3>& x = triangle.mX;
+            const std::array<float, 3>& y = triangle.mY;
+
+            int rowBegin = std::max(bandBegin, static_cast<int>(std::ceil(std::min({ y[0], y[1], y[2] }) - 0.5f)));
+            int rowEnd = std::min(bandEnd - 1, static_cast<int>(std::floor(std::max({ y[0], y[1], y[2] }) - 0.5f)));
+            int columnBegin = std::max(0, static_cast<int>(std::ceil(std::min({ x[0], x[1], x[2] }) - 0.5f)));
+            int columnEnd = std::min(width - 1, static_cast<int>(std::floor(std::max({ x[0], x[1], x[2] }) - 0.5f)));
+            if (rowBegin > rowEnd || columnBegin > columnEnd) {
+                continue;
+            }
+
+            float area = Edge(x[0], y[0], x[1], y[1], x[2], y[2]);
+            if (std::abs(area) < 1.0E-8f) {
+                continue;
+            }
+            float sign = area > 0.0f ? 1.0f : -1.0f;
+            float inverseArea = 1.0f / std::abs(area);
+
+            for (int row = rowBegin; row <= rowEnd; row++)
+            {
+                float py = row + 0.5f;
+                float* depth = target.mDepth.data() + static_cast<std::size_t>(row) * width;
+
+                for (int column = columnBegin; column <= columnEnd; column++)
+                {
+                    float px = column + 0.5f;
+                    float w0 = sign * Edge(x[1], y[1], x[2], y[2], px, py);
+                    float w1 = sign * Edge(x[2], y[2], x[0], y[0], px, py);
+                    float w2 = sign * Edge(x[0], y[0], x[1], y[1], px, py);
+                    if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) {
+                        continue;
+                    }
+
+                    float z = (w0 * triangle.mZ[0] + w1 * triangle.mZ[1] + w2 * triangle.mZ[2]) * inverseArea;
+                    depth[column] = std::min(depth[column], std::max(z, 0.0f));
+                }
+            }
+        }
+    }
+
+    void OcclusionBuffer::mBuildHierarchy()
+    {
+        while (mLevels.back().mWidth > 1 || mLevels.back().mHeight > 1)
+        {
+            const Level& source = mLevels.back();
+
+            Level level;
+            level.mWidth = (source.mWidth + 1) / 2;
+            level.mHeight = (source.mHeight + 1) / 2;
+            level.mDepth.resize(static_cast<std::size_t>(level.mWidth) * level.mHeight);
+
+            for (uint32_t y = 0; y < level.mHeight; y++)
+            {
+                uint32_t y0 = y * 2;
+                uint32_t y1 = std::min(y0 + 1, source.mHeight - 1);
+                for (uint32_t x = 0; x < level.mWidth; x++)
+                {
+                    uint32_t x0 = x * 2;
+                    uint32_t x1 = std::min(x0 + 1, source.mWidth - 1);
+                    level.mDepth[static_cast<std::size_t>(y) * level.mWidth + x] = std::max({
+                        source.mDepth[static_cast<std::size_t>(y0) * source.mWidth + x0],
+                        source.mDepth[static_cast<std::size_t>(y0) * source.mWidth + x1],
+                        source.mDepth[static_cast<std::size_t>(y1) * source.mWidth + x0],
+                        source.mDepth[static_cast<std::size_t>(y1) * source.mWidth + x1]
+                    });
+                }
+            }
+
+            mLevels.push_back(std::move(level));
+        }
+    }
+
+    Culler::Culler()
+     : mStatistics{},
+       mFrameStatistics{}
+    {}
+
+    void Culler::CullSpheres(const Frustum& frustum, const SphereBounds& bounds, std::vector<uint32_t>& visible, const OcclusionBuffer* occlusion)
+    {
+        visible.clear();
+        std::size_t count = bounds.GetSize();
+
+        for (std::size_t base = 0; base < count; base += BATCH_SIZE)
+        {
+            std::size_t lanes = std::min(BATCH_SIZE, count - base);
+            Float8 x = LoadBatch(bounds.mX, base, lanes);
+            Float8 y = LoadBatch(bounds.mY, base, lanes);
+            Float8 z = LoadBatch(bounds.mZ, base, lanes);
+            Float8 negativeRadius = -LoadBatch(bounds.mRadius, base, lanes);
+
+            uint32_t outside = 0;
+            for (int plane = 0; plane < Frustum::PLANE_COUNT; plane++)
+            {
+                const std::array<float, 4>& p = frustum.GetPlane(static_cast<Frustum::Plane>(plane));
+                Float8 distance = x * Float8(p[0]) + y * Float8(p[1]) + z * Float8(p[2]) + Float8(p[3]);
+                outside |= Float8::LessMask(distance, negativeRadius);
+            }
+
+            uint32_t inside = ~outside & ((1u << lanes) - 1);
+            mFrameStatistics.mFrustumCulled += static_cast<uint32_t>(lanes) - std::popcount(inside);
+
+            for (; inside != 0; inside &= inside - 1)
+            {
+                uint32_t index = static_cast<uint32_t>(base) + std::countr_zero(inside);
+                if (occlusion != nullptr)
+                {
+                    float radius = bounds.mRadius[index];
+                    std::array<float, 3> min{ bounds.mX[index] - radius, bounds.mY[index] - radius, bounds.mZ[index] - radius };
+                    std::array<float, 3> max{ bounds.mX[index] + radius, bounds.mY[index] + radius, bounds.mZ[index] + radius };
+                    if (occlusion->IsOccluded(min, max))
+                    {
+                        mFrameStatistics.mOcclusionCulled++;
+                        continue;
+                    }
+                }
+                visible.push_back(index);
+            }
+        }
+
+        mFrameStatistics.mTested += static_cast<uint32_t>(count);
+        mFrameStatistics.mVisible += static_cast<uint32_t>(visible.size());
+    }
+
+    void Culler::CullBoxes(const Frustum& frustum, const BoxBounds& bounds, std::vector<uint32_t>& visible, const OcclusionBuffer* occlusion)
+    {
+        visible.clear();
+        std::size_t count = bounds.GetSize();
+        Float8 half(0.5f);
+
+        for (std::size_t base = 0; base < count; base += BATCH_SIZE)
+        {
+            std::size_t lanes = std::min(BATCH_SIZE, count - base);
+            Float8 minX = LoadBatch(bounds.mMinX, base, lanes);
+            Float8 minY = LoadBatch(bounds.mMinY, base, lanes);
+            Float8 minZ = LoadBatch(bounds.mMinZ, base, lanes);
+            Float8 maxX = LoadBatch(bounds.mMaxX, base, lanes);
+            Float8 maxY = LoadBatch(bounds.mMaxY, base, lanes);
+            Float8 maxZ = LoadBatch(bounds.mMaxZ, base, lanes);
+
+            Float8 centerX = (minX + maxX) * half;
+            Float8 centerY = (minY + maxY) * half;
+            Float8 centerZ = (minZ + maxZ) * half;
+            Float8 extentX = (maxX - minX) * half;
+            Float8 extentY = (maxY - minY) * half;
+            Float8 extentZ = (maxZ - minZ) * half;
+
+            // A box is outside a plane when its center lies further behind it
+            // than the box's extent projected onto the plane normal.
+            uint32_t outside = 0;
+            for (int plane = 0; plane < Frustum::PLANE_COUNT; plane++)
+            {
+                const std::array<float, 4>& p = frustum.GetPlane(static_cast<Frustum::Plane>(plane));
+                Float8 distance = centerX * Float8(p[0]) + centerY * Float8(p[1]) + centerZ * Float8(p[2]) + Float8(p[3]);
+                Float8 radius = extentX * Float8(std::abs(p[0])) + extentY * Float8(std::abs(p[1])) + extentZ * Float8(std::abs(p[2]));
+                outside |= Float8::LessMask(distance, -radius);
+            }
+
+            uint32_t inside = ~outside & ((1u << lanes) - 1);
+            mFrameStatistics.mFrustumCulled += static_cast<uint32_t>(lanes) - std::popcount(inside);
+
+            for (; inside != 0; inside &= inside - 1)
+            {
+                uint32_t index = static_cast<uint32_t>(base) + std::countr_zero(inside);
+                if (occlusion != nullptr)
+                {
+                    std::array<float, 3> min{ bounds.mMinX[index], bounds.mMinY[index], bounds.mMinZ[index] };
+                    std::array<float, 3> max{ bounds.mMaxX[index], bounds.mMaxY[index], bounds.mMaxZ[index] };
+                    if (occlusion->IsOccluded(min, max))
+                    {
+                        mFrameStatistics.mOcclusionCulled++;
+                        continue;
+                    }
+                }
+                visible.push_back(index);
+            }
+        }
+
+        mFrameStatistics.mTested += static_cast<uint32_t>(count);
+        mFrameStatistics.mVisible += static_cast<uint32_t>(visible.size());
+    }
+
+    void Culler::NewFrame()
+    {
+        mStatistics = mFrameStatistics;
+        mFrameStatistics = {};
+    }
+
+    [[nodiscard]] const Culler::Statistics& Culler::GetStatistics() const {
+        return mStatistics;
+    }
+}
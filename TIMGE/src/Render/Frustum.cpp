@@ -0,0 +1,45 @@
+#include "TIMGE/Render/Frustum.hpp"
+
+#include <cmath>
+
+namespace TIMGE::Render
+{
+    Frustum::Frustum(const Mat4& viewProjection)
+    {
+        // Gribb-Hartmann extraction from a column-major matrix: each plane is
+        // the fourth row plus or minus one of the others, then normalized.
+        auto row = [&](int index, int column) { return viewProjection[column * 4 + index]; };
+
+        for (int plane = 0; plane < PLANE_COUNT; plane++)
+        {
+            int axis = plane / 2;
+            float sign = plane % 2 == 0 ? 1.0f : -1.0f;
+
+            std::array<float, 4>& result = mPlanes[plane];
+            for (int column = 0; column < 4; column++) {
+                result[column] = row(3, column) + sign * row(axis, column);
+            }
+
+            float length = std::sqrt(result[0] * result[0] + result[1] * result[1] + result[2] * result[2]);
+            if (length > 0.0f) {
+                for (float& value : result) {
+                    value /= length;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] bool Frustum::Intersects(const std::array<float, 3>& center, float radius) const
+    {
+        for (const std::array<float, 4>& plane : mPlanes) {
+            if (plane[0] * center[0] + plane[1] * center[1] + plane[2] * center[2] + plane[3] < -radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] const std::array<float, 4>& Frustum::GetPlane(Plane plane) const {
+        return mPlanes[plane];
+    }
+}
@@ -0,0 +1,773 @@
+#include "TIMGE/Render/Graph.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <string_view>
+
+namespace TIMGE::Render
+{
+    namespace
+    {
+        struct FormatInfo
+        {
+            GLenum mFormat;
+            uint32_t mBytes;
+            std::string_view mName;
+            GLenum mPixelFormat;
+            GLenum mPixelType;
+        };
+
+        constexpr std::array<FormatInfo, 15> FORMATS = {{
+            { GL_R8, 1, "R8", GL_RED, GL_UNSIGNED_BYTE },
+            { GL_RG8, 2, "RG8", GL_RG, GL_UNSIGNED_BYTE },
+            { GL_RGBA8, 4, "RGBA8", GL_RGBA, GL_UNSIGNED_BYTE },
+            { GL_SRGB8_ALPHA8, 4, "SRGB8_ALPHA8", GL_RGBA, GL_UNSIGNED_BYTE },
+            { GL_RGB10_A2, 4, "RGB10_A2", GL_RGBA, GL_UNSIGNED_BYTE },
+            { GL_R11F_G11F_B10F, 4, "R11F_G11F_B10F", GL_RGB, GL_FLOAT },
+            { GL_R16F, 2, "R16F", GL_RED, GL_FLOAT },
+            { GL_RG16F, 4, "RG16F", GL_RG, GL_FLOAT },
+            { GL_RGBA16F, 8, "RGBA16F", GL_RGBA, GL_FLOAT },
+            { GL_R32F, 4, "R32F", GL_RED, GL_FLOAT },
+            { GL_RG32F, 8, "RG32F", GL_RG, GL_FLOAT },
+            { GL_RGBA32F, 16, "RGBA32F", GL_RGBA, GL_FLOAT },
+            { GL_DEPTH_COMPONENT24, 4, "DEPTH24", GL_DEPTH_COMPONENT, GL_UNSIGNED_INT },
+            { GL_DEPTH_COMPONENT32F, 4, "DEPTH32F", GL_DEPTH_COMPONENT, GL_FLOAT },
+            { GL_DEPTH24_STENCIL8, 4, "DEPTH24_STENCIL8", GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8 }
+        }};
+
+        [[nodiscard]] const FormatInfo& GetFormatInfo(GLenum format)
+        {
+            for (const FormatInfo& info : FORMATS) {
+                if (info.mFormat == format) {
+                    return info;
+                }
+            }
+            throw GraphException(std::format("Unsupported texture format 0x{:X}.", format));
+        }
+
+        void ValidateFormat(GLenum format) {
+            (void)GetFormatInfo(format);
+        }
+
+        [[nodiscard]] bool IsDepth(GLenum format) {
+            return GetFormatInfo(format).mPixelFormat == GL_DEPTH_COMPONENT || format == GL_DEPTH24_STENCIL8;
+        }
+
+        [[nodiscard]] uint64_t GetBytes(const TextureDesc& desc) {
+            return static_cast<uint64_t>(desc.mSize[V2ui32::WIDTH]) * desc.mSize[V2ui32::HEIGHT] * GetFormatInfo(desc.mFormat).mBytes;
+        }
+
+        [[nodiscard]] GLbitfield GetBarrier(Access access)
+        {
+            switch (access)
+            {
+                case Access::SAMPLED:
+                    return GL_TEXTURE_FETCH_BARRIER_BIT;
+                case Access::ATTACHMENT:
+                    return GL_FRAMEBUFFER_BARRIER_BIT;
+                case Access::STORAGE:
+                    return GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+            }
+            return 0;
+        }
+    }
+
+    GraphException::GraphException(std::string message)
+     : Exception(std::format("Render graph: {}", message))
+    {}
+
+    [[nodiscard]] bool Resource::IsNull() const {
+        return mIndex == UINT32_MAX;
+    }
+
+    Graph::Builder::Builder(Graph& graph, uint32_t pass)
+     : mGraph{graph},
+       mPass{pass}
+    {}
+
+    [[maybe_unused]] Resource Graph::Builder::Create(std::string name, const TextureDesc& desc)
+    {
+        if (desc.mSize[V2ui32::WIDTH] == 0 || desc.mSize[V2ui32::HEIGHT] == 0) {
+            throw GraphException(std::format("Texture \"{}\" has an empty size.", name));
+        }
+        ValidateFormat(desc.mFormat);
+
+        return { mGraph.mAddResource({ std::move(name), desc, 0, true, false, mNONE, mNONE, mNONE }) };
+    }
+
+    [[maybe_unused]] Resource Graph::Builder::Read(Resource resource, Access access)
+    {
+        mGraph.mUse(mPass, resource, access, false);
+        return resource;
+    }
+
+    [[maybe_unused]] Resource Graph::Builder::Write(Resource resource, Access access)
+    {
+        mGraph.mUse(mPass, resource, access, true);
+        return resource;
+    }
+
+    void Graph::Builder::SetSideEffect() {
+        mGraph.mPasses[mPass].mSideEffect = true;
+    }
+
+    Graph::Context::Context(const Graph& graph, GLuint framebuffer)
+     : mGraph{graph},
+       mFramebuffer{framebuffer}
+    {}
+
+    [[nodiscard]] GLuint Graph::Context::GetTexture(Resource resource) const
+    {
+        if (resource.mIndex >= mGraph.mResources.size()) {
+            throw GraphException("Invalid resource.");
+        }
+        return mGraph.mGetTexture(resource.mIndex);
+    }
+
+    [[nodiscard]] const TextureDesc& Graph::Context::GetDesc(Resource resource) const
+    {
+        if (resource.mIndex >= mGraph.mResources.size()) {
+            throw GraphException("Invalid resource.");
+        }
+        return mGraph.mResources[resource.mIndex].mDesc;
+    }
+
+    [[nodiscard]] GLuint Graph::Context::GetFramebuffer() const {
+        return mFramebuffer;
+    }
+
+    Graph::Graph()
+     : mPasses{},
+       mResources{},
+       mOrder{},
+       mPhysical{},
+       mPhysicalTextures{},
+       mPool{},
+       mFramebuffers{},
+       mFramebufferSwitches{},
+       mDeclaredSwitches{},
+       mCompiled{false}
+    {}
+
+    Graph::~Graph() {
+        ReleaseResources();
+    }
+
+    [[maybe_unused]] Resource Graph::Import(std::string name, GLuint texture, const TextureDesc& desc)
+    {
+        if (texture == 0) {
+            throw GraphException(std::format("Imported texture \"{}\" is not a texture.", name));
+        }
+        ValidateFormat(desc.mFormat);
+
+        return { mAddResource({ std::move(name), desc, texture, false, false, mNONE, mNONE, mNONE }) };
+    }
+
+    [[maybe_unused]] Resource Graph::ImportBackbuffer(const V2ui32& size) {
+        return { mAddResource({ "backbuffer", { size, GL_RGBA8 }, 0, false, true, mNONE, mNONE, mNONE }) };
+    }
+
+    void Graph::AddPass(std::string name, const Setup_T& setup, Execute_T execute)
+    {
+        if (mCompiled) {
+            throw GraphException("Passes cannot be added to a compiled graph, call Reset first.");
+        }
+
+        uint32_t index = static_cast<uint32_t>(mPasses.size());
+        mPasses.push_back({ std::move(name), std::move(execute), {}, {}, {}, {}, 0, false, false });
+
+        if (setup)
+        {
+            Builder builder(*this, index);
+            setup(builder);
+        }
+    }
+
+    void Graph::Compile()
+    {
+        mLink();
+        mCull();
+        mSchedule();
+        mAlias();
+        mPlaceBarriers();
+
+        mCompiled = true;
+    }
+
+    void Graph::Execute()
+    {
+        if (!mCompiled) {
+            Compile();
+        }
+
+        for (PooledTexture& pooled : mPool) {
+            pooled.mTaken = false;
+        }
+
+        mPhysicalTextures.resize(mPhysical.size());
+        for (std::size_t i = 0; i < mPhysical.size(); i++) {
+            mPhysicalTextures[i] = mAcquireTexture(mPhysical[i].mDesc);
+        }
+
+        // Textures nobody asked for this frame are released, and with them every
+        // framebuffer, since one of those may still point at a deleted texture.
+        auto unused = std::partition(mPool.begin(), mPool.end(), [](const PooledTexture& pooled) { return pooled.mTaken; });
+        if (unused != mPool.end())
+        {
+            for (auto it = unused; it != mPool.end(); it++) {
+                glDeleteTextures(1, &it->mTexture);
+            }
+            mPool.erase(unused, mPool.end());
+
+            for (const auto& [attachments, framebuffer] : mFramebuffers) {
+                glDeleteFramebuffers(1, &framebuffer);
+            }
+            mFramebuffers.clear();
+        }
+
+        GLuint bound = 0;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        for (uint32_t index : mOrder)
+        {
+            const Pass& pass = mPasses[index];
+
+            if (pass.mBarrier != 0 && GLAD_GL_VERSION_4_2) {
+                glMemoryBarrier(pass.mBarrier);
+            }
+
+            if (!pass.mAttachments.empty())
+            {
+                GLuint framebuffer = mAcquireFramebuffer(pass);
+                if (framebuffer != bound)
+                {
+                    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+                    bound = framebuffer;
+                }
+
+                const V2ui32& size = mResources[pass.mAttachments.front()].mDesc.mSize;
+                glViewport(0, 0, static_cast<GLsizei>(size[V2ui32::WIDTH]), static_cast<GLsizei>(size[V2ui32::HEIGHT]));
+            }
+
+            if (pass.mExecute) {
+                pass.mExecute(Context(*this, bound));
+            }
+        }
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    void Graph::Reset()
+    {
+        mPasses.clear();
+        mResources.clear();
+        mOrder.clear();
+        mPhysical.clear();
+        mPhysicalTextures.clear();
+        mFramebufferSwitches = 0;
+        mDeclaredSwitches = 0;
+        mCompiled = false;
+    }
+
+    void Graph::ReleaseResources()
+    {
+        for (const auto& [attachments, framebuffer] : mFramebuffers) {
+            glDeleteFramebuffers(1, &framebuffer);
+        }
+        mFramebuffers.clear();
+
+        for (const PooledTexture& pooled : mPool) {
+            glDeleteTextures(1, &pooled.mTexture);
+        }
+        mPool.clear();
+        mPhysicalTextures.clear();
+    }
+
+    [[nodiscard]] std::size_t Graph::GetPassCount() const {
+        return mPasses.size();
+    }
+
+    [[nodiscard]] std::size_t Graph::GetCulledPassCount() const {
+        return mCompiled ? mPasses.size() - mOrder.size() : 0;
+    }
+
+    [[nodiscard]] uint64_t Graph::GetTransientBytes() const
+    {
+        uint64_t bytes = 0;
+        for (const VirtualResource& resource : mResources) {
+            if (resource.mTransient && resource.mPhysical != mNONE) {
+                bytes += GetBytes(resource.mDesc);
+            }
+        }
+        return bytes;
+    }
+
+    [[nodiscard]] uint64_t Graph::GetAllocatedBytes() const
+    {
+        uint64_t bytes = 0;
+        for (const PhysicalTexture& physical : mPhysical) {
+            bytes += GetBytes(physical.mDesc);
+        }
+        return bytes;
+    }
+
+    [[nodiscard]] uint32_t Graph::GetFramebufferSwitches() const {
+        return mFramebufferSwitches;
+    }
+
+    [[nodiscard]] std::string Graph::Dump() const
+    {
+        if (!mCompiled) {
+            return "Render graph not compiled\n";
+        }
+
+        std::string dump = std::format("{} passes, {} culled, {} framebuffer switches ({} in declaration order)\n",
+            mPasses.size(), GetCulledPassCount(), mFramebufferSwitches, mDeclaredSwitches);
+
+        for (uint32_t index : mOrder)
+        {
+            const Pass& pass = mPasses[index];
+
+            std::string reads;
+            std::string writes;
+            for (const Use& use : pass.mUses)
+            {
+                std::string& list = use.mWrite ? writes : reads;
+                list += std::format("{}{}", list.empty() ? "" : ", ", mResources[use.mResource].mName);
+            }
+
+            dump += std::format("  {:<20} R [{}] W [{}]", pass.mName, reads, writes);
+            if (pass.mBarrier != 0) {
+                dump += std::format(" barrier 0x{:X}", pass.mBarrier);
+            }
+            dump += "\n";
+        }
+
+        for (const Pass& pass : mPasses) {
+            if (!pass.mLive) {
+                dump += std::format("  {:<20} culled\n", pass.mName);
+            }
+        }
+
+        dump += "Resources\n";
+        for (const VirtualResource& resource : mResources)
+        {
+            dump += std::format("  {:<20} {}x{} {:<16}", resource.mName,
+                resource.mDesc.mSize[V2ui32::WIDTH], resource.mDesc.mSize[V2ui32::HEIGHT], GetFormatInfo(resource.mDesc.mFormat).mName);
+
+            if (!resource.mTransient) {
+                dump += " imported\n";
+            } else if (resource.mPhysical == mNONE) {
+                dump += " unused\n";
+            } else {
+                dump += std::format(" passes {}-{} -> texture {}\n", resource.mFirstUse, resource.mLastUse, resource.mPhysical);
+            }
+        }
+
+        uint64_t requested = GetTransientBytes();
+        uint64_t allocated = GetAllocatedBytes();
+        dump += std::format("Transient memory: {:.1f} KiB requested, {:.1f} KiB allocated, {:.1f} KiB saved by aliasing\n",
+            requested / 1024.0, allocated / 1024.0, (requested - allocated) / 1024.0);
+
+        return dump;
+    }
+
+    [[nodiscard]] uint32_t Graph::GetBytesPerPixel(GLenum format) {
+        return GetFormatInfo(format).mBytes;
+    }
+
+    [[nodiscard]] uint32_t Graph::mAddResource(VirtualResource&& resource)
+    {
+        if (mCompiled) {
+            throw GraphException("Resources cannot be added to a compiled graph, call Reset first.");
+        }
+
+        mResources.push_back(std::move(resource));
+        return static_cast<uint32_t>(mResources.size() - 1);
+    }
+
+    void Graph::mUse(uint32_t pass, Resource resource, Access access, bool write)
+    {
+        if (resource.mIndex >= mResources.size()) {
+            throw GraphException(std::format("Pass \"{}\" uses an invalid resource.", mPasses[pass].mName));
+        }
+
+        const VirtualResource& virtualResource = mResources[resource.mIndex];
+        if (write && access == Access::SAMPLED) {
+            throw GraphException(std::format("Pass \"{}\" cannot write \"{}\" through a sampler.", mPasses[pass].mName, virtualResource.mName));
+        }
+        if (virtualResource.mBackbuffer && access != Access::ATTACHMENT) {
+            throw GraphException(std::format("Pass \"{}\" can only use the backbuffer as an attachment.", mPasses[pass].mName));
+        }
+
+        std::vector<Use>& uses = mPasses[pass].mUses;
+        auto it = std::find_if(uses.begin(), uses.end(), [&](const Use& use) { return use.mResource == resource.mIndex; });
+        if (it == uses.end()) {
+            uses.push_back({ resource.mIndex, access, write });
+        }
+        else
+        {
+            if (write && !it->mWrite) {
+                it->mAccess = access;
+            }
+            it->mWrite = it->mWrite || write;
+        }
+    }
+
+    void Graph::mLink()
+    {
+        std::vector<uint32_t> writers(mResources.size(), mNONE);
+        std::vector<std::vector<uint32_t>> readers(mResources.size());
+
+        for (uint32_t index = 0; index < mPasses.size(); index++)
+        {
+            Pass& pass = mPasses[index];
+            pass.mDependencies.clear();
+            pass.mProducers.clear();
+            pass.mAttachments.clear();
+
+            uint32_t colors = 0;
+            uint32_t depths = 0;
+            bool backbuffer = false;
+
+            for (const Use& use : pass.mUses)
+            {
+                const VirtualResource& resource = mResources[use.mResource];
+                uint32_t writer = writers[use.mResource];
+
+                if (writer != mNONE)
+                {
+                    pass.mDependencies.push_back(writer);
+                    pass.mProducers.push_back(writer);
+                }
+                else if (!use.mWrite && resource.mTransient) {
+                    throw GraphException(std::format("Pass \"{}\" reads \"{}\" before any pass writes it.", pass.mName, resource.mName));
+                }
+
+                if (use.mWrite) {
+                    pass.mDependencies.insert(pass.mDependencies.end(), readers[use.mResource].begin(), readers[use.mResource].end());
+                }
+
+                if (use.mWrite && use.mAccess == Access::ATTACHMENT)
+                {
+                    pass.mAttachments.push_back(use.mResource);
+                    backbuffer = backbuffer || resource.mBackbuffer;
+                    (IsDepth(resource.mDesc.mFormat) ? depths : colors)++;
+
+                    if (resource.mDesc.mSize != mResources[pass.mAttachments.front()].mDesc.mSize) {
+                        throw GraphException(std::format("Pass \"{}\" has attachments of different sizes.", pass.mName));
+                    }
+                }
+            }
+
+            if (colors > MAX_COLOR_ATTACHMENTS || depths > 1) {
+                throw GraphException(std::format("Pass \"{}\" has too many attachments.", pass.mName));
+            }
+            if (backbuffer && pass.mAttachments.size() > 1) {
+                throw GraphException(std::format("Pass \"{}\" cannot combine the backbuffer with other attachments.", pass.mName));
+            }
+
+            std::sort(pass.mDependencies.begin(), pass.mDependencies.end());
+            pass.mDependencies.erase(std::unique(pass.mDependencies.begin(), pass.mDependencies.end()), pass.mDependencies.end());
+            pass.mDependencies.erase(std::remove(pass.mDependencies.begin(), pass.mDependencies.end(), index), pass.mDependencies.end());
+
+            for (const Use& use : pass.mUses)
+            {
+                if (use.mWrite)
+                {
+                    writers[use.mResource] = index;
+                    readers[use.mResource].clear();
+                } else {
+                    readers[use.mResource].push_back(index);
+                }
+            }
+        }
+    }
+
+    void Graph::mCull()
+    {
+        for (Pass& pass : mPasses) {
+            pass.mLive = false;
+        }
+
+        // Walking backwards, a pass is kept when it has side effects, writes a
+        // resource owned outside the graph, or produces something a kept pass uses.
+        for (std::size_t index = mPasses.size(); index-- > 0;)
+        {
+            Pass& pass = mPasses[index];
+
+            for (const Use& use : pass.mUses) {
+                if (use.mWrite && !mResources[use.mResource].mTransient) {
+                    pass.mLive = true;
+                }
+            }
+            pass.mLive = pass.mLive || pass.mSideEffect;
+
+            if (pass.mLive) {
+                for (uint32_t producer : pass.mProducers) {
+                    mPasses[producer].mLive = true;
+                }
+            }
+        }
+    }
+
+    void Graph::mSchedule()
+    {
+        std::vector<uint32_t> pending(mPasses.size(), 0);
+        std::vector<std::vector<uint32_t>> successors(mPasses.size());
+
+        for (uint32_t index = 0; index < mPasses.size(); index++)
+        {
+            if (!mPasses[index].mLive) {
+                continue;
+            }
+            for (uint32_t dependency : mPasses[index].mDependencies)
+            {
+                if (mPasses[dependency].mLive)
+                {
+                    pending[index]++;
+                    successors[dependency].push_back(index);
+                }
+            }
+        }
+
+        std::vector<uint32_t> ready;
+        for (uint32_t index = 0; index < mPasses.size(); index++) {
+            if (mPasses[index].mLive && pending[index] == 0) {
+                ready.push_back(index);
+            }
+        }
+
+        // Among the passes that may run next, one rendering to the framebuffer
+        // already bound wins, then one that binds none, then declaration order.
+        mOrder.clear();
+        const std::vector<uint32_t>* bound = nullptr;
+        while (!ready.empty())
+        {
+            auto rank = [&](uint32_t index) {
+                const std::vector<uint32_t>& attachments = mPasses[index].mAttachments;
+                uint32_t preference = bound != nullptr && attachments == *bound ? 0 : attachments.empty() ? 1 : 2;
+                return std::make_pair(preference, index);
+            };
+
+            auto next = std::min_element(ready.begin(), ready.end(), [&](uint32_t left, uint32_t right) { return rank(left) < rank(right); });
+            uint32_t index = *next;
+            ready.erase(next);
+
+            mOrder.push_back(index);
+            if (!mPasses[index].mAttachments.empty()) {
+                bound = &mPasses[index].mAttachments;
+            }
+
+            for (uint32_t successor : successors[index]) {
+                if (--pending[successor] == 0) {
+                    ready.push_back(successor);
+                }
+            }
+        }
+
+        std::vector<const Pass*> scheduled;
+        std::vector<const Pass*> declared;
+        for (uint32_t index : mOrder) {
+            scheduled.push_back(&mPasses[index]);
+        }
+        for (const Pass& pass : mPasses) {
+            if (pass.mLive) {
+                declared.push_back(&pass);
+            }
+        }
+        mFramebufferSwitches = mCountSwitches(scheduled);
+        mDeclaredSwitches = mCountSwitches(declared);
+
+        for (VirtualResource& resource : mResources)
+        {
+            resource.mFirstUse = mNONE;
+            resource.mLastUse = mNONE;
+            resource.mPhysical = mNONE;
+        }
+
+        for (uint32_t position = 0; position < mOrder.size(); position++)
+        {
+            for (const Use& use : mPasses[mOrder[position]].mUses)
+            {
+                VirtualResource& resource = mResources[use.mResource];
+                resource.mFirstUse = std::min(resource.mFirstUse, position);
+                resource.mLastUse = resource.mLastUse == mNONE ? position : std::max(resource.mLastUse, position);
+            }
+        }
+    }
+
+    void Graph::mAlias()
+    {
+        mPhysical.clear();
+
+        std::vector<uint32_t> transients;
+        for (uint32_t index = 0; index < mResources.size(); index++) {
+            if (mResources[index].mTransient && mResources[index].mFirstUse != mNONE) {
+                transients.push_back(index);
+            }
+        }
+        std::sort(transients.begin(), transients.end(), [this](uint32_t left, uint32_t right) {
+            return mResources[left].mFirstUse < mResources[right].mFirstUse;
+        });
+
+        for (uint32_t index : transients)
+        {
+            VirtualResource& resource = mResources[index];
+
+            auto free = std::find_if(mPhysical.begin(), mPhysical.end(), [&](const PhysicalTexture& physical) {
+                return physical.mDesc == resource.mDesc && physical.mFreeAfter < resource.mFirstUse;
+            });
+
+            if (free == mPhysical.end())
+            {
+                mPhysical.push_back({ resource.mDesc, mNONE, 0 });
+                free = mPhysical.end() - 1;
+            }
+
+            free->mFreeAfter = resource.mLastUse;
+            resource.mPhysical = static_cast<uint32_t>(free - mPhysical.begin());
+        }
+    }
+
+    void Graph::mPlaceBarriers()
+    {
+        // GL orders framebuffer and sampler access on its own; only image stores
+        // have to be made visible with an explicit barrier before the next use.
+        std::vector<bool> stored(mResources.size(), false);
+
+        for (uint32_t index : mOrder)
+        {
+            Pass& pass = mPasses[index];
+            pass.mBarrier = 0;
+
+            for (const Use& use : pass.mUses)
+            {
+                if (stored[use.mResource])
+                {
+                    pass.mBarrier |= GetBarrier(use.mAccess);
+                    stored[use.mResource] = false;
+                }
+            }
+
+            for (const Use& use : pass.mUses) {
+                if (use.mWrite && use.mAccess == Access::STORAGE) {
+                    stored[use.mResource] = true;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] GLuint Graph::mAcquireTexture(const TextureDesc& desc)
+    {
+        for (PooledTexture& pooled : mPool)
+        {
+            if (!pooled.mTaken && pooled.mDesc == desc)
+            {
+                pooled.mTaken = true;
+                return pooled.mTexture;
+            }
+        }
+
+        const FormatInfo& info = GetFormatInfo(desc.mFormat);
+
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(desc.mFormat),
+            static_cast<GLsizei>(desc.mSize[V2ui32::WIDTH]), static_cast<GLsizei>(desc.mSize[V2ui32::HEIGHT]),
+            0, info.mPixelFormat, info.mPixelType, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        mPool.push_back({ desc, texture, true });
+        return texture;
+    }
+
+    [[nodiscard]] GLuint Graph::mAcquireFramebuffer(const Pass& pass)
+    {
+        if (mResources[pass.mAttachments.front()].mBackbuffer) {
+            return 0;
+        }
+
+        std::vector<GLuint> textures;
+        for (uint32_t attachment : pass.mAttachments) {
+            textures.push_back(mGetTexture(attachment));
+        }
+
+        if (auto it = mFramebuffers.find(textures); it != mFramebuffers.end()) {
+            return it->second;
+        }
+
+        GLuint framebuffer = 0;
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+        std::array<GLenum, MAX_COLOR_ATTACHMENTS> drawBuffers{};
+        GLsizei colors = 0;
+        for (std::size_t i = 0; i < textures.size(); i++)
+        {
+            GLenum format = mResources[pass.mAttachments[i]].mDesc.mFormat;
+            GLenum attachment = GL_COLOR_ATTACHMENT0 + colors;
+            if (format == GL_DEPTH24_STENCIL8) {
+                attachment = GL_DEPTH_STENCIL_ATTACHMENT;
+            } else if (IsDepth(format)) {
+                attachment = GL_DEPTH_ATTACHMENT;
+            } else {
+                drawBuffers[colors++] = attachment;
+            }
+
+            glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, textures[i], 0);
+        }
+
+        if (colors > 0) {
+            glDrawBuffers(colors, drawBuffers.data());
+        } else {
+            glDrawBuffer(GL_NONE);
+        }
+
+        if (GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER); status != GL_FRAMEBUFFER_COMPLETE)
+        {
+            glDeleteFramebuffers(1, &framebuffer);
+            throw GraphException(std::format("Framebuffer for pass \"{}\" is incomplete (0x{:X}).", pass.mName, status));
+        }
+
+        mFramebuffers.emplace(std::move(textures), framebuffer);
+        return framebuffer;
+    }
+
+    [[nodiscard]] GLuint Graph::mGetTexture(uint32_t resource) const
+    {
+        const VirtualResource& virtualResource = mResources[resource];
+        if (!virtualResource.mTransient) {
+            return virtualResource.mImported;
+        }
+        if (virtualResource.mPhysical == mNONE || virtualResource.mPhysical >= mPhysicalTextures.size()) {
+            throw GraphException(std::format("Texture \"{}\" is not allocated, no live pass uses it.", virtualResource.mName));
+        }
+        return mPhysicalTextures[virtualResource.mPhysical];
+    }
+
+    [[nodiscard]] uint32_t Graph::mCountSwitches(const std::vector<const Pass*>& passes)
+    {
+        uint32_t switches = 0;
+        const std::vector<uint32_t>* bound = nullptr;
+
+        for (const Pass* pass : passes)
+        {
+            if (pass->mAttachments.empty()) {
+                continue;
+            }
+            if (bound == nullptr || *bound != pass->mAttachments) {
+                switches++;
+            }
+            bound = &pass->mAttachments;
+        }
+
+        return switches;
+    }
+}
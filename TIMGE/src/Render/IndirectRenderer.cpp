@@ -0,0 +1,495 @@
+#include "TIMGE/Render/IndirectRenderer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <string>
+
+namespace TIMGE::Render
+{
+    namespace
+    {
+        constexpr std::string_view FORWARD_VERTEX = R"(
+            in vec3 aPosition;
+            in vec3 aNormal;
+
+            uniform mat4 uViewProjection;
+            uniform mat4 uModel;
+            uniform vec4 uColor;
+
+            out vec3 vNormal;
+            out vec4 vColor;
+
+            void main()
+            {
+                gl_Position = uViewProjection * uModel * vec4(aPosition, 1.0);
+                vNormal = mat3(uModel) * aNormal;
+                vColor = uColor;
+            }
+        )";
+
+        constexpr std::string_view INDIRECT_VERTEX = R"(
+            layout(location = 0) in vec3 aPosition;
+            layout(location = 1) in vec3 aNormal;
+            layout(location = 2) in uint aObject;
+
+            struct Object
+            {
+                mat4 transform;
+                vec4 color;
+                vec4 sphere;
+                uvec4 mesh;
+            };
+
+            layout(std430, binding = 0) readonly buffer Objects { Object objects[]; };
+
+            uniform mat4 uViewProjection;
+
+            out vec3 vNormal;
+            out vec4 vColor;
+
+            void main()
+            {
+                Object object = objects[aObject];
+                gl_Position = uViewProjection * object.transform * vec4(aPosition, 1.0);
+                vNormal = mat3(object.transform) * aNormal;
+                vColor = object.color;
+            }
+        )";
+
+        constexpr std::string_view FRAGMENT = R"(
+            in vec3 vNormal;
+            in vec4 vColor;
+
+            out vec4 oColor;
+
+            void main()
+            {
+                float diffuse = max(dot(normalize(vNormal), normalize(vec3(0.4, 0.8, 0.45))), 0.0);
+                oColor = vec4(vColor.rgb * (0.25 + 0.75 * diffuse), vColor.a);
+            }
+        )";
+
+        constexpr std::string_view CULL_COMPUTE = R"(
+            layout(local_size_x = 64) in;
+
+            struct Object
+            {
+                mat4 transform;
+                vec4 color;
+                vec4 sphere;
+                uvec4 mesh;
+            };
+
+            layout(std430, binding = 0) readonly buffer Objects { Object objects[]; };
+            layout(std430, binding = 1) buffer Commands { uint commands[]; };
+            layout(std430, binding = 2) writeonly buffer Visible { uint visible[]; };
+
+            uniform vec4 uPlanes[6];
+            uniform uint uObjectCount;
+
+            void main()
+            {
+                uint index = gl_GlobalInvocationID.x;
+                if (index >= uObjectCount) {
+                    return;
+                }
+
+                vec4 sphere = objects[index].sphere;
+                for (int plane = 0; plane < 6; plane++) {
+                    if (dot(uPlanes[plane].xyz, sphere.xyz) + uPlanes[plane].w < -sphere.w) {
+                        return;
+                    }
+                }
+
+                uint mesh = objects[index].mesh.x;
+                uint slot = atomicAdd(commands[mesh * 5u + 1u], 1u);
+                visible[commands[mesh * 5u + 4u] + slot] = index;
+            }
+        )";
+
+        [[nodiscard]] std::string WithVersion(std::string_view version, std::string_view source) {
+            return std::format("#version {}\n{}", version, source);
+        }
+
+        [[nodiscard]] std::string_view GetForwardVersion() {
+            return GLAD_GL_VERSION_3_2 ? "150 core" : "130";
+        }
+
+        void SetupVertexArray(GLuint vertexArray, GLuint vertexBuffer, GLuint indexBuffer)
+        {
+            glBindVertexArray(vertexArray);
+            glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(IndirectRenderer::Vertex), reinterpret_cast<const void*>(offsetof(IndirectRenderer::Vertex, mPosition)));
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(IndirectRenderer::Vertex), reinterpret_cast<const void*>(offsetof(IndirectRenderer::Vertex, mNormal)));
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+        }
+    }
+
+    IndirectRendererException::IndirectRendererException(std::string message)
+     : Exception(std::format("IndirectRenderer: {}", message))
+    {}
+
+    IndirectRenderer::IndirectRenderer()
+     : mGpuSupported{GLAD_GL_VERSION_4_3 != 0},
+       mPath{mGpuSupported ? Path::GPU : Path::CPU},
+       mStatistics{},
+       mVertices{},
+       mIndices{},
+       mMeshes{},
+       mObjects{},
+       mMeshObjects{},
+       mCommands{},
+       mReadbackCommands{},
+       mGeometryDirty{false},
+       mVertexBuffer{},
+       mIndexBuffer{},
+       mVertexArray{},
+       mIndirectVertexArray{},
+       mObjectBuffer{},
+       mCommandBuffer{},
+       mVisibleBuffer{},
+       mReadbackBuffer{},
+       mObjectCapacity{},
+       mCommandCapacity{},
+       mVisibleCapacity{},
+       mReadbackCapacity{},
+       mReadbackFence{nullptr},
+       mGpuVisible{},
+       mForwardShader{
+           {
+               { GL_VERTEX_SHADER, WithVersion(GetForwardVersion(), FORWARD_VERTEX) },
+               { GL_FRAGMENT_SHADER, WithVersion(GetForwardVersion(), FRAGMENT) }
+           },
+           { { 0, "aPosition" }, { 1, "aNormal" } }
+       },
+       mIndirectShader{},
+       mCullShader{}
+    {
+        static_assert(sizeof(Object) == 112, "Object must match the std430 layout used by the shaders.");
+        static_assert(sizeof(DrawCommand) == 5 * sizeof(GLuint), "DrawCommand must match DrawElementsIndirectCommand.");
+
+        glGenBuffers(1, &mVertexBuffer);
+        glGenBuffers(1, &mIndexBuffer);
+        glGenVertexArrays(1, &mVertexArray);
+        SetupVertexArray(mVertexArray, mVertexBuffer, mIndexBuffer);
+
+        if (mGpuSupported)
+        {
+            mIndirectShader.emplace(std::initializer_list<Shader::Stage>{
+                { GL_VERTEX_SHADER, WithVersion("430 core", INDIRECT_VERTEX) },
+                { GL_FRAGMENT_SHADER, WithVersion("430 core", FRAGMENT) }
+            });
+            mCullShader.emplace(std::initializer_list<Shader::Stage>{
+                { GL_COMPUTE_SHADER, WithVersion("430 core", CULL_COMPUTE) }
+            });
+
+            glGenBuffers(1, &mObjectBuffer);
+            glGenBuffers(1, &mCommandBuffer);
+            glGenBuffers(1, &mVisibleBuffer);
+            glGenBuffers(1, &mReadbackBuffer);
+
+            glGenVertexArrays(1, &mIndirectVertexArray);
+            SetupVertexArray(mIndirectVertexArray, mVertexBuffer, mIndexBuffer);
+            glBindBuffer(GL_ARRAY_BUFFER, mVisibleBuffer);
+            glEnableVertexAttribArray(2);
+            glVertexAttribIPointer(2, 1, GL_UNSIGNED_INT, sizeof(GLuint), nullptr);
+            glVertexAttribDivisor(2, 1);
+        }
+
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    IndirectRenderer::~IndirectRenderer()
+    {
+        glDeleteVertexArrays(1, &mVertexArray);
+        glDeleteBuffers(1, &mVertexBuffer);
+        glDeleteBuffers(1, &mIndexBuffer);
+
+        if (mGpuSupported)
+        {
+            glDeleteVertexArrays(1, &mIndirectVertexArray);
+            glDeleteBuffers(1, &mObjectBuffer);
+            glDeleteBuffers(1, &mCommandBuffer);
+            glDeleteBuffers(1, &mVisibleBuffer);
+            glDeleteBuffers(1, &mReadbackBuffer);
+            if (mReadbackFence != nullptr) {
+                glDeleteSync(mReadbackFence);
+            }
+        }
+    }
+
+    [[nodiscard]] uint32_t IndirectRenderer::AddMesh(std::span<const Vertex> vertices, std::span<const uint32_t> indices)
+    {
+        if (vertices.empty() || indices.empty() || indices.size() % 3 != 0) {
+            throw IndirectRendererException("Meshes need vertices and a whole number of triangles.");
+        }
+        if (*std::max_element(indices.begin(), indices.end()) >= vertices.size()) {
+            throw IndirectRendererException("Mesh index out of range.");
+        }
+
+        std::array<float, 3> minimum = vertices[0].mPosition;
+        std::array<float, 3> maximum = vertices[0].mPosition;
+        for (const Vertex& vertex : vertices)
+        {
+            for (std::size_t axis = 0; axis < 3; axis++)
+            {
+                minimum[axis] = std::min(minimum[axis], vertex.mPosition[axis]);
+                maximum[axis] = std::max(maximum[axis], vertex.mPosition[axis]);
+            }
+        }
+
+        Mesh mesh{ static_cast<uint32_t>(mIndices.size()), static_cast<uint32_t>(indices.size()), {}, 0.0f };
+        for (std::size_t axis = 0; axis < 3; axis++) {
+            mesh.mCenter[axis] = 0.5f * (minimum[axis] + maximum[axis]);
+        }
+        for (const Vertex& vertex : vertices)
+        {
+            float dx = vertex.mPosition[0] - mesh.mCenter[0];
+            float dy = vertex.mPosition[1] - mesh.mCenter[1];
+            float dz = vertex.mPosition[2] - mesh.mCenter[2];
+            mesh.mRadius = std::max(mesh.mRadius, std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+
+        // Indices are stored already offset into the shared vertex buffer, so no
+        // draw needs a base vertex and GL 3.0 contexts can use the same data.
+        uint32_t baseVertex = static_cast<uint32_t>(mVertices.size());
+        for (uint32_t index : indices) {
+            mIndices.push_back(baseVertex + index);
+        }
+        mVertices.insert(mVertices.end(), vertices.begin(), vertices.end());
+
+        mMeshes.push_back(mesh);
+        mGeometryDirty = true;
+
+        return static_cast<uint32_t>(mMeshes.size() - 1);
+    }
+
+    void IndirectRenderer::Submit(uint32_t mesh, const Mat4& transform, const V4f& color)
+    {
+        if (mesh >= mMeshes.size()) {
+            throw IndirectRendererException(std::format("Mesh {} does not exist.", mesh));
+        }
+
+        const Mesh& source = mMeshes[mesh];
+
+        Object object;
+        object.mTransform = transform;
+        object.mColor = { color[V4f::R], color[V4f::G], color[V4f::B], color[V4f::A] };
+        object.mMesh = { mesh, 0, 0, 0 };
+
+        float scale = 0.0f;
+        for (std::size_t column = 0; column < 3; column++)
+        {
+            float x = transform[column * 4 + 0];
+            float y = transform[column * 4 + 1];
+            float z = transform[column * 4 + 2];
+            scale = std::max(scale, x * x + y * y + z * z);
+        }
+
+        for (std::size_t row = 0; row < 3; row++)
+        {
+            object.mSphere[row] = transform[12 + row]
+                + transform[row] * source.mCenter[0]
+                + transform[4 + row] * source.mCenter[1]
+                + transform[8 + row] * source.mCenter[2];
+        }
+        object.mSphere[3] = source.mRadius * std::sqrt(scale);
+
+        mObjects.push_back(object);
+    }
+
+    void IndirectRenderer::Render(const Mat4& viewProjection)
+    {
+        mStatistics = { static_cast<uint32_t>(mObjects.size()), 0, 0 };
+        if (mObjects.empty()) {
+            return;
+        }
+
+        if (mGeometryDirty) {
+            mUploadGeometry();
+        }
+
+        if (mPath == Path::GPU) {
+            mRenderGpu(viewProjection);
+        } else {
+            mRenderCpu(viewProjection);
+        }
+
+        glBindVertexArray(0);
+        glUseProgram(0);
+
+        mObjects.clear();
+    }
+
+    void IndirectRenderer::SetPath(Path path)
+    {
+        if (path == Path::GPU && !mGpuSupported) {
+            throw IndirectRendererException("GPU driven drawing needs an OpenGL 4.3 context.");
+        }
+        mPath = path;
+    }
+
+    [[nodiscard]] IndirectRenderer::Path IndirectRenderer::GetPath() const {
+        return mPath;
+    }
+
+    [[nodiscard]] bool IndirectRenderer::IsGpuSupported() const {
+        return mGpuSupported;
+    }
+
+    [[nodiscard]] std::size_t IndirectRenderer::GetMeshCount() const {
+        return mMeshes.size();
+    }
+
+    [[nodiscard]] const IndirectRenderer::Statistics& IndirectRenderer::GetStatistics() const {
+        return mStatistics;
+    }
+
+    void IndirectRenderer::mRenderGpu(const Mat4& viewProjection)
+    {
+        mCollectVisible();
+
+        // Every mesh owns a contiguous range of the visible list, sized for all of
+        // its objects; the cull shader fills the front of it and the instance count.
+        mMeshObjects.assign(mMeshes.size(), 0);
+        for (const Object& object : mObjects) {
+            mMeshObjects[object.mMesh[0]]++;
+        }
+
+        mCommands.resize(mMeshes.size());
+        GLuint baseInstance = 0;
+        for (std::size_t mesh = 0; mesh < mMeshes.size(); mesh++)
+        {
+            mCommands[mesh] = { mMeshes[mesh].mIndexCount, 0, mMeshes[mesh].mFirstIndex, 0, baseInstance };
+            baseInstance += mMeshObjects[mesh];
+        }
+
+        mReserve(GL_SHADER_STORAGE_BUFFER, mObjectBuffer, mObjectCapacity, mObjects.size() * sizeof(Object));
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, mObjects.size() * sizeof(Object), mObjects.data());
+
+        mReserve(GL_SHADER_STORAGE_BUFFER, mCommandBuffer, mCommandCapacity, mCommands.size() * sizeof(DrawCommand));
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, mCommands.size() * sizeof(DrawCommand), mCommands.data());
+
+        mReserve(GL_SHADER_STORAGE_BUFFER, mVisibleBuffer, mVisibleCapacity, mObjects.size() * sizeof(GLuint));
+
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, mObjectBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, mCommandBuffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, mVisibleBuffer);
+
+        Frustum frustum(viewProjection);
+        std::array<float, 4 * Frustum::PLANE_COUNT> planes;
+        for (int plane = 0; plane < Frustum::PLANE_COUNT; plane++) {
+            std::copy_n(frustum.GetPlane(static_cast<Frustum::Plane>(plane)).begin(), 4, planes.begin() + plane * 4);
+        }
+
+        mCullShader->Use();
+        glUniform4fv(mCullShader->GetUniformLocation("uPlanes"), Frustum::PLANE_COUNT, planes.data());
+        glUniform1ui(mCullShader->GetUniformLocation("uObjectCount"), static_cast<GLuint>(mObjects.size()));
+        glDispatchCompute((static_cast<GLuint>(mObjects.size()) + mCULL_GROUP_SIZE - 1) / mCULL_GROUP_SIZE, 1, 1);
+
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+
+        mIndirectShader->Use();
+        glUniformMatrix4fv(mIndirectShader->GetUniformLocation("uViewProjection"), 1, GL_FALSE, viewProjection.data());
+
+        glBindVertexArray(mIndirectVertexArray);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandBuffer);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(mCommands.size()), 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+        // The culled commands are copied aside and fenced; mCollectVisible reads
+        // them once the fence has passed, so counting never stalls the pipeline.
+        if (mReadbackFence == nullptr)
+        {
+            std::size_t size = mCommands.size() * sizeof(DrawCommand);
+            mReserve(GL_COPY_WRITE_BUFFER, mReadbackBuffer, mReadbackCapacity, size);
+            glBindBuffer(GL_COPY_READ_BUFFER, mCommandBuffer);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(size));
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+            mReadbackCommands.resize(mCommands.size());
+            mReadbackFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+
+        mStatistics.mVisible = mGpuVisible;
+        mStatistics.mDrawCalls = 1;
+    }
+
+    void IndirectRenderer::mRenderCpu(const Mat4& viewProjection)
+    {
+        Frustum frustum(viewProjection);
+
+        mForwardShader.Use();
+        glUniformMatrix4fv(mForwardShader.GetUniformLocation("uViewProjection"), 1, GL_FALSE, viewProjection.data());
+        GLint model = mForwardShader.GetUniformLocation("uModel");
+        GLint color = mForwardShader.GetUniformLocation("uColor");
+
+        glBindVertexArray(mVertexArray);
+
+        for (const Object& object : mObjects)
+        {
+            if (!frustum.Intersects({ object.mSphere[0], object.mSphere[1], object.mSphere[2] }, object.mSphere[3])) {
+                continue;
+            }
+
+            const Mesh& mesh = mMeshes[object.mMesh[0]];
+            glUniformMatrix4fv(model, 1, GL_FALSE, object.mTransform.data());
+            glUniform4fv(color, 1, object.mColor.data());
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mesh.mIndexCount), GL_UNSIGNED_INT,
+                reinterpret_cast<const void*>(static_cast<std::size_t>(mesh.mFirstIndex) * sizeof(uint32_t)));
+
+            mStatistics.mVisible++;
+            mStatistics.mDrawCalls++;
+        }
+    }
+
+    void IndirectRenderer::mCollectVisible()
+    {
+        if (mReadbackFence == nullptr) {
+            return;
+        }
+
+        GLenum status = glClientWaitSync(mReadbackFence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            return;
+        }
+        glDeleteSync(mReadbackFence);
+        mReadbackFence = nullptr;
+
+        glBindBuffer(GL_COPY_READ_BUFFER, mReadbackBuffer);
+        glGetBufferSubData(GL_COPY_READ_BUFFER, 0, static_cast<GLsizeiptr>(mReadbackCommands.size() * sizeof(DrawCommand)), mReadbackCommands.data());
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+        mGpuVisible = 0;
+        for (const DrawCommand& command : mReadbackCommands) {
+            mGpuVisible += command.mInstanceCount;
+        }
+    }
+
+    void IndirectRenderer::mUploadGeometry()
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, mVertices.size() * sizeof(Vertex), mVertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        glBindVertexArray(mVertexArray);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndices.size() * sizeof(uint32_t), mIndices.data(), GL_STATIC_DRAW);
+        glBindVertexArray(0);
+
+        mGeometryDirty = false;
+    }
+
+    void IndirectRenderer::mReserve(GLenum target, GLuint buffer, std::size_t& capacity, std::size_t size)
+    {
+        // The whole store is respecified every frame so the driver can hand out
+        // fresh memory instead of waiting for the previous frame to finish.
+        capacity = std::max(capacity, size);
+        glBindBuffer(target, buffer);
+        glBufferData(target, static_cast<GLsizeiptr>(capacity), nullptr, GL_DYNAMIC_DRAW);
+    }
+}
@@ -0,0 +1,493 @@
+#include "TIMGE/Render/Particles.hpp"
+#include "TIMGE/Utils/SIMD.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <string>
+
+namespace TIMGE::Render
+{
+    namespace
+    {
+        constexpr std::string_view PARTICLE_VERTEX = R"(
+            in vec2 aCorner;
+            in vec4 aParticle;
+            in vec4 aColor;
+
+            uniform mat4 uView;
+            uniform mat4 uProjection;
+
+            out vec2 vCorner;
+            out vec4 vColor;
+
+            void main()
+            {
+                vec3 right = vec3(uView[0][0], uView[1][0], uView[2][0]);
+                vec3 up = vec3(uView[0][1], uView[1][1], uView[2][1]);
+                vec3 position = aParticle.xyz + (right * aCorner.x + up * aCorner.y) * aParticle.w;
+
+                gl_Position = uProjection * uView * vec4(position, 1.0);
+                vCorner = aCorner;
+                vColor = aColor;
+            }
+        )";
+
+        constexpr std::string_view PARTICLE_FRAGMENT = R"(
+            in vec2 vCorner;
+            in vec4 vColor;
+
+            out vec4 oColor;
+
+            void main()
+            {
+                float falloff = 1.0 - smoothstep(0.25, 0.5, length(vCorner));
+                oColor = vec4(vColor.rgb, vColor.a * falloff);
+            }
+        )";
+
+        constexpr std::array<float, 8> QUAD = {
+            -0.5f, -0.5f,
+             0.5f, -0.5f,
+            -0.5f,  0.5f,
+             0.5f,  0.5f
+        };
+
+        // Runs while ParticleRenderer builds its shader, so an old context is
+        // reported before compilation fails on the version line.
+        [[nodiscard]] std::string WithVersion(std::string_view source)
+        {
+            if (!GLAD_GL_VERSION_3_3) {
+                throw ParticlesException("Instanced particles need an OpenGL 3.3 context.");
+            }
+            return std::format("#version 330 core\n{}", source);
+        }
+
+        void Validate(const EmitterInfo& info)
+        {
+            if (info.mCapacity == 0) {
+                throw ParticlesException("Emitters need room for at least one particle.");
+            }
+            if (info.mMinLifetime <= 0.0f || info.mMaxLifetime < info.mMinLifetime) {
+                throw ParticlesException("Lifetimes must be positive and the maximum must not be below the minimum.");
+            }
+        }
+
+        [[nodiscard]] uint8_t ToUnorm8(float value) {
+            return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+    }
+
+    ParticlesException::ParticlesException(std::string message)
+     : Exception(std::format("Particles: {}", message))
+    {}
+
+    ParticleSystem::ParticleSystem()
+     : mEmitters{},
+       mChunks{},
+       mInstances{},
+       mStatistics{},
+       mEmitted{}
+    {}
+
+    [[maybe_unused]] uint32_t ParticleSystem::CreateEmitter(const EmitterInfo& info)
+    {
+        Validate(info);
+
+        Emitter& emitter = mEmitters.emplace_back();
+        emitter.mInfo = info;
+        emitter.mCount = 0;
+        emitter.mAccumulator = 0.0f;
+        emitter.mRandom.seed(static_cast<uint32_t>(mEmitters.size()));
+        mResize(emitter);
+
+        return static_cast<uint32_t>(mEmitters.size() - 1);
+    }
+
+    void ParticleSystem::SetEmitter(uint32_t emitter, const EmitterInfo& info)
+    {
+        Validate(info);
+
+        Emitter& target = mGetEmitter(emitter);
+        target.mInfo = info;
+        mResize(target);
+    }
+
+    void ParticleSystem::Emit(uint32_t emitter, uint32_t count) {
+        mEmitted += mSpawn(mGetEmitter(emitter), count);
+    }
+
+    void ParticleSystem::Clear()
+    {
+        for (Emitter& emitter : mEmitters)
+        {
+            std::fill(emitter.mChunkCounts.begin(), emitter.mChunkCounts.end(), 0);
+            emitter.mCount = 0;
+            emitter.mAccumulator = 0.0f;
+        }
+
+        mChunks.clear();
+        mInstances.clear();
+        mStatistics = {};
+        mEmitted = 0;
+    }
+
+    void ParticleSystem::Update(float timestep, JobSystem& jobSystem)
+    {
+        mBeginUpdate(timestep);
+
+        jobSystem.ParallelFor(static_cast<uint32_t>(mChunks.size()), 1, [this, timestep](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t i = begin; i < end; i++) {
+                mSimulate(mChunks[i], timestep);
+            }
+        });
+
+        mEndSimulate();
+
+        jobSystem.ParallelFor(static_cast<uint32_t>(mChunks.size()), 1, [this](uint32_t begin, uint32_t end, uint32_t) {
+            for (uint32_t i = begin; i < end; i++) {
+                mPack(mChunks[i]);
+            }
+        });
+    }
+
+    void ParticleSystem::Update(float timestep)
+    {
+        mBeginUpdate(timestep);
+
+        for (Chunk& chunk : mChunks) {
+            mSimulate(chunk, timestep);
+        }
+
+        mEndSimulate();
+
+        for (const Chunk& chunk : mChunks) {
+            mPack(chunk);
+        }
+    }
+
+    [[nodiscard]] const EmitterInfo& ParticleSystem::GetEmitter(uint32_t emitter) const
+    {
+        if (emitter >= mEmitters.size()) {
+            throw ParticlesException(std::format("Emitter {} does not exist.", emitter));
+        }
+        return mEmitters[emitter].mInfo;
+    }
+
+    [[nodiscard]] std::size_t ParticleSystem::GetEmitterCount() const {
+        return mEmitters.size();
+    }
+
+    [[nodiscard]] std::size_t ParticleSystem::GetParticleCount() const
+    {
+        std::size_t count = 0;
+        for (const Emitter& emitter : mEmitters) {
+            count += emitter.mCount;
+        }
+        return count;
+    }
+
+    [[nodiscard]] std::span<const ParticleInstance> ParticleSystem::GetInstances() const {
+        return mInstances;
+    }
+
+    [[nodiscard]] const ParticleSystem::Statistics& ParticleSystem::GetStatistics() const {
+        return mStatistics;
+    }
+
+    [[nodiscard]] ParticleSystem::Emitter& ParticleSystem::mGetEmitter(uint32_t emitter)
+    {
+        if (emitter >= mEmitters.size()) {
+            throw ParticlesException(std::format("Emitter {} does not exist.", emitter));
+        }
+        return mEmitters[emitter];
+    }
+
+    [[nodiscard]] uint32_t ParticleSystem::mGetChunkCapacity(const Emitter& emitter, std::size_t chunk) const {
+        return std::min(CHUNK_SIZE, emitter.mInfo.mCapacity - static_cast<uint32_t>(chunk) * CHUNK_SIZE);
+    }
+
+    void ParticleSystem::mResize(Emitter& emitter)
+    {
+        std::size_t chunkCount = (emitter.mInfo.mCapacity + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        for (std::vector<float>& field : emitter.mFields) {
+            field.resize(chunkCount * CHUNK_SIZE);
+        }
+        emitter.mChunkCounts.resize(chunkCount, 0);
+
+        emitter.mCount = 0;
+        for (std::size_t chunk = 0; chunk < chunkCount; chunk++)
+        {
+            emitter.mChunkCounts[chunk] = std::min(emitter.mChunkCounts[chunk], mGetChunkCapacity(emitter, chunk));
+            emitter.mCount += emitter.mChunkCounts[chunk];
+        }
+    }
+
+    uint32_t ParticleSystem::mSpawn(Emitter& emitter, uint32_t count)
+    {
+        const EmitterInfo& info = emitter.mInfo;
+        std::uniform_real_distribution<float> spread(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> lifetime(info.mMinLifetime, info.mMaxLifetime);
+
+        uint32_t spawned = 0;
+        for (std::size_t chunk = 0; chunk < emitter.mChunkCounts.size() && spawned < count; chunk++)
+        {
+            uint32_t& chunkCount = emitter.mChunkCounts[chunk];
+            uint32_t room = std::min(mGetChunkCapacity(emitter, chunk) - chunkCount, count - spawned);
+
+            for (uint32_t i = 0; i < room; i++)
+            {
+                std::size_t slot = chunk * CHUNK_SIZE + chunkCount + i;
+                auto& fields = emitter.mFields;
+
+                fields[POSITION_X][slot] = info.mPosition[0];
+                fields[POSITION_Y][slot] = info.mPosition[1];
+                fields[POSITION_Z][slot] = info.mPosition[2];
+                fields[VELOCITY_X][slot] = info.mVelocity[0] + spread(emitter.mRandom) * info.mVelocitySpread[0];
+                fields[VELOCITY_Y][slot] = info.mVelocity[1] + spread(emitter.mRandom) * info.mVelocitySpread[1];
+                fields[VELOCITY_Z][slot] = info.mVelocity[2] + spread(emitter.mRandom) * info.mVelocitySpread[2];
+                fields[AGE][slot] = 0.0f;
+                fields[INVERSE_LIFETIME][slot] = 1.0f / lifetime(emitter.mRandom);
+                fields[SIZE][slot] = info.mStartSize;
+                fields[RED][slot] = info.mStartColor[V4f::R];
+                fields[GREEN][slot] = info.mStartColor[V4f::G];
+                fields[BLUE][slot] = info.mStartColor[V4f::B];
+                fields[ALPHA][slot] = info.mStartColor[V4f::A];
+            }
+
+            chunkCount += room;
+            spawned += room;
+        }
+
+        emitter.mCount += spawned;
+        return spawned;
+    }
+
+    void ParticleSystem::mBeginUpdate(float timestep)
+    {
+        uint32_t spawned = mEmitted;
+        mEmitted = 0;
+
+        mChunks.clear();
+        for (uint32_t index = 0; index < mEmitters.size(); index++)
+        {
+            Emitter& emitter = mEmitters[index];
+
+            emitter.mAccumulator += emitter.mInfo.mRate * timestep;
+            float whole = std::floor(emitter.mAccumulator);
+            emitter.mAccumulator -= whole;
+            spawned += mSpawn(emitter, static_cast<uint32_t>(whole));
+
+            for (uint32_t chunk = 0; chunk < emitter.mChunkCounts.size(); chunk++) {
+                if (emitter.mChunkCounts[chunk] != 0) {
+                    mChunks.push_back({ index, chunk, emitter.mChunkCounts[chunk], 0, 0 });
+                }
+            }
+        }
+
+        mStatistics.mSpawned = spawned;
+    }
+
+    void ParticleSystem::mSimulate(Chunk& chunk, float timestep)
+    {
+        static constexpr uint32_t BATCH_SIZE = static_cast<uint32_t>(Float8::WIDTH);
+
+        Emitter& emitter = mEmitters[chunk.mEmitter];
+        const EmitterInfo& info = emitter.mInfo;
+
+        std::array<float*, FIELD_COUNT> fields;
+        for (std::size_t field = 0; field < FIELD_COUNT; field++) {
+            fields[field] = emitter.mFields[field].data() + static_cast<std::size_t>(chunk.mIndex) * CHUNK_SIZE;
+        }
+
+        Float8 step(timestep);
+        Float8 one(1.0f);
+        Float8 damping(std::max(0.0f, 1.0f - info.mDrag * timestep));
+        Float8 accelerationX(info.mAcceleration[0] * timestep);
+        Float8 accelerationY(info.mAcceleration[1] * timestep);
+        Float8 accelerationZ(info.mAcceleration[2] * timestep);
+        Float8 startSize(info.mStartSize);
+        Float8 deltaSize(info.mEndSize - info.mStartSize);
+
+        std::array<Float8, 4> startColor;
+        std::array<Float8, 4> deltaColor;
+        for (std::size_t channel = 0; channel < 4; channel++)
+        {
+            startColor[channel] = info.mStartColor[channel];
+            deltaColor[channel] = info.mEndColor[channel] - info.mStartColor[channel];
+        }
+
+        // Lanes past mCount run on stale slots, which is harmless: slots are
+        // always allocated in whole chunks and the compaction below never reads
+        // their liveness bits.
+        std::array<uint8_t, CHUNK_SIZE / BATCH_SIZE> alive;
+        for (uint32_t batch = 0; batch * BATCH_SIZE < chunk.mCount; batch++)
+        {
+            uint32_t i = batch * BATCH_SIZE;
+
+            Float8 velocityX = (Float8::Load(fields[VELOCITY_X] + i) + accelerationX) * damping;
+            Float8 velocityY = (Float8::Load(fields[VELOCITY_Y] + i) + accelerationY) * damping;
+            Float8 velocityZ = (Float8::Load(fields[VELOCITY_Z] + i) + accelerationZ) * damping;
+            velocityX.Store(fields[VELOCITY_X] + i);
+            velocityY.Store(fields[VELOCITY_Y] + i);
+            velocityZ.Store(fields[VELOCITY_Z] + i);
+
+            (Float8::Load(fields[POSITION_X] + i) + velocityX * step).Store(fields[POSITION_X] + i);
+            (Float8::Load(fields[POSITION_Y] + i) + velocityY * step).Store(fields[POSITION_Y] + i);
+            (Float8::Load(fields[POSITION_Z] + i) + velocityZ * step).Store(fields[POSITION_Z] + i);
+
+            Float8 age = Float8::Load(fields[AGE] + i) + step;
+            age.Store(fields[AGE] + i);
+
+            Float8 life = age * Float8::Load(fields[INVERSE_LIFETIME] + i);
+            alive[batch] = static_cast<uint8_t>(Float8::LessMask(life, one));
+            life = Float8::Min(life, one);
+
+            (startSize + deltaSize * life).Store(fields[SIZE] + i);
+            (startColor[0] + deltaColor[0] * life).Store(fields[RED] + i);
+            (startColor[1] + deltaColor[1] * life).Store(fields[GREEN] + i);
+            (startColor[2] + deltaColor[2] * life).Store(fields[BLUE] + i);
+            (startColor[3] + deltaColor[3] * life).Store(fields[ALPHA] + i);
+        }
+
+        // Everything before the first batch with a death is already in place.
+        // From there each particle is copied to the write cursor, which only
+        // advances past live ones, so the dead are dropped without a branch.
+        uint32_t first = 0;
+        while (first < chunk.mCount && alive[first / BATCH_SIZE] == 0xFF) {
+            first += BATCH_SIZE;
+        }
+        first = std::min(first, chunk.mCount);
+
+        uint32_t cursor = first;
+        for (float* field : fields)
+        {
+            cursor = first;
+            for (uint32_t i = first; i < chunk.mCount; i++)
+            {
+                field[cursor] = field[i];
+                cursor += (alive[i / BATCH_SIZE] >> (i % BATCH_SIZE)) & 1u;
+            }
+        }
+
+        chunk.mAlive = cursor;
+    }
+
+    void ParticleSystem::mEndSimulate()
+    {
+        uint32_t instance = 0;
+        uint32_t died = 0;
+
+        for (Chunk& chunk : mChunks)
+        {
+            Emitter& emitter = mEmitters[chunk.mEmitter];
+            emitter.mChunkCounts[chunk.mIndex] = chunk.mAlive;
+            emitter.mCount -= chunk.mCount - chunk.mAlive;
+
+            died += chunk.mCount - chunk.mAlive;
+            chunk.mInstance = instance;
+            instance += chunk.mAlive;
+        }
+
+        mInstances.resize(instance);
+        mStatistics.mAlive = instance;
+        mStatistics.mDied = died;
+    }
+
+    void ParticleSystem::mPack(const Chunk& chunk)
+    {
+        const Emitter& emitter = mEmitters[chunk.mEmitter];
+        std::size_t base = static_cast<std::size_t>(chunk.mIndex) * CHUNK_SIZE;
+
+        for (uint32_t i = 0; i < chunk.mAlive; i++)
+        {
+            std::size_t slot = base + i;
+            const auto& fields = emitter.mFields;
+
+            mInstances[chunk.mInstance + i] = {
+                { fields[POSITION_X][slot], fields[POSITION_Y][slot], fields[POSITION_Z][slot] },
+                fields[SIZE][slot],
+                { ToUnorm8(fields[RED][slot]), ToUnorm8(fields[GREEN][slot]), ToUnorm8(fields[BLUE][slot]), ToUnorm8(fields[ALPHA][slot]) }
+            };
+        }
+    }
+
+    ParticleRenderer::ParticleRenderer()
+     : mQuadBuffer{},
+       mInstanceBuffer{},
+       mVertexArray{},
+       mShader{
+           {
+               { GL_VERTEX_SHADER, WithVersion(PARTICLE_VERTEX) },
+               { GL_FRAGMENT_SHADER, WithVersion(PARTICLE_FRAGMENT) }
+           },
+           { { 0, "aCorner" }, { 1, "aParticle" }, { 2, "aColor" } }
+       },
+       mViewLocation{mShader.GetUniformLocation("uView")},
+       mProjectionLocation{mShader.GetUniformLocation("uProjection")}
+    {
+        static_assert(sizeof(ParticleInstance) == 20, "ParticleInstance must stay tightly packed for the instance buffer.");
+
+        glGenBuffers(1, &mQuadBuffer);
+        glGenBuffers(1, &mInstanceBuffer);
+        glGenVertexArrays(1, &mVertexArray);
+
+        glBindVertexArray(mVertexArray);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mQuadBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(QUAD), QUAD.data(), GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(ParticleInstance), reinterpret_cast<const void*>(offsetof(ParticleInstance, mPosition)));
+        glVertexAttribDivisor(1, 1);
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ParticleInstance), reinterpret_cast<const void*>(offsetof(ParticleInstance, mColor)));
+        glVertexAttribDivisor(2, 1);
+
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    ParticleRenderer::~ParticleRenderer()
+    {
+        glDeleteVertexArrays(1, &mVertexArray);
+        glDeleteBuffers(1, &mQuadBuffer);
+        glDeleteBuffers(1, &mInstanceBuffer);
+    }
+
+    void ParticleRenderer::Render(const ParticleSystem& system, const Mat4& view, const Mat4& projection)
+    {
+        std::span<const ParticleInstance> instances = system.GetInstances();
+        if (instances.empty()) {
+            return;
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(instances.size_bytes()), instances.data(), GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        GLboolean blend = glIsEnabled(GL_BLEND);
+        GLboolean depthMask;
+        glGetBooleanv(GL_DEPTH_WRITEMASK, &depthMask);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glDepthMask(GL_FALSE);
+
+        mShader.Use();
+        glUniformMatrix4fv(mViewLocation, 1, GL_FALSE, view.data());
+        glUniformMatrix4fv(mProjectionLocation, 1, GL_FALSE, projection.data());
+
+        glBindVertexArray(mVertexArray);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(instances.size()));
+        glBindVertexArray(0);
+        glUseProgram(0);
+
+        glDepthMask(depthMask);
+        if (!blend) {
+            glDisable(GL_BLEND);
+        }
+    }
+}
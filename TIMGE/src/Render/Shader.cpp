@@ -0,0 +1,110 @@
+#include "TIMGE/Render/Shader.hpp"
+
+#include <algorithm>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace TIMGE::Render
+{
+    ShaderException::ShaderException(std::string message)
+     : Exception(std::format("Shader: {}", message))
+    {}
+
+    Shader::Shader(std::initializer_list<Stage> stages, std::initializer_list<Attribute> attributes)
+     : mProgram{glCreateProgram()}
+    {
+        std::vector<GLuint> shaders;
+        try
+        {
+            for (const Stage& stage : stages)
+            {
+                shaders.push_back(mCompile(stage));
+                glAttachShader(mProgram, shaders.back());
+            }
+        }
+        catch (...)
+        {
+            for (GLuint shader : shaders) {
+                glDeleteShader(shader);
+            }
+            glDeleteProgram(mProgram);
+            throw;
+        }
+
+        for (const Attribute& attribute : attributes) {
+            glBindAttribLocation(mProgram, attribute.mLocation, attribute.mName);
+        }
+
+        glLinkProgram(mProgram);
+
+        for (GLuint shader : shaders)
+        {
+            glDetachShader(mProgram, shader);
+            glDeleteShader(shader);
+        }
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(mProgram, GL_LINK_STATUS, &linked);
+        if (linked == GL_FALSE)
+        {
+            GLint length = 0;
+            glGetProgramiv(mProgram, GL_INFO_LOG_LENGTH, &length);
+            std::string log(static_cast<std::size_t>(std::max(length, 1)), '\0');
+            glGetProgramInfoLog(mProgram, length, nullptr, log.data());
+
+            glDeleteProgram(mProgram);
+            throw ShaderException(std::format("Failed to link program: {}", log.c_str()));
+        }
+    }
+
+    Shader::Shader(Shader&& shader) noexcept
+     : mProgram{shader.mProgram}
+    {
+        shader.mProgram = 0;
+    }
+
+    Shader::~Shader()
+    {
+        if (mProgram != 0) {
+            glDeleteProgram(mProgram);
+        }
+    }
+
+    void Shader::Use() const {
+        glUseProgram(mProgram);
+    }
+
+    [[nodiscard]] GLuint Shader::GetProgram() const {
+        return mProgram;
+    }
+
+    [[nodiscard]] GLint Shader::GetUniformLocation(const char* name) const {
+        return glGetUniformLocation(mProgram, name);
+    }
+
+    [[nodiscard]] GLuint Shader::mCompile(const Stage& stage)
+    {
+        GLuint shader = glCreateShader(stage.mType);
+
+        const GLchar* source = stage.mSource.data();
+        GLint length = static_cast<GLint>(stage.mSource.size());
+        glShaderSource(shader, 1, &source, &length);
+        glCompileShader(shader);
+
+        GLint compiled = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+        if (compiled == GL_FALSE)
+        {
+            GLint logLength = 0;
+            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &logLength);
+            std::string log(static_cast<std::size_t>(std::max(logLength, 1)), '\0');
+            glGetShaderInfoLog(shader, logLength, nullptr, log.data());
+
+            glDeleteShader(shader);
+            throw ShaderException(std::format("Failed to compile stage 0x{:X}: {}", stage.mType, log.c_str()));
+        }
+
+        return shader;
+    }
+}
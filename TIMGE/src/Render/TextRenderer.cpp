@@ -0,0 +1,588 @@
+#include "TIMGE/Render/TextRenderer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+
+// Kept static so it cannot clash with the copy inside ImGui, which leaves most
+// of the library unused in this translation unit.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#elif defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4505)
+#endif
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imstb_truetype.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace TIMGE::Render
+{
+    namespace
+    {
+        constexpr std::string_view VERTEX = R"(
+            in vec2 aPosition;
+            in vec2 aUV;
+            in vec4 aColor;
+
+            uniform vec2 uScreen;
+
+            out vec2 vUV;
+            out vec4 vColor;
+
+            void main()
+            {
+                gl_Position = vec4(aPosition.x / uScreen.x * 2.0 - 1.0, 1.0 - aPosition.y / uScreen.y * 2.0, 0.0, 1.0);
+                vUV = aUV;
+                vColor = aColor;
+            }
+        )";
+
+        constexpr std::string_view FRAGMENT = R"(
+            in vec2 vUV;
+            in vec4 vColor;
+
+            uniform sampler2D uAtlas;
+
+            out vec4 oColor;
+
+            void main()
+            {
+                float distance = texture(uAtlas, vUV).r;
+                float width = max(fwidth(distance), 0.0001);
+                oColor = vec4(vColor.rgb, vColor.a * smoothstep(0.5 - width, 0.5 + width, distance));
+            }
+        )";
+
+        constexpr unsigned char SDF_ON_EDGE = 128;
+        constexpr uint32_t PRUNE_INTERVAL = 60;
+
+        [[nodiscard]] std::string WithVersion(std::string_view source) {
+            return std::format("#version {}\n{}", GLAD_GL_VERSION_3_2 ? "150 core" : "130", source);
+        }
+
+        [[nodiscard]] char32_t DecodeUtf8(std::string_view text, std::size_t& index)
+        {
+            static constexpr char32_t REPLACEMENT = 0xFFFD;
+
+            unsigned char lead = static_cast<unsigned char>(text[index++]);
+            if (lead < 0x80) {
+                return lead;
+            }
+
+            std::size_t length = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+            if (length == 0 || index + length > text.size()) {
+                return REPLACEMENT;
+            }
+
+            char32_t codepoint = lead & (0x3F >> length);
+            for (std::size_t i = 0; i < length; i++)
+            {
+                unsigned char continuation = static_cast<unsigned char>(text[index]);
+                if ((continuation & 0xC0) != 0x80) {
+                    return REPLACEMENT;
+                }
+                codepoint = codepoint << 6 | (continuation & 0x3F);
+                index++;
+            }
+
+            return codepoint;
+        }
+
+        struct StringHash
+        {
+            using is_transparent = void;
+
+            [[nodiscard]] std::size_t operator()(std::string_view text) const {
+                return std::hash<std::string_view>{}(text);
+            }
+        };
+    }
+
+    struct TextRenderer::Font
+    {
+        struct Glyph
+        {
+            uint32_t mIndex;
+            float mAdvance;
+            bool mEmpty;
+        };
+
+        std::vector<uint8_t> mData;
+        stbtt_fontinfo mInfo;
+        float mScale;
+        float mAscent;
+        float mDescent;
+        float mLineHeight;
+        std::unordered_map<char32_t, Glyph> mGlyphs;
+        std::unordered_map<std::string, Run, StringHash, std::equal_to<>> mRuns;
+    };
+
+    TextRendererException::TextRendererException(std::string message)
+     : Exception(std::format("TextRenderer: {}", message))
+    {}
+
+    TextRenderer::TextRenderer(uint32_t atlasSize)
+     : mAtlasSize{atlasSize},
+       mCellsPerRow{atlasSize / CELL_SIZE},
+       mCells{},
+       mGlyphCells{},
+       mHead{mNONE},
+       mTail{mNONE},
+       mUsedCells{0},
+       mGeneration{1},
+       mFrame{0},
+       mFonts{},
+       mVertices{},
+       mScratch{},
+       mStatistics{},
+       mFrameStatistics{},
+       mAtlas{},
+       mVertexBuffer{},
+       mVertexArray{},
+       mShader{
+           {
+               { GL_VERTEX_SHADER, WithVersion(VERTEX) },
+               { GL_FRAGMENT_SHADER, WithVersion(FRAGMENT) }
+           },
+           { { 0, "aPosition" }, { 1, "aUV" }, { 2, "aColor" } }
+       }
+    {
+        if (mCellsPerRow == 0) {
+            throw TextRendererException(std::format("Atlas size must be at least {} pixels.", CELL_SIZE));
+        }
+        mCells.resize(mCellsPerRow * mCellsPerRow);
+
+        glGenTextures(1, &mAtlas);
+        glBindTexture(GL_TEXTURE_2D, mAtlas);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, static_cast<GLsizei>(mAtlasSize), static_cast<GLsizei>(mAtlasSize), 0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glGenBuffers(1, &mVertexBuffer);
+        glGenVertexArrays(1, &mVertexArray);
+        glBindVertexArray(mVertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), reinterpret_cast<const void*>(offsetof(TextVertex, mX)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), reinterpret_cast<const void*>(offsetof(TextVertex, mU)));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(TextVertex), reinterpret_cast<const void*>(offsetof(TextVertex, mColor)));
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    TextRenderer::~TextRenderer()
+    {
+        glDeleteVertexArrays(1, &mVertexArray);
+        glDeleteBuffers(1, &mVertexBuffer);
+        glDeleteTextures(1, &mAtlas);
+    }
+
+    [[maybe_unused]] uint32_t TextRenderer::LoadFont(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw TextRendererException(std::format("Failed to open \"{}\" for reading.", path.string()));
+        }
+
+        return LoadFont(std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+    }
+
+    [[maybe_unused]] uint32_t TextRenderer::LoadFont(std::vector<uint8_t> data)
+    {
+        auto font = std::make_unique<Font>();
+        font->mData = std::move(data);
+
+        int offset = stbtt_GetFontOffsetForIndex(font->mData.data(), 0);
+        if (offset < 0 || !stbtt_InitFont(&font->mInfo, font->mData.data(), offset)) {
+            throw TextRendererException("Font data is not a valid TrueType font.");
+        }
+
+        int ascent = 0, descent = 0, lineGap = 0;
+        stbtt_GetFontVMetrics(&font->mInfo, &ascent, &descent, &lineGap);
+        font->mScale = stbtt_ScaleForPixelHeight(&font->mInfo, 1.0f);
+        font->mAscent = ascent * font->mScale;
+        font->mDescent = descent * font->mScale;
+        font->mLineHeight = (ascent - descent + lineGap) * font->mScale;
+
+        mFonts.push_back(std::move(font));
+        return static_cast<uint32_t>(mFonts.size() - 1);
+    }
+
+    void TextRenderer::Draw(uint32_t font, std::string_view text, const V2f& position, float size, const V4f& color)
+    {
+        mShape(mGetFont(font), text, mScratch);
+        mScratch.mGeneration = 0;
+        mFrameStatistics.mShapedRuns++;
+
+        mEmit(font, mScratch, position, size, color);
+    }
+
+    void TextRenderer::DrawStatic(uint32_t font, std::string_view text, const V2f& position, float size, const V4f& color)
+    {
+        Font& source = mGetFont(font);
+
+        auto it = source.mRuns.find(text);
+        if (it == source.mRuns.end())
+        {
+            it = source.mRuns.emplace(std::string(text), Run{}).first;
+            mShape(source, text, it->second);
+            mFrameStatistics.mShapedRuns++;
+        } else {
+            mFrameStatistics.mCachedRuns++;
+        }
+
+        it->second.mLastFrame = mFrame;
+        mEmit(font, it->second, position, size, color);
+    }
+
+    void TextRenderer::Render()
+    {
+        mFlush();
+
+        mStatistics = mFrameStatistics;
+        mFrameStatistics = {};
+        mFrame++;
+
+        if (mFrame % PRUNE_INTERVAL != 0) {
+            return;
+        }
+
+        for (std::unique_ptr<Font>& font : mFonts) {
+            std::erase_if(font->mRuns, [this](const auto& entry) {
+                return entry.second.mLastFrame + mRUN_LIFETIME < mFrame;
+            });
+        }
+    }
+
+    [[nodiscard]] V2f TextRenderer::Measure(uint32_t font, std::string_view text, float size)
+    {
+        mShape(mGetFont(font), text, mScratch);
+        return mScratch.mSize * size;
+    }
+
+    [[nodiscard]] std::size_t TextRenderer::GetFontCount() const {
+        return mFonts.size();
+    }
+
+    [[nodiscard]] uint32_t TextRenderer::GetCellCount() const {
+        return static_cast<uint32_t>(mCells.size());
+    }
+
+    [[nodiscard]] uint32_t TextRenderer::GetUsedCellCount() const {
+        return mUsedCells;
+    }
+
+    [[nodiscard]] GLuint TextRenderer::GetAtlasTexture() const {
+        return mAtlas;
+    }
+
+    [[nodiscard]] const TextRenderer::Statistics& TextRenderer::GetStatistics() const {
+        return mStatistics;
+    }
+
+    [[nodiscard]] TextRenderer::Font& TextRenderer::mGetFont(uint32_t font)
+    {
+        if (font >= mFonts.size()) {
+            throw TextRendererException(std::format("Font {} does not exist.", font));
+        }
+        return *mFonts[font];
+    }
+
+    void TextRenderer::mShape(Font& font, std::string_view text, Run& run)
+    {
+        run.mGlyphs.clear();
+        run.mCells.clear();
+
+        float x = 0.0f;
+        float y = font.mAscent;
+        float width = 0.0f;
+        uint32_t previous = 0;
+
+        for (std::size_t i = 0; i < text.size();)
+        {
+            char32_t codepoint = DecodeUtf8(text, i);
+            if (codepoint == U'\n')
+            {
+                width = std::max(width, x);
+                x = 0.0f;
+                y += font.mLineHeight;
+                previous = 0;
+                continue;
+            }
+
+            auto it = font.mGlyphs.find(codepoint);
+            if (it == font.mGlyphs.end())
+            {
+                Font::Glyph glyph{};
+                glyph.mIndex = static_cast<uint32_t>(stbtt_FindGlyphIndex(&font.mInfo, static_cast<int>(codepoint)));
+
+                int advance = 0, bearing = 0;
+                stbtt_GetGlyphHMetrics(&font.mInfo, static_cast<int>(glyph.mIndex), &advance, &bearing);
+                glyph.mAdvance = advance * font.mScale;
+                glyph.mEmpty = stbtt_IsGlyphEmpty(&font.mInfo, static_cast<int>(glyph.mIndex));
+
+                it = font.mGlyphs.emplace(codepoint, glyph).first;
+            }
+
+            const Font::Glyph& glyph = it->second;
+            if (previous != 0) {
+                x += stbtt_GetGlyphKernAdvance(&font.mInfo, static_cast<int>(previous), static_cast<int>(glyph.mIndex)) * font.mScale;
+            }
+            if (!glyph.mEmpty) {
+                run.mGlyphs.push_back({ glyph.mIndex, x, y });
+            }
+
+            x += glyph.mAdvance;
+            previous = glyph.mIndex;
+        }
+
+        run.mSize = { std::max(width, x), y - font.mDescent };
+    }
+
+    void TextRenderer::mEmit(uint32_t font, Run& run, const V2f& position, float size, const V4f& color)
+    {
+        std::array<uint8_t, 4> packed;
+        for (std::size_t i = 0; i < 4; i++) {
+            packed[i] = static_cast<uint8_t>(std::lround(std::clamp(color[i], 0.0f, 1.0f) * 255.0f));
+        }
+
+        // Cells recorded in the run stay valid for as long as nothing has been
+        // evicted from the atlas, which skips every lookup for static text.
+        bool cached = run.mGeneration == mGeneration && run.mCells.size() == run.mGlyphs.size();
+        uint64_t generation = mGeneration;
+        run.mCells.resize(run.mGlyphs.size());
+
+        for (std::size_t i = 0; i < run.mGlyphs.size(); i++)
+        {
+            const ShapedGlyph& glyph = run.mGlyphs[i];
+
+            uint32_t cell = run.mCells[i];
+            if (cached) {
+                mTouch(cell);
+            } else {
+                cell = run.mCells[i] = mAcquireCell(font, glyph.mGlyph);
+            }
+
+            const std::array<float, 4>& plane = mCells[cell].mPlane;
+            const std::array<float, 4>& uv = mCells[cell].mUV;
+
+            float x0 = position[V2f::X] + (glyph.mX + plane[0]) * size;
+            float y0 = position[V2f::Y] + (glyph.mY + plane[1]) * size;
+            float x1 = x0 + plane[2] * size;
+            float y1 = y0 + plane[3] * size;
+            float u0 = uv[0];
+            float v0 = uv[1];
+            float u1 = uv[0] + uv[2];
+            float v1 = uv[1] + uv[3];
+
+            mVertices.insert(mVertices.end(), {
+                { x0, y0, u0, v0, packed }, { x1, y0, u1, v0, packed }, { x1, y1, u1, v1, packed },
+                { x0, y0, u0, v0, packed }, { x1, y1, u1, v1, packed }, { x0, y1, u0, v1, packed }
+            });
+        }
+
+        run.mGeneration = mGeneration == generation ? mGeneration : 0;
+        mFrameStatistics.mGlyphs += static_cast<uint32_t>(run.mGlyphs.size());
+    }
+
+    [[nodiscard]] uint32_t TextRenderer::mAcquireCell(uint32_t font, uint32_t glyph)
+    {
+        uint64_t key = static_cast<uint64_t>(font) << 32 | glyph;
+
+        auto it = mGlyphCells.find(key);
+        if (it != mGlyphCells.end())
+        {
+            mTouch(it->second);
+            return it->second;
+        }
+
+        return mRasterize(font, glyph, key);
+    }
+
+    [[nodiscard]] uint32_t TextRenderer::mRasterize(uint32_t font, uint32_t glyph, uint64_t key)
+    {
+        uint32_t cell;
+        if (mUsedCells < mCells.size())
+        {
+            cell = mUsedCells++;
+        }
+        else
+        {
+            cell = mTail;
+
+            // Glyphs already queued this frame still sample the cell, so they
+            // are drawn before it is overwritten.
+            if (mCells[cell].mLastFrame == mFrame) {
+                mFlush();
+            }
+
+            mGlyphCells.erase(mCells[cell].mKey);
+            mUnlink(cell);
+            mGeneration++;
+            mFrameStatistics.mEvictions++;
+        }
+
+        const Font& source = *mFonts[font];
+        float scale = stbtt_ScaleForPixelHeight(&source.mInfo, static_cast<float>(SDF_SIZE));
+
+        int width = 0, height = 0, xOffset = 0, yOffset = 0;
+        unsigned char* bitmap = nullptr;
+        for (int attempt = 0; attempt < 4; attempt++)
+        {
+            bitmap = stbtt_GetGlyphSDF(&source.mInfo, scale, static_cast<int>(glyph), SDF_PADDING, SDF_ON_EDGE,
+                static_cast<float>(SDF_ON_EDGE) / SDF_PADDING, &width, &height, &xOffset, &yOffset);
+            if (bitmap == nullptr || std::max(width, height) <= static_cast<int>(CELL_SIZE) - 2) {
+                break;
+            }
+
+            stbtt_FreeSDF(bitmap, nullptr);
+            bitmap = nullptr;
+            scale *= static_cast<float>(CELL_SIZE - 2) / std::max(width, height) * 0.95f;
+        }
+        if (bitmap == nullptr) {
+            width = height = xOffset = yOffset = 0;
+        }
+
+        // The bitmap sits one texel inside a zeroed cell so linear filtering
+        // never picks up what the previous occupant left behind.
+        std::vector<uint8_t> pixels(CELL_SIZE * CELL_SIZE, 0);
+        for (int row = 0; row < height; row++) {
+            std::copy_n(bitmap + row * width, width, pixels.begin() + (row + 1) * CELL_SIZE + 1);
+        }
+        if (bitmap != nullptr) {
+            stbtt_FreeSDF(bitmap, nullptr);
+        }
+
+        uint32_t cellX = cell % mCellsPerRow * CELL_SIZE;
+        uint32_t cellY = cell / mCellsPerRow * CELL_SIZE;
+
+        GLint alignment = 4;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glBindTexture(GL_TEXTURE_2D, mAtlas);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(cellX), static_cast<GLint>(cellY), CELL_SIZE, CELL_SIZE, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+        float pixelSize = scale / source.mScale;
+        float atlas = static_cast<float>(mAtlasSize);
+
+        Cell& target = mCells[cell];
+        target.mKey = key;
+        target.mLastFrame = mFrame;
+        target.mPlane = { xOffset / pixelSize, yOffset / pixelSize, width / pixelSize, height / pixelSize };
+        target.mUV = { (cellX + 1) / atlas, (cellY + 1) / atlas, width / atlas, height / atlas };
+
+        mGlyphCells[key] = cell;
+        mPushFront(cell);
+        mFrameStatistics.mRasterized++;
+
+        return cell;
+    }
+
+    void TextRenderer::mTouch(uint32_t cell)
+    {
+        mCells[cell].mLastFrame = mFrame;
+        if (cell == mHead) {
+            return;
+        }
+
+        mUnlink(cell);
+        mPushFront(cell);
+    }
+
+    void TextRenderer::mUnlink(uint32_t cell)
+    {
+        Cell& entry = mCells[cell];
+
+        if (entry.mPrevious != mNONE) {
+            mCells[entry.mPrevious].mNext = entry.mNext;
+        } else {
+            mHead = entry.mNext;
+        }
+
+        if (entry.mNext != mNONE) {
+            mCells[entry.mNext].mPrevious = entry.mPrevious;
+        } else {
+            mTail = entry.mPrevious;
+        }
+
+        entry.mPrevious = entry.mNext = mNONE;
+    }
+
+    void TextRenderer::mPushFront(uint32_t cell)
+    {
+        Cell& entry = mCells[cell];
+        entry.mPrevious = mNONE;
+        entry.mNext = mHead;
+
+        if (mHead != mNONE) {
+            mCells[mHead].mPrevious = cell;
+        }
+        mHead = cell;
+
+        if (mTail == mNONE) {
+            mTail = cell;
+        }
+    }
+
+    void TextRenderer::mFlush()
+    {
+        if (mVertices.empty()) {
+            return;
+        }
+
+        std::array<GLint, 4> viewport;
+        glGetIntegerv(GL_VIEWPORT, viewport.data());
+
+        GLboolean blend = glIsEnabled(GL_BLEND);
+        GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glDisable(GL_DEPTH_TEST);
+
+        mShader.Use();
+        glUniform2f(mShader.GetUniformLocation("uScreen"), static_cast<float>(viewport[2]), static_cast<float>(viewport[3]));
+        glUniform1i(mShader.GetUniformLocation("uAtlas"), 0);
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, mAtlas);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(mVertices.size() * sizeof(TextVertex)), mVertices.data(), GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        glBindVertexArray(mVertexArray);
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mVertices.size()));
+        glBindVertexArray(0);
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glUseProgram(0);
+
+        if (!blend) {
+            glDisable(GL_BLEND);
+        }
+        if (depthTest) {
+            glEnable(GL_DEPTH_TEST);
+        }
+
+        mVertices.clear();
+        mFrameStatistics.mDrawCalls++;
+    }
+}
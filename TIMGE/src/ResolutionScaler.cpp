@@ -0,0 +1,317 @@
+#include "TIMGE/ResolutionScaler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+namespace TIMGE
+{
+    ResolutionScalerException::ResolutionScalerException(std::string message)
+     : Exception(std::format("ResolutionScaler: {}", message))
+    {}
+
+    ResolutionScaler::ResolutionScaler()
+     : mEnabled{false},
+       mDynamic{true},
+       mScale{1.0f},
+       mMinScale{0.5f},
+       mMaxScale{1.0f},
+       mTargetFrameTime{1.0 / 60.0},
+       mGpuTime{},
+       mCooldown{},
+       mRenderSize{},
+       mFramebuffer{},
+       mColorTexture{},
+       mDepthBuffer{},
+       mQueries{},
+       mQueryPending{},
+       mNextQuery{},
+       mTiming{false}
+    {}
+
+    ResolutionScaler::~ResolutionScaler() {
+        mRelease();
+    }
+
+    void ResolutionScaler::SetEnabled(bool enabled)
+    {
+        if (!enabled) {
+            mRelease();
+        }
+        mEnabled = enabled;
+    }
+
+    void ResolutionScaler::SetDynamic(bool dynamic)
+    {
+        mDynamic = dynamic;
+        mCooldown = 0;
+    }
+
+    void ResolutionScaler::SetScale(float scale)
+    {
+        if (!(scale >= MIN_SCALE && scale <= MAX_SCALE)) {
+            throw ResolutionScalerException(std::format("Scale must be within [{}, {}].", MIN_SCALE, MAX_SCALE));
+        }
+        mScale = scale;
+    }
+
+    void ResolutionScaler::SetScaleLimits(float minScale, float maxScale)
+    {
+        if (!(minScale >= MIN_SCALE && minScale <= maxScale && maxScale <= MAX_SCALE)) {
+            throw ResolutionScalerException(std::format("Scale limits must satisfy {} <= min <= max <= {}.", MIN_SCALE, MAX_SCALE));
+        }
+        mMinScale = minScale;
+        mMaxScale = maxScale;
+        mScale = std::clamp(mScale, mMinScale, mMaxScale);
+    }
+
+    void ResolutionScaler::SetTargetFrameTime(double frameTime)
+    {
+        if (!(frameTime > 0.0)) {
+            throw ResolutionScalerException("Target frame time must be positive.");
+        }
+        mTargetFrameTime = frameTime;
+    }
+
+    void ResolutionScaler::BeginScene(const V2ui32& framebufferSize, const V4f& background)
+    {
+        if (!mEnabled) {
+            return;
+        }
+
+        if (mFramebuffer == 0) {
+            mCreate();
+        }
+
+        mCollectTimings();
+        if (mDynamic) {
+            mAdjust();
+        }
+
+        // Native resolution is kept exact, and rounding a reduced size up to
+        // the alignment never takes it past native.
+        auto scaled = [this](uint32_t extent)
+        {
+            if (mScale == 1.0f) {
+                return std::max(extent, 1u);
+            }
+
+            uint32_t size = static_cast<uint32_t>(std::lround(extent * mScale));
+            size = (size + mSIZE_ALIGNMENT / 2) / mSIZE_ALIGNMENT * mSIZE_ALIGNMENT;
+            if (mScale < 1.0f) {
+                size = std::min(size, extent);
+            }
+            return std::max(size, 1u);
+        };
+
+        V2ui32 renderSize{ scaled(framebufferSize[V2ui32::WIDTH]), scaled(framebufferSize[V2ui32::HEIGHT]) };
+        if (renderSize[V2ui32::WIDTH] != mRenderSize[V2ui32::WIDTH] || renderSize[V2ui32::HEIGHT] != mRenderSize[V2ui32::HEIGHT]) {
+            mResize(renderSize);
+        }
+
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glViewport(0, 0, static_cast<GLsizei>(mRenderSize[V2ui32::WIDTH]), static_cast<GLsizei>(mRenderSize[V2ui32::HEIGHT]));
+        glClearColor(background[V4f::R], background[V4f::G], background[V4f::B], background[V4f::A]);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+        // A query still waiting for its result is skipped rather than reused,
+        // so reading timings never stalls on the GPU.
+        if (!mQueryPending[mNextQuery])
+        {
+            glBeginQuery(GL_TIME_ELAPSED, mQueries[mNextQuery]);
+            mTiming = true;
+        }
+    }
+
+    void ResolutionScaler::EndScene()
+    {
+        if (!mEnabled || !mTiming) {
+            return;
+        }
+
+        glEndQuery(GL_TIME_ELAPSED);
+        mQueryPending[mNextQuery] = true;
+        mNextQuery = (mNextQuery + 1) % mQUERY_COUNT;
+        mTiming = false;
+    }
+
+    void ResolutionScaler::Present(const V2ui32& framebufferSize)
+    {
+        if (!mEnabled || mFramebuffer == 0) {
+            return;
+        }
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, mFramebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(
+            0, 0, static_cast<GLint>(mRenderSize[V2ui32::WIDTH]), static_cast<GLint>(mRenderSize[V2ui32::HEIGHT]),
+            0, 0, static_cast<GLint>(framebufferSize[V2ui32::WIDTH]), static_cast<GLint>(framebufferSize[V2ui32::HEIGHT]),
+            GL_COLOR_BUFFER_BIT, GL_LINEAR
+        );
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, static_cast<GLsizei>(framebufferSize[V2ui32::WIDTH]), static_cast<GLsizei>(framebufferSize[V2ui32::HEIGHT]));
+    }
+
+    [[nodiscard]] bool ResolutionScaler::IsEnabled() const {
+        return mEnabled;
+    }
+
+    [[nodiscard]] bool ResolutionScaler::IsDynamic() const {
+        return mDynamic;
+    }
+
+    [[nodiscard]] float ResolutionScaler::GetScale() const {
+        return mScale;
+    }
+
+    [[nodiscard]] float ResolutionScaler::GetMinScale() const {
+        return mMinScale;
+    }
+
+    [[nodiscard]] float ResolutionScaler::GetMaxScale() const {
+        return mMaxScale;
+    }
+
+    [[nodiscard]] double ResolutionScaler::GetTargetFrameTime() const {
+        return mTargetFrameTime;
+    }
+
+    [[nodiscard]] double ResolutionScaler::GetGpuTime() const {
+        return mGpuTime;
+    }
+
+    [[nodiscard]] const V2ui32& ResolutionScaler::GetRenderSize() const {
+        return mRenderSize;
+    }
+
+    [[nodiscard]] GLuint ResolutionScaler::GetColorTexture() const {
+        return mColorTexture;
+    }
+
+    void ResolutionScaler::mCreate()
+    {
+        glGenFramebuffers(1, &mFramebuffer);
+        glGenTextures(1, &mColorTexture);
+        glGenRenderbuffers(1, &mDepthBuffer);
+        glGenQueries(static_cast<GLsizei>(mQUERY_COUNT), mQueries.data());
+
+        mQueryPending.fill(false);
+        mNextQuery = 0;
+        mRenderSize = {};
+    }
+
+    void ResolutionScaler::mRelease()
+    {
+        if (mFramebuffer == 0) {
+            return;
+        }
+
+        if (mTiming)
+        {
+            glEndQuery(GL_TIME_ELAPSED);
+            mTiming = false;
+        }
+
+        glDeleteQueries(static_cast<GLsizei>(mQUERY_COUNT), mQueries.data());
+        glDeleteRenderbuffers(1, &mDepthBuffer);
+        glDeleteTextures(1, &mColorTexture);
+        glDeleteFramebuffers(1, &mFramebuffer);
+
+        mFramebuffer = 0;
+        mColorTexture = 0;
+        mDepthBuffer = 0;
+        mQueries.fill(0);
+        mQueryPending.fill(false);
+        mRenderSize = {};
+        mGpuTime = 0.0;
+    }
+
+    void ResolutionScaler::mResize(const V2ui32& renderSize)
+    {
+        GLsizei width = static_cast<GLsizei>(renderSize[V2ui32::WIDTH]);
+        GLsizei height = static_cast<GLsizei>(renderSize[V2ui32::HEIGHT]);
+
+        glBindTexture(GL_TEXTURE_2D, mColorTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, mDepthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mColorTexture, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mDepthBuffer);
+
+        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+            throw ResolutionScalerException(std::format("Render target {}x{} is incomplete (0x{:X}).", width, height, status));
+        }
+
+        mRenderSize = renderSize;
+
+        // Timings taken at the old size say little about the new one, so the
+        // controller waits for fresh samples before moving again.
+        mGpuTime = 0.0;
+        mCooldown = mRESIZE_COOLDOWN;
+    }
+
+    void ResolutionScaler::mCollectTimings()
+    {
+        for (std::size_t i = 0; i < mQUERY_COUNT; i++)
+        {
+            std::size_t query = (mNextQuery + i) % mQUERY_COUNT;
+            if (!mQueryPending[query]) {
+                continue;
+            }
+
+            GLint available = GL_FALSE;
+            glGetQueryObjectiv(mQueries[query], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available == GL_FALSE) {
+                continue;
+            }
+
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(mQueries[query], GL_QUERY_RESULT, &elapsed);
+            mQueryPending[query] = false;
+
+            double sample = static_cast<double>(elapsed) * 1.0E-9;
+            mGpuTime = mGpuTime == 0.0 ? sample : mGpuTime + mSMOOTHING * (sample - mGpuTime);
+
+            if (mCooldown > 0) {
+                mCooldown--;
+            }
+        }
+    }
+
+    void ResolutionScaler::mAdjust()
+    {
+        if (mCooldown > 0 || mGpuTime == 0.0) {
+            return;
+        }
+
+        // GPU time follows the pixel count, which goes with the square of the
+        // scale, so an overshoot is corrected in one step towards the target.
+        if (mGpuTime > mTargetFrameTime) {
+            mScale *= std::clamp(static_cast<float>(std::sqrt(mTargetFrameTime / mGpuTime)), 0.75f, 1.0f - mSCALE_STEP);
+        } else if (mGpuTime < mTargetFrameTime * mHEADROOM) {
+            mScale += mSCALE_STEP;
+        }
+
+        // Repeated steps drift off by rounding errors, which would otherwise
+        // keep the scale just short of native or of its upper limit.
+        for (float anchor : { 1.0f, mMaxScale }) {
+            if (std::abs(mScale - anchor) < mSCALE_STEP * 0.5f) {
+                mScale = anchor;
+            }
+        }
+
+        mScale = std::clamp(mScale, mMinScale, mMaxScale);
+    }
+}
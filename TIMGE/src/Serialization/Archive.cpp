@@ -0,0 +1,168 @@
+#include "TIMGE/Serialization/Archive.hpp"
+
+#include <cstdint>
+#include <format>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define TIMGE_ARCHIVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // __unix__ || __APPLE__
+
+namespace TIMGE::Serialization
+{
+    SerializationException::SerializationException(std::string message)
+     : Exception(std::format("Serialization: {}", message))
+    {}
+
+    Writer::Writer(const std::filesystem::path& path, uint16_t schemaVersion)
+     : mStream{path, std::ios::binary | std::ios::trunc},
+       mPosition{0},
+       mSchemaVersion{schemaVersion},
+       mFinished{false}
+    {
+        if (!mStream) {
+            throw SerializationException(std::format("Failed to open \"{}\" for writing!", path.string()));
+        }
+
+        Header placeholder{};
+        mWrite(&placeholder, sizeof(Header));
+    }
+
+    [[maybe_unused]] ArrayRef<char> Writer::WriteString(std::string_view string)
+    {
+        uint32_t position = mAlign(1);
+        mWrite(string.data(), string.size());
+        return { position, static_cast<uint32_t>(string.size()) };
+    }
+
+    void Writer::Append(const void* data, std::size_t size) {
+        mWrite(data, size);
+    }
+
+    [[nodiscard]] uint32_t Writer::GetPosition() const {
+        return static_cast<uint32_t>(mPosition);
+    }
+
+    [[nodiscard]] uint32_t Writer::mAlign(std::size_t alignment)
+    {
+        static constexpr std::array<char, 64> PADDING{};
+
+        std::size_t padding = (alignment - mPosition % alignment) % alignment;
+        while (padding > 0)
+        {
+            std::size_t size = std::min(padding, PADDING.size());
+            mWrite(PADDING.data(), size);
+            padding -= size;
+        }
+
+        // Offsets are signed 32 bit distances, which caps the archive size.
+        if (mPosition > static_cast<uint64_t>(INT32_MAX)) {
+            throw SerializationException("Archives are limited to 2 GiB.");
+        }
+
+        return static_cast<uint32_t>(mPosition);
+    }
+
+    void Writer::mWrite(const void* data, std::size_t size)
+    {
+        if (mFinished) {
+            throw SerializationException("The archive has already been finished.");
+        }
+
+        mStream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        if (!mStream) {
+            throw SerializationException("Failed to write to the archive.");
+        }
+        mPosition += size;
+    }
+
+    Archive::Archive(const std::filesystem::path& path)
+     : mData{nullptr},
+       mSize{0},
+       mBuffer{}
+    {
+#ifdef TIMGE_ARCHIVE_MMAP
+        int descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0) {
+            throw SerializationException(std::format("Failed to open \"{}\"!", path.string()));
+        }
+
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(Header))
+        {
+            close(descriptor);
+            throw SerializationException(std::format("\"{}\" is not an archive!", path.string()));
+        }
+
+        mSize = static_cast<std::size_t>(status.st_size);
+        void* mapping = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+
+        if (mapping == MAP_FAILED) {
+            throw SerializationException(std::format("Failed to map \"{}\"!", path.string()));
+        }
+        mData = static_cast<const std::byte*>(mapping);
+#else
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if (!stream) {
+            throw SerializationException(std::format("Failed to open \"{}\"!", path.string()));
+        }
+
+        mBuffer.resize(static_cast<std::size_t>(stream.tellg()));
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(mBuffer.data()), static_cast<std::streamsize>(mBuffer.size()));
+
+        mData = mBuffer.data();
+        mSize = mBuffer.size();
+        if (mSize < sizeof(Header)) {
+            throw SerializationException(std::format("\"{}\" is not an archive!", path.string()));
+        }
+#endif // TIMGE_ARCHIVE_MMAP
+
+        const Header& header = GetHeader();
+        std::string error;
+        if (header.mMagic != Writer::MAGIC) {
+            error = "is not an archive";
+        } else if (header.mFormatVersion != Writer::FORMAT_VERSION) {
+            error = std::format("has format version {}, expected {}", header.mFormatVersion, Writer::FORMAT_VERSION);
+        } else if (header.mSize != mSize) {
+            error = "is truncated or was never finished";
+        }
+
+        if (!error.empty())
+        {
+#ifdef TIMGE_ARCHIVE_MMAP
+            munmap(const_cast<std::byte*>(mData), mSize);
+#endif // TIMGE_ARCHIVE_MMAP
+            throw SerializationException(std::format("\"{}\" {}!", path.string(), error));
+        }
+    }
+
+    Archive::~Archive()
+    {
+#ifdef TIMGE_ARCHIVE_MMAP
+        munmap(const_cast<std::byte*>(mData), mSize);
+#endif // TIMGE_ARCHIVE_MMAP
+    }
+
+    [[nodiscard]] bool Archive::Contains(const void* data, std::size_t size) const
+    {
+        const std::byte* begin = static_cast<const std::byte*>(data);
+        return begin >= mData && size <= mSize && static_cast<std::size_t>(begin - mData) <= mSize - size;
+    }
+
+    [[nodiscard]] const Header& Archive::GetHeader() const {
+        return *reinterpret_cast<const Header*>(mData);
+    }
+
+    [[nodiscard]] uint16_t Archive::GetSchemaVersion() const {
+        return GetHeader().mSchemaVersion;
+    }
+
+    [[nodiscard]] std::size_t Archive::GetSize() const {
+        return mSize;
+    }
+}
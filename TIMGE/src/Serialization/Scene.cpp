@@ -0,0 +1,312 @@
+#include "TIMGE/Serialization/Scene.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <span>
+
+namespace TIMGE::Serialization
+{
+    namespace
+    {
+        // Offsets are trusted by Get, so everything a loader follows is checked
+        // against the mapping first.
+        template<typename Type_T>
+        [[nodiscard]] std::span<const Type_T> GetChecked(const Archive& archive, const Array<Type_T>& array)
+        {
+            std::span<const Type_T> values = array.Get();
+            if (!values.empty())
+            {
+                if (reinterpret_cast<uintptr_t>(values.data()) % alignof(Type_T) != 0 || !archive.Contains(values.data(), values.size_bytes())) {
+                    throw SerializationException("The archive holds an array out of bounds.");
+                }
+            }
+            return values;
+        }
+    }
+
+    [[nodiscard]] const ComponentRegistry::Entry* ComponentRegistry::Find(std::string_view name) const
+    {
+        auto entry = std::find_if(mEntries.begin(), mEntries.end(), [name](const Entry& candidate) { return candidate.mName == name; });
+        return entry == mEntries.end() ? nullptr : &*entry;
+    }
+
+    [[nodiscard]] const ComponentRegistry::Entry* ComponentRegistry::Find(ECS::ComponentID id) const
+    {
+        auto entry = std::find_if(mEntries.begin(), mEntries.end(), [id](const Entry& candidate) { return candidate.mId == id; });
+        return entry == mEntries.end() ? nullptr : &*entry;
+    }
+
+    [[nodiscard]] const std::vector<ComponentRegistry::Entry>& ComponentRegistry::GetEntries() const {
+        return mEntries;
+    }
+
+    SceneWriter::SceneWriter(const std::filesystem::path& path)
+     : mWriter{path, Scene::VERSION},
+       mWindow{0},
+       mResources{},
+       mEntityCount{0},
+       mColumns{},
+       mWorldWritten{false}
+    {}
+
+    void SceneWriter::WriteWindow(const Window::Info& info)
+    {
+        if (mWindow.mPosition != 0) {
+            throw SerializationException("The window settings have already been written.");
+        }
+
+        ArrayRef<char> title = mWriter.WriteString(info.mTitle);
+
+        Pending<WindowSettings> settings = mWriter.Prepare<WindowSettings>();
+        WindowSettings& window = settings[0];
+        window = {
+            {},
+            { info.mSize[0], info.mSize[1] },
+            { info.mSizeLimits[0], info.mSizeLimits[1], info.mSizeLimits[2], info.mSizeLimits[3] },
+            { info.mPosition[0], info.mPosition[1] },
+            { info.mAspectRatio[0], info.mAspectRatio[1] },
+            info.mOpacity,
+            { info.mOpenGLVersion[0], info.mOpenGLVersion[1] },
+            info.mFlags
+        };
+        settings.Link(0, &WindowSettings::mTitle, title);
+
+        mWindow = { mWriter.Write(settings).mPosition };
+    }
+
+    void SceneWriter::AddResource(std::string_view path, ResourceType type) {
+        mResources.emplace_back(mWriter.WriteString(path), type);
+    }
+
+    void SceneWriter::WriteWorld(const ECS::World& world, const ComponentRegistry& registry)
+    {
+        if (mWorldWritten) {
+            throw SerializationException("The world has already been written.");
+        }
+        mWorldWritten = true;
+
+        // Entities are numbered in archetype and chunk order, which is the
+        // order every column below walks them in. Entities without a registered
+        // component have nothing to save, so every saved entity is referenced
+        // by at least one column.
+        const std::vector<ECS::Archetype*>& archetypes = world.GetArchetypes();
+        const std::vector<ComponentRegistry::Entry>& entries = registry.GetEntries();
+        std::vector<uint32_t> bases;
+        bases.reserve(archetypes.size());
+        for (const ECS::Archetype* archetype : archetypes)
+        {
+            bases.push_back(mEntityCount);
+            if (std::any_of(entries.begin(), entries.end(), [archetype](const ComponentRegistry::Entry& entry) { return archetype->HasComponent(entry.mId); })) {
+                mEntityCount += static_cast<uint32_t>(archetype->GetEntityCount());
+            }
+        }
+
+        std::vector<uint32_t> indices;
+        for (const ComponentRegistry::Entry& entry : entries)
+        {
+            uint32_t count = 0;
+            for (const ECS::Archetype* archetype : archetypes) {
+                if (archetype->HasComponent(entry.mId)) {
+                    count += static_cast<uint32_t>(archetype->GetEntityCount());
+                }
+            }
+
+            if (count == 0) {
+                continue;
+            }
+
+            Column column{ mWriter.WriteString(entry.mName), entry.mSize, entry.mAlignment, {}, {} };
+
+            column.mEntities = mWriter.BeginArray<uint32_t>(count);
+            for (std::size_t i = 0; i < archetypes.size(); i++)
+            {
+                const ECS::Archetype& archetype = *archetypes[i];
+                if (!archetype.HasComponent(entry.mId)) {
+                    continue;
+                }
+
+                uint32_t index = bases[i];
+                for (std::size_t chunk = 0; chunk < archetype.GetChunkCount(); chunk++)
+                {
+                    uint32_t rows = archetype.GetChunk(chunk).mCount;
+                    indices.resize(rows);
+                    for (uint32_t row = 0; row < rows; row++) {
+                        indices[row] = index++;
+                    }
+                    mWriter.Append(indices.data(), rows * sizeof(uint32_t));
+                }
+            }
+            mWriter.EndArray(column.mEntities);
+
+            column.mData = mWriter.BeginArray<std::byte>(count * entry.mSize, entry.mAlignment);
+            for (const ECS::Archetype* archetype : archetypes)
+            {
+                if (!archetype->HasComponent(entry.mId)) {
+                    continue;
+                }
+
+                for (std::size_t chunk = 0; chunk < archetype->GetChunkCount(); chunk++)
+                {
+                    ECS::Chunk& data = archetype->GetChunk(chunk);
+                    mWriter.Append(archetype->GetColumn(data, entry.mId), data.mCount * static_cast<std::size_t>(entry.mSize));
+                }
+            }
+            mWriter.EndArray(column.mData);
+
+            mColumns.push_back(column);
+        }
+    }
+
+    void SceneWriter::Finish()
+    {
+        Pending<ResourceReference> resources = mWriter.Prepare<ResourceReference>(mResources.size());
+        for (std::size_t i = 0; i < mResources.size(); i++)
+        {
+            resources[i].mType = mResources[i].second;
+            resources.Link(i, &ResourceReference::mPath, mResources[i].first);
+        }
+        ArrayRef<ResourceReference> resourceArray = mWriter.Write(resources);
+
+        Pending<ComponentColumn> columns = mWriter.Prepare<ComponentColumn>(mColumns.size());
+        for (std::size_t i = 0; i < mColumns.size(); i++)
+        {
+            columns[i].mSize = mColumns[i].mSize;
+            columns[i].mAlignment = mColumns[i].mAlignment;
+            columns.Link(i, &ComponentColumn::mName, mColumns[i].mName);
+            columns.Link(i, &ComponentColumn::mEntities, mColumns[i].mEntities);
+            columns.Link(i, &ComponentColumn::mData, mColumns[i].mData);
+        }
+        ArrayRef<ComponentColumn> columnArray = mWriter.Write(columns);
+
+        Pending<Scene> scene = mWriter.Prepare<Scene>();
+        scene[0].mEntityCount = mEntityCount;
+        if (mWindow.mPosition != 0) {
+            scene.Link(0, &Scene::mWindow, mWindow);
+        }
+        scene.Link(0, &Scene::mResources, resourceArray);
+        scene.Link(0, &Scene::mComponents, columnArray);
+
+        mWriter.Finish(Ref<Scene>{ mWriter.Write(scene).mPosition });
+    }
+
+    [[nodiscard]] const Scene& GetScene(const Archive& archive)
+    {
+        if (archive.GetSchemaVersion() != Scene::VERSION) {
+            throw SerializationException(std::format("Scene version {} is not supported, expected {}!", archive.GetSchemaVersion(), Scene::VERSION));
+        }
+        return archive.GetRoot<Scene>();
+    }
+
+    [[maybe_unused]] std::vector<ECS::Entity> LoadWorld(const Archive& archive, ECS::World& world, const ComponentRegistry& registry)
+    {
+        struct LoadedColumn
+        {
+            const ComponentRegistry::Entry* mEntry;
+            std::span<const uint32_t> mEntities;
+            std::span<const std::byte> mData;
+        };
+
+        const Scene& scene = GetScene(archive);
+
+        // Every column is checked before the first entity is created, so a
+        // malformed archive leaves world untouched.
+        std::vector<LoadedColumn> columns;
+        std::size_t references = 0;
+        for (const ComponentColumn& column : GetChecked(archive, scene.mComponents))
+        {
+            std::span<const char> characters = GetChecked(archive, column.mName);
+            std::string_view name(characters.data(), characters.size());
+
+            // SceneWriter stores each column's entities in ascending order,
+            // which also rules out adding a component twice.
+            std::span<const uint32_t> indices = GetChecked(archive, column.mEntities);
+            for (std::size_t i = 0; i < indices.size(); i++)
+            {
+                if (indices[i] >= scene.mEntityCount || (i > 0 && indices[i] <= indices[i - 1])) {
+                    throw SerializationException(std::format("Column \"{}\" refers to missing or repeated entities!", name));
+                }
+            }
+            references += indices.size();
+
+            const ComponentRegistry::Entry* entry = registry.Find(name);
+            if (entry == nullptr) {
+                continue;
+            }
+
+            if (std::any_of(columns.begin(), columns.end(), [entry](const LoadedColumn& loaded) { return loaded.mEntry == entry; })) {
+                throw SerializationException(std::format("Component \"{}\" is stored twice!", name));
+            }
+
+            if (column.mSize != entry->mSize || column.mAlignment != entry->mAlignment) {
+                throw SerializationException(std::format("Component \"{}\" changed layout since the scene was saved!", name));
+            }
+
+            std::span<const std::byte> data = GetChecked(archive, column.mData);
+            if (data.size() != indices.size() * static_cast<std::size_t>(entry->mSize) || reinterpret_cast<uintptr_t>(data.data()) % entry->mAlignment != 0) {
+                throw SerializationException(std::format("Column \"{}\" is malformed!", name));
+            }
+
+            columns.push_back({ entry, indices, data });
+        }
+
+        // Every saved entity appears in at least one column, which bounds the
+        // entity count by the size of the archive.
+        if (scene.mEntityCount > references) {
+            throw SerializationException(std::format("The scene holds {} entities but its columns only reference {}!", scene.mEntityCount, references));
+        }
+
+        std::vector<ECS::Entity> entities;
+        entities.reserve(scene.mEntityCount);
+        for (uint32_t i = 0; i < scene.mEntityCount; i++) {
+            entities.push_back(world.CreateEntity());
+        }
+
+        for (const LoadedColumn& column : columns) {
+            for (std::size_t i = 0; i < column.mEntities.size(); i++) {
+                column.mEntry->mAdd(world, entities[column.mEntities[i]], column.mData.data() + i * column.mEntry->mSize);
+            }
+        }
+
+        return entities;
+    }
+
+    [[nodiscard]] std::vector<Resource> LoadResources(const Archive& archive)
+    {
+        std::span<const ResourceReference> references = GetChecked(archive, GetScene(archive).mResources);
+
+        std::vector<Resource> resources;
+        resources.reserve(references.size());
+        for (const ResourceReference& reference : references)
+        {
+            std::span<const char> path = GetChecked(archive, reference.mPath);
+            resources.push_back({ std::string_view(path.data(), path.size()), reference.mType });
+        }
+        return resources;
+    }
+
+    [[nodiscard]] std::optional<Window::Info> LoadWindow(const Archive& archive)
+    {
+        const Scene& scene = GetScene(archive);
+        if (scene.mWindow.IsNull()) {
+            return std::nullopt;
+        }
+
+        const WindowSettings* settings = scene.mWindow.Get();
+        if (reinterpret_cast<uintptr_t>(settings) % alignof(WindowSettings) != 0 || !archive.Contains(settings, sizeof(WindowSettings))) {
+            throw SerializationException("The archive holds window settings out of bounds.");
+        }
+
+        std::span<const char> title = GetChecked(archive, settings->mTitle);
+        return Window::Info{
+            std::string_view(title.data(), title.size()),
+            V2ui32{ settings->mSize[0], settings->mSize[1] },
+            V4ui32{ settings->mSizeLimits[0], settings->mSizeLimits[1], settings->mSizeLimits[2], settings->mSizeLimits[3] },
+            V2i32{ settings->mPosition[0], settings->mPosition[1] },
+            V2ui32{ settings->mAspectRatio[0], settings->mAspectRatio[1] },
+            settings->mOpacity,
+            V2ui32{ settings->mOpenGLVersion[0], settings->mOpenGLVersion[1] },
+            settings->mFlags
+        };
+    }
+}
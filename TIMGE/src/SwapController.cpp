@@ -0,0 +1,164 @@
+#include "TIMGE/SwapController.hpp"
+#include "TIMGE/Monitor.hpp"
+#include "TIMGE/Window.hpp"
+
+#include <algorithm>
+#include <format>
+
+namespace TIMGE
+{
+    namespace
+    {
+        constexpr std::array<std::string_view, static_cast<std::size_t>(SwapController::Strategy::COUNT)> STRATEGY_NAMES = {
+            "IMMEDIATE",
+            "VSYNC",
+            "ADAPTIVE",
+            "HALF_RATE",
+            "LATENCY_OPTIMIZED"
+        };
+
+        constexpr std::array<int, static_cast<std::size_t>(SwapController::Strategy::COUNT)> SWAP_INTERVALS = {
+            0,
+            1,
+            -1,
+            2,
+            1
+        };
+    }
+
+    SwapControllerException::SwapControllerException(std::string message)
+     : Exception(std::format("SwapController: {}", message))
+    {}
+
+    SwapController::SwapController(Window& window, const Monitor& monitor)
+     : mWindow{window},
+       mMonitor{monitor},
+       mSamples{},
+       mSampleCount{},
+       mNextSample{},
+       mFramesSinceEvaluation{},
+       mStrategy{window.GetState(Window::VSYNC) ? Strategy::VSYNC : Strategy::IMMEDIATE},
+       mCandidate{mStrategy},
+       mAutomatic{false},
+       mFrameDelay{}
+    {}
+
+    void SwapController::SetStrategy(Strategy strategy)
+    {
+        if (strategy >= Strategy::COUNT) {
+            throw SwapControllerException("Invalid swap strategy.");
+        }
+        if (strategy == Strategy::ADAPTIVE && !mWindow.SupportsAdaptiveVSync()) {
+            throw SwapControllerException("Adaptive VSync needs the EXT_swap_control_tear extension.");
+        }
+
+        mAutomatic = false;
+        mApply(strategy);
+    }
+
+    void SwapController::SetAutomatic(bool automatic)
+    {
+        mAutomatic = automatic;
+        mCandidate = mStrategy;
+        mFramesSinceEvaluation = 0;
+    }
+
+    void SwapController::OnFrameEnd(double workTime)
+    {
+        mSamples[mNextSample] = workTime;
+        mNextSample = (mNextSample + 1) % WINDOW_SIZE;
+        mSampleCount = std::min(mSampleCount + 1, WINDOW_SIZE);
+
+        if (++mFramesSinceEvaluation < EVALUATION_INTERVAL || mSampleCount < WINDOW_SIZE / 2) {
+            return;
+        }
+        mFramesSinceEvaluation = 0;
+
+        if (mAutomatic)
+        {
+            // A strategy has to win two evaluations in a row before it is
+            // applied, so a single hitch does not flip the swap interval.
+            Strategy selected = mSelect();
+            if (selected != mStrategy && selected == mCandidate) {
+                mApply(selected);
+            }
+            mCandidate = selected;
+        }
+
+        // The frame start is pushed back by whatever the slowest recent frames
+        // leave unused of the refresh period, so input is sampled just in time.
+        mFrameDelay = 0.0;
+        if (mStrategy == Strategy::LATENCY_OPTIMIZED) {
+            mFrameDelay = std::max(GetRefreshPeriod() - mPercentile(0.99) - mSLEEP_MARGIN, 0.0);
+        }
+    }
+
+    [[nodiscard]] SwapController::Strategy SwapController::GetStrategy() const {
+        return mStrategy;
+    }
+
+    [[nodiscard]] bool SwapController::IsAutomatic() const {
+        return mAutomatic;
+    }
+
+    [[nodiscard]] double SwapController::GetRefreshPeriod() const
+    {
+        uint32_t refreshRate = mMonitor.GetVideoMode().mRefreshRate;
+        return 1.0 / (refreshRate != 0 ? static_cast<double>(refreshRate) : mDEFAULT_REFRESH_RATE);
+    }
+
+    [[nodiscard]] double SwapController::GetWorkTime() const {
+        return mPercentile(0.9);
+    }
+
+    [[nodiscard]] double SwapController::GetFrameDelay() const {
+        return mFrameDelay;
+    }
+
+    [[nodiscard]] std::string_view SwapController::GetName(Strategy strategy)
+    {
+        if (strategy >= Strategy::COUNT) {
+            throw SwapControllerException("Invalid swap strategy.");
+        }
+        return STRATEGY_NAMES[static_cast<std::size_t>(strategy)];
+    }
+
+    void SwapController::mApply(Strategy strategy)
+    {
+        mWindow.SetSwapInterval(SWAP_INTERVALS[static_cast<std::size_t>(strategy)]);
+        mStrategy = strategy;
+        mCandidate = strategy;
+        mFrameDelay = 0.0;
+    }
+
+    [[nodiscard]] SwapController::Strategy SwapController::mSelect() const
+    {
+        double period = GetRefreshPeriod();
+        double work = mPercentile(0.9);
+
+        if (work <= 0.5 * period) {
+            return Strategy::LATENCY_OPTIMIZED;
+        }
+        if (work <= 0.9 * period) {
+            return Strategy::VSYNC;
+        }
+        if (work <= 1.5 * period && mWindow.SupportsAdaptiveVSync()) {
+            return Strategy::ADAPTIVE;
+        }
+        return Strategy::HALF_RATE;
+    }
+
+    [[nodiscard]] double SwapController::mPercentile(double fraction) const
+    {
+        if (mSampleCount == 0) {
+            return 0.0;
+        }
+
+        std::array<double, WINDOW_SIZE> sorted;
+        std::copy_n(mSamples.begin(), mSampleCount, sorted.begin());
+        std::size_t index = std::min(static_cast<std::size_t>(fraction * mSampleCount), mSampleCount - 1);
+        std::nth_element(sorted.begin(), sorted.begin() + index, sorted.begin() + mSampleCount);
+
+        return sorted[index];
+    }
+}
@@ -0,0 +1,10 @@
+#include "TIMGE/Utils/Delegate.hpp"
+
+#include <format>
+
+namespace TIMGE
+{
+    DelegateException::DelegateException(std::string message)
+     : Exception(std::format("Delegate: {}", message))
+    {}
+}
@@ -0,0 +1,10 @@
+#include "TIMGE/Utils/HandlePool.hpp"
+
+#include <format>
+
+namespace TIMGE
+{
+    HandlePoolException::HandlePoolException(std::string message)
+     : Exception(std::format("HandlePool: {}", message))
+    {}
+}
@@ -3,10 +3,12 @@
 #include "TIMGE/Monitor.hpp"
 #include "TIMGE/Utils/Vector.hpp"
 
+#include <algorithm>
 #include <string>
 #include <array>
 #include <filesystem>
 #include <format>
+#include <vector>
 
 #include <GLFW/glfw3.h>
 #include <stb_image/stb_image.h>
@@ -17,29 +19,26 @@ namespace TIMGE
      : Exception(std::format("Window: {}", message))
     {}
 
-    Window *Window::mInstance = nullptr;
-
-    Window::Window(Window::Info &info, Monitor& monitor) 
+    Window::Window(Window::Info &info, Monitor& monitor, Window* share) 
      :  mInfo{info}, 
         mMonitor{monitor}, 
-        mWindow{nullptr}
+        mWindow{nullptr},
+        mShared{share != nullptr},
+        mAdaptiveVSync{false},
+        mSwapInterval{},
+        mPresentRate{},
+        mNextPresent{},
+        mRenderer{}
     {
-        if (mInstance) {
-            throw WindowException("Only one instance of Window is allowed!");
-        }
-
-        mInstance = this;
-
         mRetrieveMonitor();
         mRetrieveVideoMode();
 
         mValidateInfo();
-        mValidateFlags(mInfo.mFlags);
 
         mInitializeSizeBeforeFullscreen();
         mInitializePositionBeforeFullscreen();
 
-        mCreateWindow();
+        mCreateWindow(share);
 
         mLoadGL();
 
@@ -172,6 +171,19 @@ namespace TIMGE
         glfwSetWindowShouldClose(mWindow, shouldClose);
     }
 
+    void Window::SetPresentRate(double rate)
+    {
+        if (!(rate >= 0.0)) {
+            throw WindowException("Present rate must not be negative.");
+        }
+        mPresentRate = rate;
+        mNextPresent = {};
+    }
+
+    void Window::SetRenderer(Renderer_T renderer) {
+        mRenderer = std::move(renderer);
+    }
+
     void Window::ToggleResizable() {
         mInfo.mFlags ^= RESIZABLE;
 
@@ -215,9 +227,7 @@ namespace TIMGE
     }
 
     void Window::ToggleVSync() {
-        mInfo.mFlags ^= VSYNC;
-
-        glfwSwapInterval(GetState(VSYNC));
+        SetSwapInterval(GetState(VSYNC) ? 0 : 1);
     }
 
     void Window::ResetIcon() {
@@ -297,16 +307,87 @@ namespace TIMGE
         return glfwWindowShouldClose(mWindow);
     }
 
+    [[nodiscard]] bool Window::IsShared() const {
+        return mShared;
+    }
+
+    [[nodiscard]] double Window::GetPresentRate() const {
+        return mPresentRate;
+    }
+
+    [[nodiscard]] int Window::GetSwapInterval() const {
+        return mSwapInterval;
+    }
+
+    [[nodiscard]] bool Window::SupportsAdaptiveVSync() const {
+        return mAdaptiveVSync;
+    }
+
+    void Window::SetSwapInterval(int interval)
+    {
+        if (mShared) {
+            throw WindowException("Shared windows present without VSync, use SetPresentRate instead.");
+        }
+        if (interval < 0 && !mAdaptiveVSync) {
+            throw WindowException("Negative swap intervals need the EXT_swap_control_tear extension.");
+        }
+
+        mSwapInterval = interval;
+        if (interval != 0) {
+            mInfo.mFlags |= VSYNC;
+        } else {
+            mInfo.mFlags &= ~VSYNC;
+        }
+
+        GLFWwindow* current = glfwGetCurrentContext();
+        glfwMakeContextCurrent(mWindow);
+        glfwSwapInterval(mSwapInterval);
+        glfwMakeContextCurrent(current);
+    }
+
+    void Window::SetFullscreenMode(const Monitor::VideoMode& videoMode)
+    {
+        const std::vector<Monitor::VideoMode>& videoModes = mMonitor.GetVideoModes();
+        if (std::find(videoModes.begin(), videoModes.end(), videoMode) == videoModes.end()) {
+            throw WindowException("Fullscreen mode is not supported by the monitor.");
+        }
+
+        mFullscreenMode = videoMode;
+
+        if (GetState(FULLSCREEN)) {
+            glfwSetWindowMonitor(
+                mWindow, mFullscreenMonitor, 0, 0,
+                static_cast<int>(mFullscreenMode.mSize[V2ui32::WIDTH]),
+                static_cast<int>(mFullscreenMode.mSize[V2ui32::HEIGHT]),
+                static_cast<int>(mFullscreenMode.mRefreshRate)
+            );
+        }
+    }
+
+    void Window::MakeCurrent()
+    {
+        if (glfwGetCurrentContext() != mWindow) {
+            glfwMakeContextCurrent(mWindow);
+        }
+    }
+
+    void Window::SwapBuffers() {
+        glfwSwapBuffers(mWindow);
+    }
+
     GLFWwindow *Window::mGetWindow() {
         return mWindow;
     }
 
     void Window::mUpdateMonitor()
     {
-        mValidateFullscreen_BorderlessFullscreen(mInfo.mFlags);
+        // The other flags follow the live window state by now, so only the
+        // fullscreen modes are checked against each other.
+        mValidateFlags((mInfo.mFlags & (FULLSCREEN | BORDERLESS_FULLSCREEN)) | VISIBLE);
  
         mFullscreenMonitor = mMonitor.mGetMonitor();
-        mVidMode = glfwGetVideoMode(mFullscreenMonitor);
+        mVideoMode = mMonitor.GetVideoMode();
+        mFullscreenMode = mVideoMode;
 
         V2i32 new_position = mMonitor.GetWorkareaPosition();
         V2ui32 workarea_size = mMonitor.GetWorkareaSize();
@@ -337,11 +418,10 @@ namespace TIMGE
         mValidateAspectRatio(mInfo.mAspectRatio);
         mValidateOpacity(mInfo.mOpacity);
         mValidateOpenGLVersion(mInfo.mOpenGLVersion);
-        mValidateFullscreen_BorderlessFullscreen(mInfo.mFlags); 
         mValidateFlags(mInfo.mFlags);
     }
 
-    void Window::mCreateWindow()
+    void Window::mCreateWindow(Window* share)
     {
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
         glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, mInfo.mOpenGLVersion[V2ui32::GL_MAJOR]);
@@ -354,7 +434,7 @@ namespace TIMGE
         mWindow = glfwCreateWindow(
             static_cast<int>(mInfo.mSize[V2ui32::WIDTH]), 
             static_cast<int>(mInfo.mSize[V2ui32::HEIGHT]),
-            mInfo.mTitle.data(), nullptr, nullptr
+            mInfo.mTitle.data(), nullptr, share != nullptr ? share->mWindow : nullptr
         );
 
         if (!mWindow) {
@@ -371,11 +451,40 @@ namespace TIMGE
     void Window::mLoadGL()
     {
         glfwMakeContextCurrent(mWindow);
+
+        // Shared contexts come from the same driver and reuse the entry points
+        // loaded for the primary window. They never wait for vertical blank, so
+        // presenting one cannot stall the others.
+        if (mShared)
+        {
+            glfwSwapInterval(0);
+            return;
+        }
+
         if (!gladLoadGL()) {
             throw WindowException("Failed to load OpenGL!");
         }
 
-        glfwSwapInterval(GetState(VSYNC));
+        mAdaptiveVSync = glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear");
+        mSwapInterval = GetState(VSYNC);
+        glfwSwapInterval(mSwapInterval);
+    }
+
+    [[nodiscard]] bool Window::mPresentDue(std::chrono::steady_clock::time_point now)
+    {
+        if (!mRenderer || GetState(MINIMIZED)) {
+            return false;
+        }
+        if (mPresentRate == 0.0) {
+            return true;
+        }
+        if (now < mNextPresent) {
+            return false;
+        }
+
+        auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / mPresentRate));
+        mNextPresent = now - mNextPresent > interval ? now + interval : mNextPresent + interval;
+        return true;
     }
 
     void Window::mRetrieveFramebufferSize() {
@@ -409,8 +518,10 @@ namespace TIMGE
         mFullscreenMonitor = mMonitor.mGetMonitor();
     }
 
-    void Window::mRetrieveVideoMode() {
-        mVidMode = glfwGetVideoMode(mFullscreenMonitor);
+    void Window::mRetrieveVideoMode()
+    {
+        mVideoMode = mMonitor.GetVideoMode();
+        mFullscreenMode = mVideoMode;
     }
 
     void Window::mInitializeSizeBeforeFullscreen() {
@@ -429,8 +540,8 @@ namespace TIMGE
 
         glfwSetWindowAttrib(mWindow, GLFW_DECORATED, GLFW_FALSE);
         SetSize(V2ui32{ 
-            static_cast<uint32_t>(mVidMode->width),
-            static_cast<uint32_t>(mVidMode->height)
+            mVideoMode.mSize[V2ui32::WIDTH],
+            mVideoMode.mSize[V2ui32::HEIGHT]
         });
         SetPosition({ 0, 0 });
     }
@@ -448,7 +559,12 @@ namespace TIMGE
         mSizeBeforeFullscreen = mInfo.mSize;
         mPositionBeforeFullscreen = mInfo.mPosition;
 
-        glfwSetWindowMonitor(mWindow, mFullscreenMonitor, 0, 0, mVidMode->width, mVidMode->height, mVidMode->refreshRate);
+        glfwSetWindowMonitor(
+            mWindow, mFullscreenMonitor, 0, 0,
+            static_cast<int>(mFullscreenMode.mSize[V2ui32::WIDTH]),
+            static_cast<int>(mFullscreenMode.mSize[V2ui32::HEIGHT]),
+            static_cast<int>(mFullscreenMode.mRefreshRate)
+        );
     }
 
     void Window::mToggleOffFullscreen()
@@ -469,15 +585,15 @@ namespace TIMGE
     }
 
     [[nodiscard]] bool Window::mInvalidSizeMaxBound(const V2ui32& size) const {
-        return size[V2ui32::WIDTH] > static_cast<uint32_t>(mVidMode->width)
-            || size[V2ui32::HEIGHT] > static_cast<uint32_t>(mVidMode->height);
+        return size[V2ui32::WIDTH] > mVideoMode.mSize[V2ui32::WIDTH]
+            || size[V2ui32::HEIGHT] > mVideoMode.mSize[V2ui32::HEIGHT];
     }
 
     [[nodiscard]] bool Window::mInvalidSizeLimits(const V4ui32& sizeLimits) const {
         return sizeLimits[V2ui32::MAX_WIDTH] != SIZE_LIMITS_DONT_CARE 
-            && sizeLimits[V2ui32::MAX_WIDTH] > static_cast<uint32_t>(mVidMode->width)
+            && sizeLimits[V2ui32::MAX_WIDTH] > mVideoMode.mSize[V2ui32::WIDTH]
             || sizeLimits[V2ui32::MAX_HEIGHT] != SIZE_LIMITS_DONT_CARE
-            && sizeLimits[V2ui32::MAX_HEIGHT] > static_cast<uint32_t>(mVidMode->height);
+            && sizeLimits[V2ui32::MAX_HEIGHT] > mVideoMode.mSize[V2ui32::HEIGHT];
     }
 
     [[nodiscard]] bool Window::mInvalidAspectRatio(const V2ui32& aspectRatio) const {
@@ -509,38 +625,6 @@ namespace TIMGE
         return true;
     }
 
-    [[nodiscard]] bool Window::mConflictFullscreen_BorderlessFullscreen(FLAGS flags) const {
-        return GetState(FULLSCREEN) && GetState(BORDERLESS_FULLSCREEN);
-    }
-
-    [[nodiscard]] bool Window::mConflictVisible_Fullscreen(FLAGS flags) const {
-        return !GetState(VISIBLE) && GetState(FULLSCREEN);
-    }
-
-    [[nodiscard]] bool Window::mConflictDecorated_Fullscreen(FLAGS flags) const {
-        return GetState(DECORATED) && GetState(FULLSCREEN);
-    }
-
-    [[nodiscard]] bool Window::mConflictDecorated_BorderlessFullscreen(FLAGS flags) const {
-        return GetState(DECORATED) && GetState(BORDERLESS_FULLSCREEN);
-    }
-
-    [[nodiscard]] bool Window::mConflictFocused_Minimized(FLAGS flags) const {
-        return GetState(FOCUSED) && GetState(MINIMIZED);
-    }
-
-    [[nodiscard]] bool Window::mConflictFocused_CenterCursor(FLAGS flags) const {
-        return !GetState(FOCUSED) && GetState(CENTER_CURSOR);
-    }
-
-    [[nodiscard]] bool Window::mConflictCenterCursor_Minimized(FLAGS flags) const {
-        return GetState(CENTER_CURSOR) && GetState(MINIMIZED);
-    }
-
-    [[nodiscard]] bool Window::mConflictMinimized_Maximized(FLAGS flags) const {
-        return GetState(MINIMIZED) && GetState(MAXIMIZED);
-    }
-
     void Window::mValidateSize(const V2ui32& size)
     {
         if (mInvalidSizeMinBound(mInfo.mSize)) {
@@ -580,69 +664,8 @@ namespace TIMGE
 
     void Window::mValidateFlags(FLAGS flags)
     {
-        mValidateFullscreen_BorderlessFullscreen(flags);
-        mValidateVisible_Fullscreen(flags);
-        mValidateDecorated_Fullscreen(flags);
-        mValidateDecorated_BorderlessFullscreen(flags);
-        mValidateFocused_Minimized(flags);
-        mValidateFocused_CenterCursor(flags);
-        mValidateCenterCursor_Minimized(flags);
-        mValidateMinimized_Maximized(flags);
-    }
-
-    void Window::mValidateFullscreen_BorderlessFullscreen(FLAGS flags)
-    {
-        if (mConflictFullscreen_BorderlessFullscreen(flags)) {
-            throw WindowException("Window cannot be both Fullscreen and Borderless Fullscreen.");
-        }
-    }
-
-    void Window::mValidateVisible_Fullscreen(FLAGS flags)
-    {
-        if (mConflictVisible_Fullscreen(flags)) {
-            throw WindowException("Window cannot be both Hidden and Fullscreen.");
-        }
-    }
-
-    void Window::mValidateDecorated_Fullscreen(FLAGS flags)
-    {
-        if (mConflictDecorated_Fullscreen(flags)) {
-            throw WindowException("Window cannot be both Decorated and Fullscreen.");
-        }
-    }
-
-    void Window::mValidateDecorated_BorderlessFullscreen(FLAGS flags)
-    {
-        if (mConflictDecorated_BorderlessFullscreen(flags)) {
-            throw WindowException("Window cannot be both Decorated and Borderless Fullscreen.");
-        }
-    }
-
-    void Window::mValidateFocused_Minimized(FLAGS flags)
-    {
-        if (mConflictFocused_Minimized(flags)) {
-            throw WindowException("Window cannot be both Focused and Minimized.");
-        }
-    }
-
-    void Window::mValidateFocused_CenterCursor(FLAGS flags)
-    {
-        if (mConflictFocused_CenterCursor(flags)) {
-            throw WindowException("Cursor cannot be centered on unfocused window.");
-        }
-    }
-
-    void Window::mValidateCenterCursor_Minimized(FLAGS flags)
-    {
-        if (mConflictCenterCursor_Minimized(flags)) {
-            throw WindowException("Cursor cannot be centered on minimized window.");
-        }
-    }
-
-    void Window::mValidateMinimized_Maximized(FLAGS flags)
-    {
-        if (mConflictMinimized_Maximized(flags)) {
-            throw WindowException("Window cannot be both Minimized and Maximized.");
+        if (const FlagConflict* conflict = FindFlagConflict(flags); conflict != nullptr) {
+            throw WindowException(std::string(conflict->mMessage));
         }
     }
 